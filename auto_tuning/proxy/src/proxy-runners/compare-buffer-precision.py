@@ -0,0 +1,30 @@
+import argparse
+import re
+import subprocess
+
+
+def run(executable, cells, timesteps, kernel):
+    result = subprocess.run([executable, str(cells), str(timesteps), kernel],
+                            capture_output=True, text=True, check=True)
+    time = re.search(r'time for seissol proxy\s*:\s*([0-9.eE+-]+)', result.stdout)
+    bandwidth = re.search(r'GiB/s \(estimate\) for seissol proxy\s*:\s*([0-9.eE+-]+)', result.stdout)
+    if time is None or bandwidth is None:
+        raise RuntimeError(f'could not parse the output of {executable}:\n{result.stdout}')
+    return float(time.group(1)), float(bandwidth.group(1))
+
+
+parser = argparse.ArgumentParser(description='compares proxies built with and without SINGLE_PRECISION_BUFFERS')
+parser.add_argument('-d', '--double', required=True, type=str, help="proxy built with double precision buffers")
+parser.add_argument('-s', '--single', required=True, type=str, help="proxy built with single precision buffers")
+parser.add_argument('-c', '--cells', default=100000, type=int, help="num cells in a time cluster")
+parser.add_argument('-t', '--timesteps', default=20, type=int, help="num time steps/repeats")
+parser.add_argument('-k', '--kernel', default='all', type=str, help="kernel types")
+args = parser.parse_args()
+
+doubleTime, doubleBandwidth = run(args.double, args.cells, args.timesteps, args.kernel)
+singleTime, singleBandwidth = run(args.single, args.cells, args.timesteps, args.kernel)
+
+print(f'{"buffers":<10}{"time (s)":>14}{"GiB/s":>14}')
+print(f'{"double":<10}{doubleTime:>14.4f}{doubleBandwidth:>14.2f}')
+print(f'{"single":<10}{singleTime:>14.4f}{singleBandwidth:>14.2f}')
+print(f'speedup of single precision buffers: {doubleTime / singleTime:.3f}')
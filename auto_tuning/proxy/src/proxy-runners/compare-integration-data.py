@@ -0,0 +1,30 @@
+import argparse
+import re
+import subprocess
+
+
+def run(executable, cells, timesteps, kernel):
+    result = subprocess.run([executable, str(cells), str(timesteps), kernel],
+                            capture_output=True, text=True, check=True)
+    time = re.search(r'time for seissol proxy\s*:\s*([0-9.eE+-]+)', result.stdout)
+    size = re.search(r'Integration data per cell \(bytes\)\s*:\s*([0-9.]+)', result.stdout)
+    if time is None or size is None:
+        raise RuntimeError(f'could not parse the output of {executable}:\n{result.stdout}')
+    return float(time.group(1)), float(size.group(1))
+
+
+parser = argparse.ArgumentParser(description='compares proxies built with and without COMPACT_INTEGRATION_DATA')
+parser.add_argument('-s', '--stored', required=True, type=str, help="proxy built with stored integration data")
+parser.add_argument('-p', '--compact', required=True, type=str, help="proxy built with compact integration data")
+parser.add_argument('-c', '--cells', default=100000, type=int, help="num cells in a time cluster")
+parser.add_argument('-t', '--timesteps', default=20, type=int, help="num time steps/repeats")
+parser.add_argument('-k', '--kernel', default='all', type=str, help="kernel types")
+args = parser.parse_args()
+
+storedTime, storedSize = run(args.stored, args.cells, args.timesteps, args.kernel)
+compactTime, compactSize = run(args.compact, args.cells, args.timesteps, args.kernel)
+
+print(f'{"variant":<10}{"time (s)":>14}{"bytes/cell":>14}')
+print(f'{"stored":<10}{storedTime:>14.4f}{storedSize:>14.0f}')
+print(f'{"compact":<10}{compactTime:>14.4f}{compactSize:>14.0f}')
+print(f'speedup of compact: {storedTime / compactTime:.3f}, memory saved: {1.0 - compactSize / storedSize:.1%}')
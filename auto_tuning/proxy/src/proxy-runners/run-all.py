@@ -26,7 +26,7 @@ config.cells = args.cells
 config.timesteps = args.timesteps
 config.verbose = False
 
-df = pd.DataFrame(columns=['kernel type', 'time', 'HW GFLOPS', 'NZ GFLOPS'])
+df = pd.DataFrame(columns=['kernel type', 'time', 'HW GFLOPS', 'NZ GFLOPS', 'GiB/s', 'time per element'])
 kernels = pb.Aux.get_allowed_kernels()
 with Bar('proxy...    ', max=len(kernels)) as bar:
     for index, kernel in enumerate(kernels):
@@ -35,7 +35,9 @@ with Bar('proxy...    ', max=len(kernels)) as bar:
         df.loc[index] = [kernel,
                          result.time,
                          result.hardware_gflops,
-                         result.non_zero_gflops]
+                         result.non_zero_gflops,
+                         result.gib_per_second,
+                         result.time_per_element]
         bar.next()
 
 # prepare a unique file suffix
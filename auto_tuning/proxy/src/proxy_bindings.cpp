@@ -13,6 +13,14 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .value("localwoader", Kernel::localwoader)
       .value("neigh_dr", Kernel::neigh_dr)
       .value("godunov_dr", Kernel::godunov_dr)
+      .value("friction_lsw", Kernel::friction_lsw)
+      .value("friction_lsw_tp", Kernel::friction_lsw_tp)
+      .value("friction_rs_fast", Kernel::friction_rs_fast)
+      .value("friction_rs_fast_tp", Kernel::friction_rs_fast_tp)
+      .value("friction_rs_slow", Kernel::friction_rs_slow)
+      .value("friction_rs_slow_tp", Kernel::friction_rs_slow_tp)
+      .value("plasticity", Kernel::plasticity)
+      .value("point_sources", Kernel::point_sources)
       .export_values();
 
   py::class_<ProxyConfig>(module, "ProxyConfig")
@@ -20,6 +28,7 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .def_readwrite("cells", &ProxyConfig::cells)
       .def_readwrite("timesteps", &ProxyConfig::timesteps)
       .def_readwrite("kernel", &ProxyConfig::kernel)
+      .def_readwrite("yield_fraction", &ProxyConfig::yieldFraction)
       .def_readwrite("verbose", &ProxyConfig::verbose);
 
   py::class_<ProxyOutput>(module, "ProxyOutput")
@@ -37,7 +46,9 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .def_readwrite("bytes_per_cycle", &ProxyOutput::bytesPerCycle)
       .def_readwrite("non_zero_gflops", &ProxyOutput::nonZeroGFlops)
       .def_readwrite("hardware_gflops", &ProxyOutput::hardwareGFlops)
-      .def_readwrite("gib_per_second", &ProxyOutput::gibPerSecond);
+      .def_readwrite("gib_per_second", &ProxyOutput::gibPerSecond)
+      .def_readwrite("integration_data_bytes_per_cell", &ProxyOutput::integrationDataBytesPerCell)
+      .def_readwrite("time_per_element", &ProxyOutput::timePerElement);
 
   py::class_<Aux>(module, "Aux")
       .def(py::init<>())
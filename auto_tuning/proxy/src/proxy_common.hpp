@@ -13,13 +13,22 @@ enum Kernel {
   ader,
   localwoader,
   neigh_dr,
-  godunov_dr
+  godunov_dr,
+  friction_lsw,
+  friction_lsw_tp,
+  friction_rs_fast,
+  friction_rs_fast_tp,
+  friction_rs_slow,
+  friction_rs_slow_tp,
+  plasticity,
+  point_sources
 };
 
 struct ProxyConfig {
   unsigned cells{static_cast<unsigned>(1e5)};
   unsigned timesteps{10};
   Kernel kernel{Kernel::all};
+  double yieldFraction{0.1}; //!< fraction of the cells which yield in the plasticity kernel
   bool verbose{true};
 };
 
@@ -38,6 +47,8 @@ struct ProxyOutput{
   double nonZeroGFlops{};
   double hardwareGFlops{};
   double gibPerSecond{};
+  double integrationDataBytesPerCell{};
+  double timePerElement{};
 };
 
 ProxyOutput runProxy(ProxyConfig config);
@@ -86,7 +97,9 @@ struct Aux {
     printf("Bytes/cycle (estimate)              : %f\n\n", output.bytesPerCycle);
     printf("GFLOPS (non-zero) for seissol proxy : %f\n",   output.nonZeroGFlops);
     printf("GFLOPS (hardware) for seissol proxy : %f\n",   output.hardwareGFlops);
-    printf("GiB/s (estimate) for seissol proxy  : %f\n",   output.gibPerSecond);
+    printf("GiB/s (estimate) for seissol proxy  : %f\n\n", output.gibPerSecond);
+    printf("Time per element (ns)               : %f\n",   output.timePerElement * 1.e9);
+    printf("Integration data per cell (bytes)   : %f\n",   output.integrationDataBytesPerCell);
     printf("=================================================\n");
     printf("\n");
   }
@@ -99,7 +112,15 @@ protected:
       {Kernel::ader,        "ader"},
       {Kernel::localwoader, "localwoader"},
       {Kernel::neigh_dr,    "neigh_dr"},
-      {Kernel::godunov_dr,  "godunov_dr"}
+      {Kernel::godunov_dr,  "godunov_dr"},
+      {Kernel::friction_lsw,        "friction_lsw"},
+      {Kernel::friction_lsw_tp,     "friction_lsw_tp"},
+      {Kernel::friction_rs_fast,    "friction_rs_fast"},
+      {Kernel::friction_rs_fast_tp, "friction_rs_fast_tp"},
+      {Kernel::friction_rs_slow,    "friction_rs_slow"},
+      {Kernel::friction_rs_slow_tp, "friction_rs_slow_tp"},
+      {Kernel::plasticity,          "plasticity"},
+      {Kernel::point_sources,       "point_sources"}
   };
 
   inline static std::unordered_map<std::string, Kernel> invMap{
@@ -109,7 +130,15 @@ protected:
       {"ader", Kernel::ader},
       {"localwoader", Kernel::localwoader},
       {"neigh_dr", Kernel::neigh_dr},
-      {"godunov_dr", Kernel::godunov_dr}
+      {"godunov_dr", Kernel::godunov_dr},
+      {"friction_lsw", Kernel::friction_lsw},
+      {"friction_lsw_tp", Kernel::friction_lsw_tp},
+      {"friction_rs_fast", Kernel::friction_rs_fast},
+      {"friction_rs_fast_tp", Kernel::friction_rs_fast_tp},
+      {"friction_rs_slow", Kernel::friction_rs_slow},
+      {"friction_rs_slow_tp", Kernel::friction_rs_slow_tp},
+      {"plasticity", Kernel::plasticity},
+      {"point_sources", Kernel::point_sources}
   };
 };
 
@@ -15,6 +15,7 @@ int main(int argc, char* argv[]) {
   args.addAdditionalOption("cells", "Number of cells");
   args.addAdditionalOption("timesteps", "Number of timesteps");
   args.addAdditionalOption("kernel", kernelHelp.str());
+  args.addOption("yield-fraction", 'y', "Fraction of the cells which yield in the plasticity kernel", utils::Args::Required, false);
 
   if (args.parse(argc, argv) != utils::Args::Success) {
     return -1;
@@ -24,6 +25,7 @@ int main(int argc, char* argv[]) {
   config.cells = args.getAdditionalArgument<unsigned>("cells");
   config.timesteps = args.getAdditionalArgument<unsigned>("timesteps");
   auto kernelStr = args.getAdditionalArgument<std::string>("kernel");
+  config.yieldFraction = args.getArgument<double>("yield-fraction", config.yieldFraction);
 
   try {
     config.kernel = Aux::str2kernel(kernelStr);
@@ -98,6 +98,12 @@ using namespace proxy::device;
 using namespace proxy::cpu;
 #endif
 
+bool isFrictionKernel(unsigned kernel) {
+  return kernel == friction_lsw || kernel == friction_lsw_tp ||
+         kernel == friction_rs_fast || kernel == friction_rs_fast_tp ||
+         kernel == friction_rs_slow || kernel == friction_rs_slow_tp;
+}
+
 void testKernel(unsigned kernel, unsigned timesteps) {
   unsigned t = 0;
   switch (kernel) {
@@ -133,6 +139,30 @@ void testKernel(unsigned kernel, unsigned timesteps) {
         computeDynRupGodunovState();
       }
       break;
+    // the following kernels are only implemented on the host
+    case friction_lsw:
+    case friction_lsw_tp:
+    case friction_rs_fast:
+    case friction_rs_fast_tp:
+    case friction_rs_slow:
+    case friction_rs_slow_tp:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeFrictionLaw();
+      }
+      break;
+    case plasticity:
+      // count only the cells of this call, i.e. of the measured run
+      m_plasticityCandidates = 0;
+      m_plasticityYielded = 0;
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computePlasticity();
+      }
+      break;
+    case point_sources:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computePointSources();
+      }
+      break;
     default:
       break;
   }
@@ -166,7 +196,15 @@ ProxyOutput runProxy(ProxyConfig config) {
     printf("Allocating fake data...\n");
 
   initGlobalData();
-  config.cells = initDataStructures(config.cells, enableDynamicRupture);
+  config.cells = initDataStructures(config.cells, enableDynamicRupture, config.kernel == plasticity);
+  if (isFrictionKernel(config.kernel)) {
+    // every face of a cell is a fault face
+    initFrictionLawData(config.kernel, 4 * config.cells);
+  } else if (config.kernel == plasticity) {
+    initPlasticityData(config.yieldFraction);
+  } else if (config.kernel == point_sources) {
+    initPointSources();
+  }
 #ifdef ACL_DEVICE
   initDataStructuresOnDevice(enableDynamicRupture);
 #endif // ACL_DEVICE
@@ -233,6 +271,23 @@ ProxyOutput runProxy(ProxyConfig config) {
       flop_fun = &flops_drgod_actual;
       bytes_fun = &noestimate;
       break;
+    case friction_lsw:
+    case friction_lsw_tp:
+    case friction_rs_fast:
+    case friction_rs_fast_tp:
+    case friction_rs_slow:
+    case friction_rs_slow_tp:
+      flop_fun = &flops_friction_actual;
+      bytes_fun = &bytes_friction;
+      break;
+    case plasticity:
+      flop_fun = &flops_plasticity_actual;
+      bytes_fun = &bytes_plasticity;
+      break;
+    case point_sources:
+      flop_fun = &flops_pointsources_actual;
+      bytes_fun = &bytes_pointsources;
+      break;
   }
  
 
@@ -257,6 +312,20 @@ ProxyOutput runProxy(ProxyConfig config) {
   output.nonZeroGFlops = (static_cast<double>(actual_flops.d_nonZeroFlops)  * 1.e-9)/total;
   output.hardwareGFlops = (static_cast<double>(actual_flops.d_hardwareFlops) * 1.e-9)/total;
   output.gibPerSecond = (bytes_estimate/(1024.0*1024.0*1024.0))/total;
+  // the material is stored in both variants of the integration data
+  output.integrationDataBytesPerCell = static_cast<double>(sizeof(LocalIntegrationData) + sizeof(NeighboringIntegrationData));
+  // the elements are the fault faces for the friction laws and the sources for the point sources
+  double elements = static_cast<double>(config.cells);
+  if (isFrictionKernel(config.kernel)) {
+    elements = static_cast<double>(m_dynRupTree->child(0).child<Interior>().getNumberOfCells());
+  } else if (config.kernel == point_sources) {
+    elements = static_cast<double>(m_pointSourceCluster->size());
+  }
+  output.timePerElement = total / (static_cast<double>(config.timesteps) * elements);
+
+  m_frictionSolver.reset();
+  m_frictionLts.reset();
+  m_pointSourceCluster.reset();
 
   delete m_ltsTree;
   delete m_dynRupTree;
@@ -60,8 +60,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Initializer/LTS.h"
 #include "Initializer/DynamicRupture.h"
 #include "Initializer/GlobalData.h"
+#include "Initializer/Parameters/DRParameters.h"
+#include "DynamicRupture/FrictionLaws/FrictionLaws.h"
+#include "DynamicRupture/FrictionLaws/ThermalPressurization/ThermalPressurization.h"
+#include "Kernels/Plasticity.h"
+#include "Kernels/PointSourceClusterOnHost.h"
+#include "generated_code/kernel.h"
 #include "Solver/time_stepping/MiniSeisSol.cpp"
 #include <yateto.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
 #include <unordered_set>
 
 #ifdef ACL_DEVICE
@@ -88,6 +99,27 @@ seissol::kernels::DynamicRupture m_dynRupKernel;
 
 seissol::memory::ManagedAllocator *m_allocator{nullptr};
 
+// friction law kernels, the faces are stored in m_dynRupTree
+constexpr double ProxyFaultTimeStep = 1.0e-3;
+std::unique_ptr<seissol::initializer::DynamicRupture>       m_frictionLts;
+std::unique_ptr<seissol::dr::friction_law::FrictionSolver>  m_frictionSolver;
+seissol::initializer::parameters::DRParameters              m_drParameters;
+double m_faultTime = 0.0;
+
+// plasticity kernel; the time step is small compared to the relaxation time, such that the
+// yielding cells stay above the yield surface during the whole benchmark
+constexpr double ProxyPlasticityTimeStep = 1.0e-4;
+constexpr double ProxyPlasticityRelaxationTime = 0.05;
+long long m_plasticityCandidates = 0;
+long long m_plasticityYielded = 0;
+
+// point source kernel, one NRF source per cell
+constexpr unsigned ProxySamplesPerSource = 200;
+constexpr double ProxySamplingInterval = 0.01;
+constexpr double ProxyPointSourceTimeStep = 0.05;
+std::unique_ptr<seissol::kernels::PointSourceCluster> m_pointSourceCluster;
+double m_pointSourceTime = 0.0;
+
 namespace tensor = seissol::tensor;
 
 void initGlobalData() {
@@ -110,10 +142,10 @@ void initGlobalData() {
   m_dynRupKernel.setGlobalData(globalData);
 }
 
-unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture) {
+unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture, bool enablePlasticity) {
   // init RNG
   srand48(i_cells);
-  m_lts.addTo(*m_ltsTree, false); // proxy does not use plasticity
+  m_lts.addTo(*m_ltsTree, enablePlasticity);
   m_ltsTree->setNumberOfTimeClusters(1);
   m_ltsTree->fixate();
   
@@ -124,6 +156,9 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
   
   seissol::initializer::Layer& layer = cluster.child<Interior>();
   layer.setBucketSize(m_lts.buffersDerivatives, sizeof(real) * tensor::I::size() * layer.getNumberOfCells());
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+  layer.setBucketSize(m_lts.compressedBuffersStorage, sizeof(float) * tensor::I::size() * layer.getNumberOfCells());
+#endif
   
   m_ltsTree->allocateVariables();
   m_ltsTree->touchVariables();
@@ -156,6 +191,27 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
   /* cell information and integration data*/
   seissol::fakeData(m_lts, layer, (enableDynamicRupture) ? FaceType::dynamicRupture : FaceType::regular);
 
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+  // all cells are interior cells, i.e. the local and neighbor kernels use the single precision buffers
+  {
+    real** buffers = layer.var(m_lts.buffers);
+    float** compressedBuffers = layer.var(m_lts.compressedBuffers);
+    float* (*compressedFaceNeighbors)[4] = layer.var(m_lts.compressedFaceNeighbors);
+    CellLocalInformation* cellInformation = layer.var(m_lts.cellInformation);
+    float* storage = static_cast<float*>(layer.bucket(m_lts.compressedBuffersStorage));
+    for (unsigned cell = 0; cell < i_cells; ++cell) {
+      compressedBuffers[cell] = storage + static_cast<std::size_t>(cell) * tensor::I::size();
+      std::copy_n(buffers[cell], tensor::I::size(), compressedBuffers[cell]);
+    }
+    for (unsigned cell = 0; cell < i_cells; ++cell) {
+      for (unsigned face = 0; face < 4; ++face) {
+        compressedFaceNeighbors[cell][face] = (cellInformation[cell].faceTypes[face] == FaceType::regular)
+            ? compressedBuffers[cellInformation[cell].faceNeighborIds[face]] : nullptr;
+      }
+    }
+  }
+#endif
+
   if (enableDynamicRupture) {
     // From lts tree
     CellDRMapping (*drMapping)[4] = m_ltsTree->var(m_lts.drMapping);
@@ -198,6 +254,254 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
   return i_cells;
 }
 
+void initFrictionLawData(Kernel kernel, unsigned numberOfFaces) {
+  namespace friction_law = seissol::dr::friction_law;
+  using namespace seissol::dr::misc::quantity_indices;
+
+  const bool isFastVelocityWeakening = (kernel == friction_rs_fast || kernel == friction_rs_fast_tp);
+
+  // parameters of the SCEC benchmarks TPV5, TPV101, TPV104 and TPV105
+  m_drParameters = seissol::initializer::parameters::DRParameters{};
+  m_drParameters.isThermalPressureOn = (kernel == friction_rs_fast_tp || kernel == friction_rs_slow_tp);
+  m_drParameters.tpProxyExponent = 1.0 / 3.0;
+  m_drParameters.rsF0 = 0.6;
+  m_drParameters.rsB = isFastVelocityWeakening ? 0.014 : 0.012;
+  m_drParameters.rsSr0 = 1.0e-6;
+  m_drParameters.rsInitialSlipRate1 = 1.0e-6;
+  m_drParameters.muW = 0.2;
+  m_drParameters.thermalDiffusivity = 1.0e-6;
+  m_drParameters.heatCapacity = 2.7e6;
+  m_drParameters.undrainedTPResponse = 0.1e6;
+  m_drParameters.initialTemperature = 483.15;
+  m_drParameters.initialPressure = 0.0;
+
+  switch (kernel) {
+    case friction_lsw:
+      m_frictionLts = std::make_unique<seissol::initializer::LTSLinearSlipWeakening>();
+      m_frictionSolver = std::make_unique<friction_law::LinearSlipWeakeningLaw<friction_law::NoSpecialization>>(&m_drParameters);
+      break;
+    case friction_lsw_tp:
+      m_frictionLts = std::make_unique<seissol::initializer::LTSLinearSlipWeakening>();
+      m_frictionSolver = std::make_unique<friction_law::LinearSlipWeakeningLaw<friction_law::TPApprox>>(&m_drParameters);
+      break;
+    case friction_rs_fast:
+      m_frictionLts = std::make_unique<seissol::initializer::LTSRateAndStateFastVelocityWeakening>();
+      m_frictionSolver = std::make_unique<friction_law::FastVelocityWeakeningLaw<friction_law::NoTP>>(&m_drParameters);
+      break;
+    case friction_rs_fast_tp:
+      m_frictionLts = std::make_unique<seissol::initializer::LTSRateAndStateThermalPressurization>();
+      m_frictionSolver = std::make_unique<friction_law::FastVelocityWeakeningLaw<friction_law::ThermalPressurization>>(&m_drParameters);
+      break;
+    case friction_rs_slow:
+      m_frictionLts = std::make_unique<seissol::initializer::LTSRateAndState>();
+      m_frictionSolver = std::make_unique<friction_law::AgingLaw<friction_law::NoTP>>(&m_drParameters);
+      break;
+    case friction_rs_slow_tp:
+      m_frictionLts = std::make_unique<seissol::initializer::LTSRateAndStateThermalPressurization>();
+      m_frictionSolver = std::make_unique<friction_law::AgingLaw<friction_law::ThermalPressurization>>(&m_drParameters);
+      break;
+    default:
+      throw std::runtime_error("not a friction law kernel");
+  }
+
+  m_frictionLts->addTo(*m_dynRupTree);
+  m_dynRupTree->setNumberOfTimeClusters(1);
+  m_dynRupTree->fixate();
+
+  seissol::initializer::TimeCluster& cluster = m_dynRupTree->child(0);
+  cluster.child<Ghost>().setNumberOfCells(0);
+  cluster.child<Copy>().setNumberOfCells(0);
+  cluster.child<Interior>().setNumberOfCells(numberOfFaces);
+
+  m_dynRupTree->allocateVariables();
+  m_dynRupTree->touchVariables();
+
+  seissol::initializer::Layer& layer = cluster.child<Interior>();
+  seissol::dr::ImpedancesAndEta* impAndEta = layer.var(m_frictionLts->impAndEta);
+  real (*initialStressInFaultCS)[seissol::dr::misc::numPaddedPoints][6] = layer.var(m_frictionLts->initialStressInFaultCS);
+  real (*mu)[seissol::dr::misc::numPaddedPoints] = layer.var(m_frictionLts->mu);
+  real (*slipRate1)[seissol::dr::misc::numPaddedPoints] = layer.var(m_frictionLts->slipRate1);
+  bool (*ruptureTimePending)[seissol::dr::misc::numPaddedPoints] = layer.var(m_frictionLts->ruptureTimePending);
+  bool (*dynStressTimePending)[seissol::dr::misc::numPaddedPoints] = layer.var(m_frictionLts->dynStressTimePending);
+  real (*qInterpolatedPlus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()] = layer.var(m_frictionLts->qInterpolatedPlus);
+  real (*qInterpolatedMinus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()] = layer.var(m_frictionLts->qInterpolatedMinus);
+
+  // same elastic material on both sides of the fault
+  const real zp = 2670.0 * 6000.0;
+  const real zs = 2670.0 * 3464.0;
+  for (unsigned face = 0; face < numberOfFaces; ++face) {
+    const real etaP = zp / 2;
+    const real etaS = zs / 2;
+    impAndEta[face] = {zp, zs, zp, zs, etaP, etaS, 1 / etaS, 1 / zp, 1 / zs, 1 / zp, 1 / zs};
+    for (unsigned point = 0; point < seissol::dr::misc::numPaddedPoints; ++point) {
+      // part of the fault is loaded above its static strength
+      initialStressInFaultCS[face][point][XX] = -120.0e6;
+      initialStressInFaultCS[face][point][XY] = (0.6 + 0.1 * drand48()) * 120.0e6;
+      ruptureTimePending[face][point] = true;
+      dynStressTimePending[face][point] = true;
+    }
+    for (unsigned order = 0; order < CONVERGENCE_ORDER; ++order) {
+      for (unsigned i = 0; i < tensor::QInterpolated::size(); ++i) {
+        qInterpolatedPlus[face][order][i] = static_cast<real>(drand48() - 0.5);
+        qInterpolatedMinus[face][order][i] = static_cast<real>(drand48() - 0.5);
+      }
+    }
+  }
+
+  if (auto* concreteLts = dynamic_cast<seissol::initializer::LTSLinearSlipWeakening*>(m_frictionLts.get())) {
+    real (*dC)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->dC);
+    real (*muS)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->muS);
+    real (*muD)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->muD);
+    real (*forcedRuptureTime)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->forcedRuptureTime);
+    for (unsigned face = 0; face < numberOfFaces; ++face) {
+      for (unsigned point = 0; point < seissol::dr::misc::numPaddedPoints; ++point) {
+        dC[face][point] = 0.4;
+        muS[face][point] = 0.677;
+        muD[face][point] = 0.525;
+        mu[face][point] = muS[face][point];
+        forcedRuptureTime[face][point] = 1.0e10;
+      }
+    }
+  }
+
+  if (auto* concreteLts = dynamic_cast<seissol::initializer::LTSRateAndState*>(m_frictionLts.get())) {
+    real (*rsA)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->rsA);
+    real (*rsSl0)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->rsSl0);
+    real (*stateVariable)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->stateVariable);
+    const double a = isFastVelocityWeakening ? 0.01 : 0.008;
+    const double sl0 = isFastVelocityWeakening ? 0.4 : 0.02;
+    const double sr0 = m_drParameters.rsSr0;
+    const double f0 = m_drParameters.rsF0;
+    const double b = m_drParameters.rsB;
+    const double initialSlipRate = m_drParameters.rsInitialSlipRate1;
+    for (unsigned face = 0; face < numberOfFaces; ++face) {
+      for (unsigned point = 0; point < seissol::dr::misc::numPaddedPoints; ++point) {
+        rsA[face][point] = a;
+        rsSl0[face][point] = sl0;
+        slipRate1[face][point] = initialSlipRate;
+        // steady state for the initial slip rate, as computed by the rate-and-state initializers
+        const double tmp = std::abs(initialStressInFaultCS[face][point][XY] / (a * initialStressInFaultCS[face][point][XX]));
+        if (isFastVelocityWeakening) {
+          const double state = a * std::log(2.0 * sr0 / initialSlipRate * std::sinh(tmp));
+          stateVariable[face][point] = state;
+          mu[face][point] = a * std::asinh(initialSlipRate * 0.5 / sr0 * std::exp(state / a));
+        } else {
+          const double state = sl0 / sr0 * std::exp((a * std::log(2.0 * std::sinh(tmp)) - f0 - a * std::log(initialSlipRate / sr0)) / b);
+          stateVariable[face][point] = state;
+          mu[face][point] = a * std::asinh(initialSlipRate * 0.5 / sr0 * std::exp((f0 + b * std::log(sr0 * state / sl0)) / a));
+        }
+      }
+    }
+  }
+
+  if (auto* concreteLts = dynamic_cast<seissol::initializer::LTSRateAndStateFastVelocityWeakening*>(m_frictionLts.get())) {
+    real (*rsSrW)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->rsSrW);
+    for (unsigned face = 0; face < numberOfFaces; ++face) {
+      std::fill_n(rsSrW[face], seissol::dr::misc::numPaddedPoints, 0.1);
+    }
+  }
+
+  if (auto* concreteLts = dynamic_cast<seissol::initializer::LTSRateAndStateThermalPressurization*>(m_frictionLts.get())) {
+    real (*temperature)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->temperature);
+    real (*pressure)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->pressure);
+    real (*halfWidthShearZone)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->halfWidthShearZone);
+    real (*hydraulicDiffusivity)[seissol::dr::misc::numPaddedPoints] = layer.var(concreteLts->hydraulicDiffusivity);
+    for (unsigned face = 0; face < numberOfFaces; ++face) {
+      std::fill_n(temperature[face], seissol::dr::misc::numPaddedPoints, m_drParameters.initialTemperature);
+      std::fill_n(pressure[face], seissol::dr::misc::numPaddedPoints, m_drParameters.initialPressure);
+      std::fill_n(halfWidthShearZone[face], seissol::dr::misc::numPaddedPoints, 0.02);
+      std::fill_n(hydraulicDiffusivity[face], seissol::dr::misc::numPaddedPoints, 4.0e-4);
+    }
+  }
+
+  m_dynRupKernel.setTimeStepWidth(ProxyFaultTimeStep);
+  m_faultTime = 0.0;
+}
+
+void initPlasticityData(double yieldFraction) {
+  seissol::initializer::Layer& layer = m_ltsTree->child(0).child<Interior>();
+  PlasticityData* plasticity = layer.var(m_lts.plasticity);
+
+  // a cell yields if its initial shear stress exceeds the cohesion plus the frictional strength
+  const real shearModulus = 3.2e10;
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    const bool yields = drand48() < yieldFraction;
+    std::fill_n(plasticity[cell].initialLoading, 3, -50.0e6);
+    std::fill_n(plasticity[cell].initialLoading + 3, 3, 0.0);
+    plasticity[cell].initialLoading[3] = yields ? 60.0e6 : 0.0;
+    plasticity[cell].cohesionTimesCosAngularFriction = 1.0e6;
+    plasticity[cell].sinAngularFriction = 0.6;
+    plasticity[cell].mufactor = 1.0 / (2.0 * shearModulus);
+  }
+}
+
+void initPointSources() {
+  seissol::initializer::Layer& layer = m_ltsTree->child(0).child<Interior>();
+  const unsigned nrOfCells = layer.getNumberOfCells();
+  real (*dofs)[tensor::Q::size()] = layer.var(m_lts.dofs);
+
+  auto alloc = seissol::sourceterm::AllocatorT();
+  seissol::sourceterm::PointSources sources(alloc);
+  sources.mode = seissol::sourceterm::PointSources::NRF;
+  sources.numberOfSources = nrOfCells;
+  sources.mInvJInvPhisAtSources.resize(nrOfCells);
+  sources.tensor.resize(nrOfCells);
+  sources.A.resize(nrOfCells, 1.0e4);
+  sources.stiffnessTensor.resize(nrOfCells);
+  sources.onsetTime.resize(nrOfCells, 0.0);
+  sources.samplingInterval.resize(nrOfCells, ProxySamplingInterval);
+  for (unsigned i = 0; i < 3; ++i) {
+    sources.sampleOffsets[i].resize(nrOfCells + 1);
+    sources.sample[i].resize(static_cast<std::size_t>(nrOfCells) * ProxySamplesPerSource);
+  }
+
+  // isotropic material with lambda = mu
+  std::array<real, 81> stiffness{};
+  const real lame = 3.2e10;
+  for (unsigned i = 0; i < 3; ++i) {
+    for (unsigned j = 0; j < 3; ++j) {
+      for (unsigned k = 0; k < 3; ++k) {
+        for (unsigned l = 0; l < 3; ++l) {
+          stiffness[i + 3 * j + 9 * k + 27 * l] = lame * ((i == j) * (k == l) + (i == k) * (j == l) + (i == l) * (j == k));
+        }
+      }
+    }
+  }
+
+  for (unsigned source = 0; source < nrOfCells; ++source) {
+    for (unsigned i = 0; i < tensor::mInvJInvPhisAtSources::size(); ++i) {
+      sources.mInvJInvPhisAtSources[source][i] = static_cast<real>(drand48());
+    }
+    // the fault basis is the cartesian basis
+    for (unsigned i = 0; i < sources.tensor[source].size(); ++i) {
+      sources.tensor[source][i] = (i == 0 || i == 4 || i == 8) ? 1.0 : 0.0;
+    }
+    sources.stiffnessTensor[source] = stiffness;
+    for (unsigned i = 0; i < 3; ++i) {
+      sources.sampleOffsets[i][source] = static_cast<std::size_t>(source) * ProxySamplesPerSource;
+      sources.sampleOffsets[i][source + 1] = static_cast<std::size_t>(source + 1) * ProxySamplesPerSource;
+    }
+  }
+  for (unsigned i = 0; i < 3; ++i) {
+    for (auto& sample : sources.sample[i]) {
+      sample = static_cast<real>(drand48());
+    }
+  }
+
+  seissol::sourceterm::ClusterMapping mapping(alloc);
+  mapping.sources.resize(nrOfCells);
+  std::iota(mapping.sources.begin(), mapping.sources.end(), 0);
+  mapping.cellToSources.resize(nrOfCells);
+  for (unsigned cell = 0; cell < nrOfCells; ++cell) {
+    mapping.cellToSources[cell].dofs = &dofs[cell];
+    mapping.cellToSources[cell].pointSourcesOffset = cell;
+    mapping.cellToSources[cell].numberOfPointSources = 1;
+  }
+
+  m_pointSourceCluster = std::make_unique<seissol::kernels::PointSourceClusterOnHost>(std::move(mapping), std::move(sources));
+  m_pointSourceTime = 0.0;
+}
+
 #ifdef ACL_DEVICE
 void initDataStructuresOnDevice(bool enableDynamicRupture) {
   seissol::initializer::TimeCluster& cluster = m_ltsTree->child(0);
@@ -53,3 +53,54 @@ double noestimate(unsigned) {
   return 0.0;
 }
 
+double bytes_friction(unsigned int i_timesteps) {
+  // the variables which are only needed for the flux computation are not touched by the friction law
+  const std::unordered_set<unsigned> unusedVariables = {
+    m_frictionLts->timeDerivativePlus.index,
+    m_frictionLts->timeDerivativeMinus.index,
+    m_frictionLts->godunovData.index,
+    m_frictionLts->fluxSolverPlus.index,
+    m_frictionLts->fluxSolverMinus.index,
+    m_frictionLts->faceInformation.index,
+    m_frictionLts->waveSpeedsPlus.index,
+    m_frictionLts->waveSpeedsMinus.index,
+    m_frictionLts->drEnergyOutput.index,
+    m_frictionLts->impedanceMatrices.index
+  };
+
+  double bytes = 0.0;
+  for (unsigned var = 0; var < m_dynRupTree->getNumberOfVariables(); ++var) {
+    if (unusedVariables.count(var) == 0) {
+      bytes += static_cast<double>(m_dynRupTree->info(var).bytes);
+    }
+  }
+  double faces = static_cast<double>(m_dynRupTree->child(0).child<Interior>().getNumberOfCells());
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return faces * timesteps * bytes;
+}
+
+double bytes_plasticity(unsigned int i_timesteps) {
+  unsigned nrOfCells = m_ltsTree->child(0).child<Interior>().getNumberOfCells();
+
+  // the elastic check reads the material and the stress modes, the yielding cells update dofs and plastic strain
+  double bytesCheck = static_cast<double>(sizeof(PlasticityData) + tensor::QStress::size() * sizeof(real));
+  double bytesYield = static_cast<double>(2 * (tensor::Q::size() + tensor::QStress::size() + tensor::QEtaModal::size()) * sizeof(real));
+  double elems = static_cast<double>(nrOfCells);
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return elems * timesteps * bytesCheck + static_cast<double>(m_plasticityCandidates) * bytesYield;
+}
+
+double bytes_pointsources(unsigned int i_timesteps) {
+  // per source: dofs (read and write), basis functions, stiffness tensor, fault basis, area, the
+  // samples overlapping with one time step, onset time and sampling interval, sample offsets
+  const unsigned samplesPerStep = static_cast<unsigned>(std::ceil(ProxyPointSourceTimeStep / ProxySamplingInterval)) + 1;
+  double bytes = static_cast<double>((2 * tensor::Q::size() + tensor::mInvJInvPhisAtSources::size() + 81
+                                      + seissol::sourceterm::PointSources::TensorSize + 1 + 3 * samplesPerStep) * sizeof(real)
+                                     + 2 * sizeof(double) + 6 * sizeof(std::size_t));
+  double sources = static_cast<double>(m_pointSourceCluster->size());
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return sources * timesteps * bytes;
+}
@@ -148,4 +148,55 @@ seissol_flops flops_all_actual(unsigned int i_timesteps) {
   return ret;
 }
 
+seissol_flops flops_friction_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+
+  // The friction laws are hand-written and not counted by SeisSol. We estimate the elastic
+  // pre- and post-processing of the fault stresses, i.e. the computation of the normal and shear
+  // stresses (18 flops) and of the imposed state (42 flops) per point and time index. The friction
+  // law itself is not counted, such that the GFLOPS are a lower bound.
+  constexpr long long FlopsPerPoint = 18 + 42;
+  unsigned nrOfFaces = m_dynRupTree->child(0).child<Interior>().getNumberOfCells();
+  ret.d_nonZeroFlops  = FlopsPerPoint * CONVERGENCE_ORDER * seissol::dr::misc::numberOfBoundaryGaussPoints;
+  ret.d_hardwareFlops = FlopsPerPoint * CONVERGENCE_ORDER * seissol::dr::misc::numPaddedPoints;
+
+  ret.d_nonZeroFlops *= static_cast<long long>(nrOfFaces) * i_timesteps;
+  ret.d_hardwareFlops *= static_cast<long long>(nrOfFaces) * i_timesteps;
+
+  return ret;
+}
+
+seissol_flops flops_plasticity_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+
+  long long nonZeroFlopsCheck, hardwareFlopsCheck, nonZeroFlopsYield, hardwareFlopsYield;
+  long long nonZeroFlopsElastic, hardwareFlopsElastic;
+  seissol::kernels::Plasticity::flopsPlasticity(nonZeroFlopsCheck, hardwareFlopsCheck, nonZeroFlopsYield, hardwareFlopsYield);
+  seissol::kernels::Plasticity::flopsElasticCheck(nonZeroFlopsElastic, hardwareFlopsElastic);
+
+  // every cell is checked, the candidates and yielded cells were counted during the run
+  long long checkedCells = static_cast<long long>(m_ltsTree->child(0).child<Interior>().getNumberOfCells()) * i_timesteps;
+  ret.d_nonZeroFlops  = checkedCells * nonZeroFlopsElastic
+                      + m_plasticityCandidates * nonZeroFlopsCheck
+                      + m_plasticityYielded * nonZeroFlopsYield;
+  ret.d_hardwareFlops = checkedCells * hardwareFlopsElastic
+                      + m_plasticityCandidates * hardwareFlopsCheck
+                      + m_plasticityYielded * hardwareFlopsYield;
 
+  return ret;
+}
+
+seissol_flops flops_pointsources_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+
+  // rotation of the slip into the cartesian basis
+  constexpr long long RotationFlops = 18;
+  long long nrOfSources = m_pointSourceCluster->size();
+  ret.d_nonZeroFlops  = seissol::kernel::sourceNRF::NonZeroFlops + RotationFlops;
+  ret.d_hardwareFlops = seissol::kernel::sourceNRF::HardwareFlops + RotationFlops;
+
+  ret.d_nonZeroFlops *= nrOfSources * i_timesteps;
+  ret.d_hardwareFlops *= nrOfSources * i_timesteps;
+
+  return ret;
+}
@@ -27,6 +27,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "generated_code/tensor.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace tensor = seissol::tensor;
 namespace kernels = seissol::kernels;
 
@@ -37,6 +40,7 @@ void registerMarkers() {
         LIKWID_MARKER_REGISTER("localwoader");
         LIKWID_MARKER_REGISTER("local");
         LIKWID_MARKER_REGISTER("neighboring");
+        LIKWID_MARKER_REGISTER("plasticity");
     }
 }
 
@@ -107,6 +111,9 @@ namespace proxy::cpu {
     unsigned              nrOfCells       = layer.getNumberOfCells();
     real**                buffers                       = layer.var(m_lts.buffers);
     real**                derivatives                   = layer.var(m_lts.derivatives);
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    float**               compressedBuffers             = layer.var(m_lts.compressedBuffers);
+#endif
 
     kernels::LocalData::Loader loader;
     loader.load(m_lts, layer);
@@ -120,18 +127,28 @@ namespace proxy::cpu {
   #endif
     for( unsigned int l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
       auto data = loader.entry(l_cell);
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+      // the buffer is computed in full precision and stored in single precision
+      alignas(ALIGNMENT) real integrationBuffer[tensor::I::size()];
+      real* buffer = integrationBuffer;
+#else
+      real* buffer = buffers[l_cell];
+#endif
       m_timeKernel.computeAder(      (double)seissol::miniSeisSolTimeStep,
                                              data,
                                              tmp,
-                                             buffers[l_cell],
+                                             buffer,
                                              derivatives[l_cell] );
-      m_localKernel.computeIntegral(buffers[l_cell],
+      m_localKernel.computeIntegral(buffer,
                                     data,
                                     tmp,
                                     nullptr,
                                     nullptr,
                                     0,
                                     0);
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+      std::copy_n(integrationBuffer, tensor::I::size(), compressedBuffers[l_cell]);
+#endif
     }
   #ifdef _OPENMP
     LIKWID_MARKER_STOP("local");
@@ -145,6 +162,9 @@ namespace proxy::cpu {
     real*                     (*faceNeighbors)[4]             = layer.var(m_lts.faceNeighbors);
     CellDRMapping             (*drMapping)[4]                 = layer.var(m_lts.drMapping);
     CellLocalInformation*       cellInformation               = layer.var(m_lts.cellInformation);
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    float*                    (*compressedFaceNeighbors)[4]   = layer.var(m_lts.compressedFaceNeighbors);
+#endif
 
     kernels::NeighborData::Loader loader;
     loader.load(m_lts, layer);
@@ -173,6 +193,16 @@ namespace proxy::cpu {
   #endif
                                                       l_timeIntegrated );
 
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+      alignas(ALIGNMENT) real neighborTimeIntegrated[4][tensor::I::size()];
+      for (unsigned face = 0; face < 4; ++face) {
+        if (compressedFaceNeighbors[l_cell][face] != nullptr) {
+          std::copy_n(compressedFaceNeighbors[l_cell][face], tensor::I::size(), neighborTimeIntegrated[face]);
+          l_timeIntegrated[face] = neighborTimeIntegrated[face];
+        }
+      }
+#endif
+
       l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture)
           ? faceNeighbors[l_cell][1] : drMapping[l_cell][1].godunov;
       l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture)
@@ -228,4 +258,57 @@ namespace proxy::cpu {
                                               timeDerivativeMinus[prefetchFace] );
     }
   }
+  void computeFrictionLaw() {
+    seissol::initializer::Layer& layerData = m_dynRupTree->child(0).child<Interior>();
+    m_frictionSolver->computeDeltaT(m_dynRupKernel.timePoints);
+    m_frictionSolver->evaluate(layerData, m_frictionLts.get(), m_faultTime, m_dynRupKernel.timeWeights);
+    m_faultTime += ProxyFaultTimeStep;
+  }
+
+  void computePlasticity() {
+    auto&           layer       = m_ltsTree->child(0).child<Interior>();
+    unsigned        nrOfCells   = layer.getNumberOfCells();
+    real          (*dofs)[tensor::Q::size()] = layer.var(m_lts.dofs);
+    PlasticityData* plasticity  = layer.var(m_lts.plasticity);
+    real          (*pstrain)[tensor::QStress::size() + tensor::QEtaModal::size()] = layer.var(m_lts.pstrain);
+
+    const double oneMinusIntegratingFactor = 1.0 - std::exp(-ProxyPlasticityTimeStep / ProxyPlasticityRelaxationTime);
+    long long candidates = 0;
+    long long yielded = 0;
+
+  #ifdef _OPENMP
+    #pragma omp parallel reduction(+:candidates,yielded)
+    {
+    LIKWID_MARKER_START("plasticity");
+    #pragma omp for schedule(static)
+  #endif
+    for (unsigned l_cell = 0; l_cell < nrOfCells; l_cell++) {
+      if (!seissol::kernels::Plasticity::isElastic(&plasticity[l_cell], dofs[l_cell])) {
+        ++candidates;
+        yielded += seissol::kernels::Plasticity::computePlasticity( oneMinusIntegratingFactor,
+                                                                    ProxyPlasticityTimeStep,
+                                                                    ProxyPlasticityRelaxationTime,
+                                                                    &m_globalDataOnHost,
+                                                                    &plasticity[l_cell],
+                                                                    dofs[l_cell],
+                                                                    pstrain[l_cell] );
+      }
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("plasticity");
+    }
+  #endif
+    m_plasticityCandidates += candidates;
+    m_plasticityYielded += yielded;
+  }
+
+  void computePointSources() {
+    // restart the source time functions once all samples have been integrated
+    const double duration = (ProxySamplesPerSource - 1) * ProxySamplingInterval;
+    if (m_pointSourceTime + ProxyPointSourceTimeStep > duration) {
+      m_pointSourceTime = 0.0;
+    }
+    m_pointSourceCluster->addTimeIntegratedPointSources(m_pointSourceTime, m_pointSourceTime + ProxyPointSourceTimeStep);
+    m_pointSourceTime += ProxyPointSourceTimeStep;
+  }
 } // namespace proxy::cpu
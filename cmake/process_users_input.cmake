@@ -68,6 +68,11 @@ set_property(CACHE DR_QUAD_RULE PROPERTY STRINGS ${DR_QUAD_RULE_OPTIONS})
 set(NUMBER_OF_FUSED_SIMULATIONS 1 CACHE STRING "A number of fused simulations")
 
 
+set(VECTOR_MATH_LIBRARY "auto" CACHE STRING "Vector math library for exp, log and asinh in the friction laws")
+set(VECTOR_MATH_LIBRARY_OPTIONS auto none libmvec svml)
+set_property(CACHE VECTOR_MATH_LIBRARY PROPERTY STRINGS ${VECTOR_MATH_LIBRARY_OPTIONS})
+
+
 set(MEMORY_LAYOUT "auto" CACHE FILEPATH "A file with a specific memory layout or auto")
 
 option(NUMA_AWARE_PINNING "Use libnuma to pin threads to correct NUMA nodes" ON)
@@ -112,6 +117,7 @@ check_parameter("PRECISION" ${PRECISION} "${PRECISION_OPTIONS}")
 check_parameter("PLASTICITY_METHOD" ${PLASTICITY_METHOD} "${PLASTICITY_OPTIONS}")
 check_parameter("LOG_LEVEL" ${LOG_LEVEL} "${LOG_LEVEL_OPTIONS}")
 check_parameter("LOG_LEVEL_MASTER" ${LOG_LEVEL_MASTER} "${LOG_LEVEL_MASTER_OPTIONS}")
+check_parameter("VECTOR_MATH_LIBRARY" ${VECTOR_MATH_LIBRARY} "${VECTOR_MATH_LIBRARY_OPTIONS}")
 
 # deduce GEMM_TOOLS_LIST based on the host arch
 if (GEMM_TOOLS_LIST STREQUAL "auto")
@@ -190,6 +196,16 @@ if (WITH_GPU)
     option(PREMULTIPLY_FLUX "Merge device flux matrices (recommended for AMD and Nvidia GPUs)" ${PREMULTIPLY_FLUX_DEFAULT})
 endif()
 
+option(COMPACT_INTEGRATION_DATA "Compute star matrices and flux solvers on the fly instead of storing them per cell" OFF)
+if (COMPACT_INTEGRATION_DATA AND (WITH_GPU OR NOT "${EQUATIONS}" STREQUAL "elastic"))
+    message(FATAL_ERROR "COMPACT_INTEGRATION_DATA is only supported for elastic CPU builds.")
+endif()
+
+option(SINGLE_PRECISION_BUFFERS "Store the time integrated DOFs of the interior cells in single precision" OFF)
+if (SINGLE_PRECISION_BUFFERS AND (WITH_GPU OR NOT "${EQUATIONS}" STREQUAL "elastic" OR NOT "${PRECISION}" STREQUAL "double"))
+    message(FATAL_ERROR "SINGLE_PRECISION_BUFFERS is only supported for elastic double precision CPU builds.")
+endif()
+
 
 # check compute sub architecture (relevant only for GPU)
 if (NOT ${DEVICE_ARCH} STREQUAL "none")
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+##
+# @file
+# This file is part of SeisSol.
+#
+# @section LICENSE
+# Copyright (c) 2024, SeisSol Group
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Kernels for the face-restricted exchange of time buffers and derivatives between ranks.
+#
+# A neighbouring rank only needs the trace of a ghost cell on the shared face(s).
+# The trace of a polynomial of degree p is fully described by its coefficients w.r.t. the face
+# basis of degree p, which are given by rT. Hence, we send rT * I instead of I and reconstruct
+# a volume polynomial with the same trace on the receiving side by a right inverse L of rT
+# (i.e. rT * L = Id). As the bases are hierarchical, the same holds for every derivative with the
+# upper-left blocks of rT.
+#
+
+import numpy as np
+from yateto import Tensor, simpleParameterSpace
+from multSim import OptionalDimTensor
+
+
+def addKernels(generator, aderdg):
+  order = aderdg.order
+  numberOf2DBasisFunctions = aderdg.numberOf2DBasisFunctions()
+  numberOf3DBasisFunctions = aderdg.numberOf3DBasisFunctions()
+  faceShape = (numberOf2DBasisFunctions, aderdg.numberOfQuantities())
+
+  def faceSpp(numberOfRows):
+    spp = np.zeros(faceShape, dtype=bool)
+    spp[:numberOfRows, :] = True
+    if aderdg.Q.hasOptDim():
+      spp = np.repeat(np.expand_dims(spp, aderdg.Q.optPos()), aderdg.Q.optSize(), axis=aderdg.Q.optPos())
+    return spp
+
+  faceI = OptionalDimTensor('faceI', aderdg.Q.optName(), aderdg.Q.optSize(), aderdg.Q.optPos(), faceShape, alignStride=True)
+  facedQ = [OptionalDimTensor('facedQ({})'.format(d),
+                              aderdg.Q.optName(),
+                              aderdg.Q.optSize(),
+                              aderdg.Q.optPos(),
+                              faceShape,
+                              spp=faceSpp((order-d)*(order-d+1)//2),
+                              alignStride=True) for d in range(order)]
+
+  projection = dict()
+  lift = dict()
+  for j in range(4):
+    rT = aderdg.db.rT[j].values_as_ndarray()
+    if aderdg.transpose('rT'):
+      rT = rT.T
+    for d in range(order):
+      numberOfFaceFunctions = (order-d)*(order-d+1)//2
+      numberOfVolumeFunctions = (order-d)*(order-d+1)*(order-d+2)//6
+      block = rT[:numberOfFaceFunctions, :numberOfVolumeFunctions]
+
+      projectionValues = np.zeros((numberOf2DBasisFunctions, numberOf3DBasisFunctions))
+      projectionValues[:numberOfFaceFunctions, :numberOfVolumeFunctions] = block
+      liftValues = np.zeros((numberOf3DBasisFunctions, numberOf2DBasisFunctions))
+      liftValues[:numberOfVolumeFunctions, :numberOfFaceFunctions] = block.T @ np.linalg.inv(block @ block.T)
+
+      projection[j,d] = Tensor('haloFaceProjection({},{})'.format(j, d), projectionValues.shape, spp=projectionValues)
+      lift[j,d] = Tensor('haloFaceLift({},{})'.format(j, d), liftValues.shape, spp=liftValues)
+
+  projectBufferToFace = lambda j: faceI['lq'] <= projection[j,0]['lk'] * aderdg.I['kq']
+  generator.addFamily('projectBufferToFace', simpleParameterSpace(4), projectBufferToFace)
+
+  liftBufferFromFace = lambda j: aderdg.I['kq'] <= lift[j,0]['kl'] * faceI['lq']
+  generator.addFamily('liftBufferFromFace', simpleParameterSpace(4), liftBufferFromFace)
+
+  projectDerivativesToFace = lambda j: [facedQ[d]['lq'] <= projection[j,d]['lk'] * aderdg.dQs[d]['kq'] for d in range(order)]
+  generator.addFamily('projectDerivativesToFace', simpleParameterSpace(4), projectDerivativesToFace)
+
+  liftDerivativesFromFace = lambda j: [aderdg.dQs[d]['kq'] <= lift[j,d]['kl'] * facedQ[d]['lq'] for d in range(order)]
+  generator.addFamily('liftDerivativesFromFace', simpleParameterSpace(4), liftDerivativesFromFace)
@@ -52,6 +52,7 @@ import DynamicRupture
 import Plasticity
 import SurfaceDisplacement
 import Point
+import HaloExchange
 import NodalBoundaryConditions
 import memlayout
 
@@ -146,6 +147,7 @@ Plasticity.addKernels(generator,
 NodalBoundaryConditions.addKernels(generator, adg, include_tensors, cmdLineArgs.matricesDir, cmdLineArgs, targets)
 SurfaceDisplacement.addKernels(generator, adg, include_tensors, targets)
 Point.addKernels(generator, adg)
+HaloExchange.addKernels(generator, adg)
 
 # pick up the user's defined gemm tools
 gemm_tool_list = cmdLineArgs.gemm_tools.replace(" ", "").split(",")
@@ -48,6 +48,8 @@
 #include "mpio/WavefieldAsync.h"
 #include "mpio/Fault.h"
 #include "mpio/FaultAsync.h"
+#include "mpio/WavefieldGlobal.h"
+#include "mpio/FaultGlobal.h"
 #include "Initializer/Parameters/OutputParameters.h"
 #ifdef USE_SIONLIB
 #include "sionlib/Fault.h"
@@ -73,6 +75,10 @@ void seissol::checkpoint::createBackend(seissol::initializer::parameters::Checkp
       waveField = new mpio::WavefieldAsync();
       fault = new mpio::FaultAsync();
       break;
+    case seissol::initializer::parameters::CheckpointingBackend::MPIO_GLOBAL:
+      waveField = new mpio::WavefieldGlobal();
+      fault = new mpio::FaultGlobal();
+      break;
     case seissol::initializer::parameters::CheckpointingBackend::SIONLIB:
 #ifdef USE_SIONLIB
       waveField = new sionlib::Wavefield();
@@ -65,6 +65,10 @@ namespace checkpoint
  */
 class CheckPoint
 {
+public:
+	/** Marks cells and fault sides without a global identifier */
+	static constexpr unsigned long INVALID_ID = ~0ul;
+
 private:
 	/** Checkpoint identifier (written to the beginning of the file) */
 	const unsigned long m_identifier;
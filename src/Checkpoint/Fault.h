@@ -45,6 +45,7 @@
 
 #include <cassert>
 #include <string>
+#include <vector>
 
 #include "CheckPoint.h"
 #include "Kernels/precision.hpp"
@@ -73,6 +74,9 @@ private:
 	/** Number of boundary points per side */
 	unsigned int m_numBndGP;
 
+	/** Global identifiers of the plus and the minus side of each fault side */
+	std::vector<unsigned long> m_sideIds;
+
 public:
 	Fault(unsigned long identifier)
 		: CheckPoint(identifier),
@@ -81,6 +85,18 @@ public:
 
 	virtual ~Fault() {}
 
+	/**
+	 * Set the global identifiers of the fault sides.
+	 *
+	 * Each side has two identifiers: the identifier of its plus and of its minus side.
+	 * The identifier of a side which is not on this rank is INVALID_ID.
+	 * Only required by back-ends which store the sides independently of the partitioning.
+	 */
+	void setSideIds(const unsigned long* sideIds, unsigned int numSides)
+	{
+		m_sideIds.assign(sideIds, sideIds + 2 * static_cast<unsigned long>(numSides));
+	}
+
 	/**
 	 * @return True of a valid checkpoint is available
 	 */
@@ -210,6 +226,11 @@ protected:
 		return m_numBndGP;
 	}
 
+	const std::vector<unsigned long>& sideIds() const
+	{
+		return m_sideIds;
+	}
+
 	/** Names of the different variables we need to store */
 	static const char* VAR_NAMES[NUM_VARIABLES];
 };
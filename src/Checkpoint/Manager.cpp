@@ -90,12 +90,21 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		addBuffer(state, m_numDRDofs * sizeof(real));
 		addBuffer(strength, m_numDRDofs * sizeof(real));
 
+		// Buffers for the global identifiers
+		id = addSyncBuffer(m_cellIds.data(), m_cellIds.size() * sizeof(unsigned long));
+		assert(id == CELL_IDS);
+		id = addSyncBuffer(m_sideIds.data(), m_sideIds.size() * sizeof(unsigned long));
+		assert(id == SIDE_IDS);
+
 		//
 		// Initialization for loading checkpoints
 		//
 		waveField->setFilename(m_filename.c_str());
 		fault->setFilename(m_filename.c_str());
 
+		waveField->setCellIds(m_cellIds.data(), m_cellIds.size());
+		fault->setSideIds(m_sideIds.data(), m_sideIds.size() / 2);
+
 		int exists = waveField->init(m_header.size(), numDofs, seissolInstance.asyncIO().groupSize());
 		exists &= fault->init(numSides, numBndGP,
 			seissolInstance.asyncIO().groupSize());
@@ -123,6 +132,8 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		delete fault;
 
 		sendBuffer(FILENAME,  m_filename.size()+1);
+		sendBuffer(CELL_IDS, m_cellIds.size() * sizeof(unsigned long));
+		sendBuffer(SIDE_IDS, m_sideIds.size() * sizeof(unsigned long));
 
 		// Initialize the executor
 		CheckpointInitParam param;
@@ -132,6 +143,12 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		callInit(param);
 
 		removeBuffer(FILENAME);
+		removeBuffer(CELL_IDS);
+		removeBuffer(SIDE_IDS);
+
+		// The identifiers are not required anymore
+		std::vector<unsigned long>().swap(m_cellIds);
+		std::vector<unsigned long>().swap(m_sideIds);
 
 		return exists;
 }
@@ -48,6 +48,7 @@
 #include <cassert>
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include "utils/logger.h"
 
@@ -86,6 +87,12 @@ private:
 	/** Number of DR DOFs */
 	unsigned int m_numDRDofs;
 
+	/** Global identifiers of the cells */
+	std::vector<unsigned long> m_cellIds;
+
+	/** Global identifiers of the plus and minus sides of the fault sides */
+	std::vector<unsigned long> m_sideIds;
+
 	/** Checkpoint header */
 	WavefieldHeader m_header;
 
@@ -115,6 +122,17 @@ public:
 		m_filename = filename;
 	}
 
+	/**
+	 * Set the global identifiers of the cells and fault sides
+	 *
+	 * @see Wavefield::setCellIds
+	 * @see Fault::setSideIds
+	 */
+	void setGlobalIds(const std::vector<unsigned long> &cellIds, const std::vector<unsigned long> &sideIds)
+	{
+		m_cellIds = cellIds;
+		m_sideIds = sideIds;
+	}
 
 	/**
 	 * This is called on all ranks
@@ -53,7 +53,9 @@ enum BufferTags {
 	FILENAME = 0,
 	HEADER = 1,
 	DOFS = 2,
-	DR_DOFS0 = 3
+	DR_DOFS0 = 3,
+	CELL_IDS = DR_DOFS0 + 8,
+	SIDE_IDS = CELL_IDS + 1
 };
 
 /**
@@ -108,6 +110,11 @@ public:
 		m_waveField->setFilename(filename);
 		m_fault->setFilename(filename);
 
+		m_waveField->setCellIds(static_cast<const unsigned long*>(info.buffer(CELL_IDS)),
+			info.bufferSize(CELL_IDS) / sizeof(unsigned long));
+		m_fault->setSideIds(static_cast<const unsigned long*>(info.buffer(SIDE_IDS)),
+			info.bufferSize(SIDE_IDS) / sizeof(unsigned long) / 2);
+
 		m_waveField->init(info.bufferSize(HEADER), info.bufferSize(DOFS) / sizeof(real));
 		m_fault->init(info.bufferSize(DR_DOFS0) / param.numBndGP / sizeof(real), param.numBndGP);
 
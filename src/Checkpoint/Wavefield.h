@@ -44,6 +44,7 @@
 #include "Parallel/MPI.h"
 
 #include <cassert>
+#include <vector>
 
 #include "utils/env.h"
 #include "utils/logger.h"
@@ -84,6 +85,9 @@ private:
 	/** Number of cells that can be saved in one iteration (due to the 2GB limit) */
 	const unsigned int m_dofsPerIteration;
 
+	/** Global identifiers of the cells in the dofs buffer */
+	std::vector<unsigned long> m_cellIds;
+
 public:
 	Wavefield(unsigned long identifier)
 		: CheckPoint(identifier),
@@ -108,6 +112,18 @@ public:
 		m_header = &header;
 	}
 
+	/**
+	 * Set the global identifiers of the cells (one for each cell in the dofs buffer).
+	 *
+	 * Cells with the same identifier are duplicates of each other;
+	 * cells with the identifier INVALID_ID are ignored.
+	 * Only required by back-ends which store the cells independently of the partitioning.
+	 */
+	void setCellIds(const unsigned long* cellIds, unsigned long numCells)
+	{
+		m_cellIds.assign(cellIds, cellIds + numCells);
+	}
+
 	/**
 	 * Initialize checkpointing
 	 *
@@ -254,6 +270,11 @@ protected:
 	{
 		return m_dofsPerIteration;
 	}
+
+	const std::vector<unsigned long>& cellIds() const
+	{
+		return m_cellIds;
+	}
 };
 
 }
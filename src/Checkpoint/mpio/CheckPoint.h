@@ -44,6 +44,7 @@
 #include <mpi.h>
 
 #include <cassert>
+#include <vector>
 
 #include "utils/env.h"
 
@@ -107,12 +108,9 @@ public:
 			m_open = false;
 		}
 
-		if (m_headerType != MPI_DATATYPE_NULL) {
+		if (m_headerType != MPI_DATATYPE_NULL)
 			MPI_Type_free(&m_headerType);
-			MPI_Type_free(&m_fileDataType);
-			if (rank() == 0)
-				MPI_Type_free(&m_fileHeaderType);
-		}
+		freeFileView();
 	}
 
 protected:
@@ -142,12 +140,7 @@ protected:
 		if (size != static_cast<MPI_Aint>(headerSize))
 			logError() << "Size of C struct and MPI data type do not match.";
 
-		unsigned long align = utils::Env::get<unsigned long>("SEISSOL_CHECKPOINT_ALIGNMENT", 0);
-		if (align > 0) {
-			unsigned int blocks = (headerSize + align - 1) / align;
-			m_headerSize = blocks * align;
-		} else
-			m_headerSize = headerSize;
+		m_headerSize = alignHeaderSize(headerSize);
 
 		// Create element type
 		MPI_Datatype elemType;
@@ -196,6 +189,85 @@ protected:
 			m_fileHeaderType = m_fileDataType;
 	}
 
+	/**
+	 * Create the file view for elements stored at arbitrary positions in the file
+	 *
+	 * The data of the elements starts after the (aligned) header and additional
+	 * <code>dataOffset</code> bytes. For each variable, the file contains <code>numTotalElem</code>
+	 * elements.
+	 *
+	 * @param headerSize The size of the header in bytes
+	 * @param dataOffset Number of bytes between the header and the data
+	 * @param elemSize The element size in bytes
+	 * @param positions The sorted positions of the local elements in the file
+	 * @param numTotalElem The number of elements in the file (per variable)
+	 */
+	void defineIndexedFileView(unsigned long headerSize, unsigned long dataOffset, unsigned int elemSize,
+		const std::vector<unsigned long> &positions, unsigned long numTotalElem, unsigned int numVars = 1)
+	{
+		// Check header size
+		MPI_Aint lb, size;
+		MPI_Type_get_extent(m_headerType, &lb, &size);
+		if (size != static_cast<MPI_Aint>(headerSize))
+			logError() << "Size of C struct and MPI data type do not match.";
+
+		// The view may be redefined (e.g. for reading and writing)
+		freeFileView();
+
+		m_headerSize = alignHeaderSize(headerSize);
+
+		// Create element type
+		MPI_Datatype elemType;
+		MPI_Type_contiguous(elemSize, MPI_BYTE, &elemType);
+
+		// Merge consecutive elements into blocks
+		const unsigned long MAX_INT = 1ul<<30;
+		std::vector<int> blockLength;
+		std::vector<MPI_Aint> displ;
+		for (unsigned int i = 0; i < numVars; i++) {
+			const unsigned long offset = m_headerSize + dataOffset + i * numTotalElem * elemSize;
+			for (unsigned long j = 0; j < positions.size(); j++) {
+				assert(j == 0 || positions[j-1] < positions[j]);
+
+				if (j > 0 && positions[j-1]+1 == positions[j]
+						&& static_cast<unsigned long>(blockLength.back()) < MAX_INT) {
+					blockLength.back()++;
+				} else {
+					blockLength.push_back(1);
+					displ.push_back(offset + positions[j] * elemSize);
+				}
+			}
+		}
+
+		MPI_Type_create_hindexed(blockLength.size(), blockLength.data(), displ.data(), elemType, &m_fileDataType);
+		MPI_Type_commit(&m_fileDataType);
+
+		MPI_Type_free(&elemType);
+
+		// Create the header file type
+		if (rank() == 0) {
+			MPI_Type_contiguous(headerSize, MPI_BYTE, &m_fileHeaderType);
+
+			MPI_Type_commit(&m_fileHeaderType);
+		} else
+			// Only first rank write the header
+			m_fileHeaderType = m_fileDataType;
+	}
+
+	/**
+	 * @return The size of the header including the padding for the alignment
+	 */
+	static unsigned long alignHeaderSize(unsigned long headerSize)
+	{
+		unsigned long align = utils::Env::get<unsigned long>("SEISSOL_CHECKPOINT_ALIGNMENT", 0);
+		if (align > 0) {
+			unsigned int blocks = (headerSize + align - 1) / align;
+			return blocks * align;
+		}
+
+		return headerSize;
+	}
+
 	bool exists()
 	{
 		if (!seissol::checkpoint::CheckPoint::exists())
@@ -313,6 +385,18 @@ protected:
 	 */
 	virtual bool validate(MPI_File file) = 0;
 
+private:
+	void freeFileView()
+	{
+		if (m_fileDataType == MPI_DATATYPE_NULL)
+			return;
+
+		if (m_fileHeaderType != m_fileDataType)
+			MPI_Type_free(&m_fileHeaderType);
+		MPI_Type_free(&m_fileDataType);
+		m_fileHeaderType = MPI_DATATYPE_NULL;
+	}
+
 protected:
 	static void checkMPIErr(int ret)
 	{
@@ -0,0 +1,253 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include "FaultGlobal.h"
+
+bool seissol::checkpoint::mpio::FaultGlobal::init(unsigned int numSides, unsigned int numBndGP,
+		unsigned int groupSize)
+{
+	seissol::checkpoint::Fault::init(numSides, numBndGP, groupSize);
+
+	if (numSides == 0)
+		return true;
+
+	if (sideIds().size() != 2ul * numSides)
+		logError() << "The checkpoint back-end requires the global identifiers of the fault sides";
+
+	// Create the header data type
+	MPI_Datatype headerType;
+	int blockLength[] = {1, 1, 1, 1};
+	MPI_Aint displ[] = {offsetof(Header, identifier), offsetof(Header, timestepFault),
+		offsetof(Header, numBndGP), offsetof(Header, numRecords)};
+	MPI_Datatype types[] = {MPI_UNSIGNED_LONG, MPI_INT, MPI_UNSIGNED, MPI_UNSIGNED_LONG};
+	MPI_Type_create_struct(4, blockLength, displ, types, &headerType);
+	setHeaderType(headerType);
+
+	return exists();
+}
+
+void seissol::checkpoint::mpio::FaultGlobal::load(int &timestepFault, real* mu, real* slipRate1, real* slipRate2,
+	real* slip, real* slip1, real* slip2, real* state, real* strength)
+{
+	if (numSides() == 0)
+		return;
+
+	logInfo(rank()) << "Loading fault checkpoint";
+
+	seissol::checkpoint::CheckPoint::setLoaded();
+
+	MPI_File file = open();
+	if (file == MPI_FILE_NULL)
+		logError() << "Could not open fault checkpoint file";
+
+	// Read and broadcast header and identifiers
+	Header header;
+	if (rank() == 0)
+		checkMPIErr(MPI_File_read(file, &header, 1, headerType(), MPI_STATUS_IGNORE));
+
+	MPI_Bcast(&header, 1, headerType(), 0, comm());
+	timestepFault = header.timestepFault;
+
+	std::vector<unsigned long> allIds(header.numRecords);
+	if (rank() == 0)
+		checkMPIErr(MPI_File_read_at(file, alignHeaderSize(sizeof(Header)), allIds.data(),
+			header.numRecords, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE));
+
+	MPI_Bcast(allIds.data(), header.numRecords, MPI_UNSIGNED_LONG, 0, comm());
+
+	// Find the record for each side
+	std::vector<std::pair<unsigned long, unsigned int>> records;
+	records.reserve(numSides());
+	for (unsigned int i = 0; i < numSides(); i++) {
+		unsigned long id = sideIds()[2*i];
+		if (id == INVALID_ID)
+			id = sideIds()[2*i+1];
+
+		std::vector<unsigned long>::const_iterator record = std::lower_bound(allIds.begin(), allIds.end(), id);
+		if (record == allIds.end() || *record != id)
+			logError() << "Fault side" << id << "not found in the checkpoint";
+
+		records.push_back(std::make_pair(record - allIds.begin(), i));
+	}
+	std::sort(records.begin(), records.end());
+
+	std::vector<unsigned long> positions(records.size());
+	for (unsigned int i = 0; i < records.size(); i++)
+		positions[i] = records[i].first;
+
+	defineIndexedFileView(sizeof(Header), header.numRecords * sizeof(unsigned long), numBndGP() * sizeof(real),
+		positions, header.numRecords, NUM_VARIABLES);
+
+	// Read data
+	const unsigned long numDofs = numSides() * numBndGP();
+	std::vector<real> buffer(NUM_VARIABLES * numDofs);
+
+	checkMPIErr(setDataView(file));
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+		checkMPIErr(MPI_File_read_all(file, &buffer[i * numDofs], numDofs, MPI_C_REAL, MPI_STATUS_IGNORE));
+
+	// Close the file
+	checkMPIErr(MPI_File_close(&file));
+
+	// Copy the data to the sides
+	real* data[NUM_VARIABLES] = {mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength};
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++) {
+		if (data[i] == 0L)
+			continue;
+
+		for (unsigned int j = 0; j < records.size(); j++)
+			memcpy(&data[i][records[j].second * numBndGP()], &buffer[i * numDofs + j * numBndGP()],
+				numBndGP() * sizeof(real));
+	}
+}
+
+void seissol::checkpoint::mpio::FaultGlobal::initLate(const real* mu, const real* slipRate1, const real* slipRate2,
+	const real* slip, const real* slip1, const real* slip2, const real* state, const real* strength)
+{
+	seissol::checkpoint::Fault::initLate(mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength);
+
+	if (numSides() == 0)
+		return;
+
+	// Each side is stored for all its local identifiers
+	std::vector<std::pair<unsigned long, unsigned int>> records;
+	for (unsigned int i = 0; i < numSides(); i++) {
+		for (unsigned int j = 0; j < 2; j++) {
+			if (sideIds()[2*i+j] != INVALID_ID)
+				records.push_back(std::make_pair(sideIds()[2*i+j], i));
+		}
+	}
+	std::sort(records.begin(), records.end());
+
+	// Collect the identifiers of all ranks
+	std::vector<unsigned long> localIds(records.size());
+	for (unsigned int i = 0; i < records.size(); i++)
+		localIds[i] = records[i].first;
+
+	int numLocalIds = localIds.size();
+	std::vector<int> numIds(partitions());
+	MPI_Allgather(&numLocalIds, 1, MPI_INT, numIds.data(), 1, MPI_INT, comm());
+
+	std::vector<int> idOffsets(partitions());
+	unsigned long numAllIds = 0;
+	for (int i = 0; i < partitions(); i++) {
+		idOffsets[i] = numAllIds;
+		numAllIds += numIds[i];
+	}
+
+	std::vector<unsigned long> allIds(numAllIds);
+	MPI_Allgatherv(localIds.data(), numLocalIds, MPI_UNSIGNED_LONG,
+		allIds.data(), numIds.data(), idOffsets.data(), MPI_UNSIGNED_LONG, comm());
+	std::sort(allIds.begin(), allIds.end());
+	allIds.erase(std::unique(allIds.begin(), allIds.end()), allIds.end());
+	m_numRecords = allIds.size();
+
+	// Compute the position of the local records
+	std::vector<unsigned long> positions(records.size());
+	m_records.resize(records.size());
+	for (unsigned int i = 0; i < records.size(); i++) {
+		positions[i] = std::lower_bound(allIds.begin(), allIds.end(), records[i].first) - allIds.begin();
+		m_records[i] = records[i].second;
+	}
+	m_dataCopy.resize(NUM_VARIABLES * m_records.size() * numBndGP());
+
+	// Only the first rank writes the identifiers
+	if (rank() == 0)
+		m_allIds.swap(allIds);
+
+	defineIndexedFileView(sizeof(Header), m_numRecords * sizeof(unsigned long), numBndGP() * sizeof(real),
+		positions, m_numRecords, NUM_VARIABLES);
+}
+
+void seissol::checkpoint::mpio::FaultGlobal::write(int timestepFault)
+{
+	EPIK_TRACER("CheckPointFault_write");
+	SCOREP_USER_REGION("CheckPointFault_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	if (numSides() == 0)
+		return;
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault.";
+
+	// Write the header
+	writeHeader(timestepFault);
+
+	// Copy the data in the order of the file
+	const unsigned long numDofs = m_records.size() * numBndGP();
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++) {
+		for (unsigned int j = 0; j < m_records.size(); j++)
+			memcpy(&m_dataCopy[i * numDofs + j * numBndGP()], &data(i)[m_records[j] * numBndGP()],
+				numBndGP() * sizeof(real));
+	}
+
+	// Save data
+	EPIK_USER_REG(r_write_wavefield, "checkpoint_write_fault");
+	SCOREP_USER_REGION_DEFINE(r_write_fault);
+	EPIK_USER_START(r_write_wavefield);
+	SCOREP_USER_REGION_BEGIN(r_write_fault, "checkpoint_write_fault", SCOREP_USER_REGION_TYPE_COMMON);
+
+	checkMPIErr(setDataView(file()));
+
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+		checkMPIErr(MPI_File_write_all(file(), &m_dataCopy[i * numDofs], numDofs, MPI_C_REAL, MPI_STATUS_IGNORE));
+
+	EPIK_USER_END(r_write_fault);
+	SCOREP_USER_REGION_END(r_write_fault);
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault. Done.";
+}
+
+bool seissol::checkpoint::mpio::FaultGlobal::validate(MPI_File file)
+{
+	int result = true;
+
+	if (rank() == 0) {
+		Header header;
+
+		// Check the header
+		MPI_File_read(file, &header, 1, headerType(), MPI_STATUS_IGNORE);
+
+		if (header.identifier != identifier()) {
+			logWarning() << "Checkpoint identifier does match";
+			result = false;
+		} else if (header.numBndGP != numBndGP()) {
+			logWarning() << "Number of boundary points in the fault checkpoint does not match";
+			result = false;
+		}
+	}
+
+	// Make sure everybody knows the result of the validation
+	MPI_Bcast(&result, 1, MPI_INT, 0, comm());
+
+	return result;
+}
+
+void seissol::checkpoint::mpio::FaultGlobal::writeHeader(int timestepFault)
+{
+	EPIK_TRACER("checkpoint_write_fault_header");
+	SCOREP_USER_REGION("checkpoint_write_fault_header", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	checkMPIErr(setHeaderView(file()));
+
+	if (rank() == 0) {
+		Header header;
+		header.identifier = identifier();
+		header.timestepFault = timestepFault;
+		header.numBndGP = numBndGP();
+		header.numRecords = m_numRecords;
+
+		checkMPIErr(MPI_File_write(file(), &header, 1, headerType(), MPI_STATUS_IGNORE));
+
+		// The identifiers follow the (aligned) header
+		checkMPIErr(MPI_File_write_at(file(), headerSize(), m_allIds.data(), m_numRecords,
+			MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE));
+	}
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef CHECKPOINT_MPIO_FAULT_GLOBAL_H
+#define CHECKPOINT_MPIO_FAULT_GLOBAL_H
+
+#ifndef USE_MPI
+#include "Checkpoint/FaultDummy.h"
+#else // USE_MPI
+
+#include <mpi.h>
+
+#include <vector>
+
+#include "CheckPoint.h"
+#include "Checkpoint/Fault.h"
+
+#endif // USE_MPI
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace mpio
+{
+
+#ifndef USE_MPI
+typedef FaultDummy FaultGlobal;
+#else // USE_MPI
+
+/**
+ * Fault checkpoint which stores the sides ordered by their global identifier.
+ *
+ * The file contains a sorted table of all side identifiers after the header,
+ * followed by the data of the sides in the order of the table.
+ * The data of sides which are on two ranks (or on both sides of the fault on one rank)
+ * is stored for both identifiers.
+ */
+class FaultGlobal : public CheckPoint, virtual public seissol::checkpoint::Fault
+{
+private:
+	/** Struct describing the  header information in the file */
+	struct Header {
+		unsigned long identifier;
+		int timestepFault;
+		unsigned int numBndGP;
+		unsigned long numRecords;
+	};
+
+	/** Total number of records in the file */
+	unsigned long m_numRecords;
+
+	/** All identifiers in the file (only on rank 0) */
+	std::vector<unsigned long> m_allIds;
+
+	/** The local sides in the order of the file view */
+	std::vector<unsigned int> m_records;
+
+	/** Buffer for the data in the order of the file view */
+	std::vector<real> m_dataCopy;
+
+public:
+	FaultGlobal()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Fault(IDENTIFIER),
+		CheckPoint(IDENTIFIER),
+		m_numRecords(0)
+	{}
+
+	bool init(unsigned int numSides, unsigned int numBndGP,
+		unsigned int groupSize = 1);
+
+	/**
+	 * @param[out] timestepFault Time step of the fault writer in the checkpoint
+	 *  (if the fault writer was active)
+	 */
+	void load(int &timestepFault, real* mu, real* slipRate1, real* slipRate2,
+		real* slip, real* slip1, real* slip2, real* state, real* strength);
+
+	void initLate(const real* mu, const real* slipRate1, const real* slipRate2,
+		const real* slip, const real* slip1, const real* slip2, const real* state, const real* strength);
+
+	void write(int timestepFault);
+
+	void close()
+	{
+		if (numSides() == 0)
+			return;
+
+		CheckPoint::close();
+	}
+
+protected:
+	bool validate(MPI_File file);
+
+	void writeHeader(int timestepFault);
+
+protected:
+	static const unsigned long IDENTIFIER = 0x7A85C;
+};
+
+#endif // USE_MPI
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_MPIO_FAULT_GLOBAL_H
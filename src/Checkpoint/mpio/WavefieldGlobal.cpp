@@ -0,0 +1,198 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "WavefieldGlobal.h"
+#include "Monitoring/instrumentation.hpp"
+
+void seissol::checkpoint::mpio::WavefieldGlobal::setHeader(seissol::checkpoint::WavefieldHeader &header)
+{
+	seissol::checkpoint::Wavefield::setHeader(header);
+	header.add(m_numCellsComp);
+	header.add(m_dofsPerCellComp);
+}
+
+seissol::checkpoint::mpio::GlobalCellLayout seissol::checkpoint::mpio::WavefieldGlobal::computeLayout(
+	const std::vector<unsigned long> &ids)
+{
+	// Sort the cells by their identifier, only the first cell with an identifier is stored
+	std::vector<std::pair<unsigned long, unsigned long>> cells;
+	cells.reserve(ids.size());
+	for (unsigned long i = 0; i < ids.size(); i++) {
+		if (ids[i] != INVALID_ID)
+			cells.emplace_back(ids[i], i);
+	}
+	std::sort(cells.begin(), cells.end());
+
+	GlobalCellLayout layout;
+	for (unsigned long i = 0; i < cells.size(); i++) {
+		if (i > 0 && cells[i-1].first == cells[i].first) {
+			layout.duplicates.emplace_back(cells[i].second, layout.uniqueCells.back());
+		} else {
+			layout.positions.push_back(cells[i].first);
+			layout.uniqueCells.push_back(cells[i].second);
+		}
+	}
+
+	// The identifiers start at zero, the file contains a slot for each of them
+	layout.numCells = layout.positions.empty() ? 0 : layout.positions.back() + 1;
+
+	return layout;
+}
+
+bool seissol::checkpoint::mpio::WavefieldGlobal::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
+{
+	seissol::checkpoint::Wavefield::init(headerSize, numDofs, groupSize);
+
+	const std::vector<unsigned long> &ids = cellIds();
+	if (numDofs > 0 && ids.empty())
+		logError() << "The checkpoint back-end requires the global identifiers of the cells";
+
+	m_dofsPerCell = ids.empty() ? 0 : numDofs / ids.size();
+	MPI_Allreduce(MPI_IN_PLACE, &m_dofsPerCell, 1, MPI_UNSIGNED_LONG, MPI_MAX, comm());
+
+	GlobalCellLayout layout = computeLayout(ids);
+	const std::vector<unsigned long> &positions = layout.positions;
+	const std::vector<unsigned long> &uniqueCells = layout.uniqueCells;
+	m_duplicates = std::move(layout.duplicates);
+
+	m_numCells = layout.numCells;
+	MPI_Allreduce(MPI_IN_PLACE, &m_numCells, 1, MPI_UNSIGNED_LONG, MPI_MAX, comm());
+
+	// Create the header data type
+	// We cannot use header since this will be called on I/O nodes as well
+	MPI_Datatype headerType;
+	MPI_Type_contiguous(headerSize, MPI_BYTE, &headerType);
+	setHeaderType(headerType);
+
+	// Define the file view
+	defineIndexedFileView(headerSize, 0, m_dofsPerCell * sizeof(real), positions, m_numCells);
+
+	// Select the unique cells in the dofs buffer (in the order of the file)
+	std::vector<int> blockLength;
+	std::vector<MPI_Aint> displ;
+	for (unsigned long i = 0; i < uniqueCells.size(); i++) {
+		if (i > 0 && uniqueCells[i-1]+1 == uniqueCells[i] && blockLength.back() < (1<<30)) {
+			blockLength.back()++;
+		} else {
+			blockLength.push_back(1);
+			displ.push_back(uniqueCells[i] * m_dofsPerCell * sizeof(real));
+		}
+	}
+
+	MPI_Datatype cellType;
+	MPI_Type_contiguous(m_dofsPerCell, MPI_C_REAL, &cellType);
+	MPI_Type_create_hindexed(blockLength.size(), blockLength.data(), displ.data(), cellType, &m_memoryType);
+	MPI_Type_commit(&m_memoryType);
+	MPI_Type_free(&cellType);
+
+	return exists();
+}
+
+void seissol::checkpoint::mpio::WavefieldGlobal::load(real* dofs)
+{
+	logInfo(rank()) << "Loading wave field checkpoint";
+
+	seissol::checkpoint::CheckPoint::setLoaded();
+
+	MPI_File file = open();
+	if (file == MPI_FILE_NULL)
+		logError() << "Could not open checkpoint file";
+
+	// Read and broadcast header
+	checkMPIErr(setHeaderView(file));
+
+	if (rank() == 0)
+		checkMPIErr(MPI_File_read(file, header().data(), 1, headerType(), MPI_STATUS_IGNORE));
+
+	MPI_Bcast(header().data(), 1, headerType(), 0, comm());
+
+	// Read dofs, MPI-IO collects the cells of this rank from the whole file
+	checkMPIErr(setDataView(file));
+	checkMPIErr(MPI_File_read_all(file, dofs, 1, m_memoryType, MPI_STATUS_IGNORE));
+
+	// Close the file
+	checkMPIErr(MPI_File_close(&file));
+
+	// Fill the duplicated cells
+	for (const auto &duplicate : m_duplicates)
+		memcpy(&dofs[duplicate.first * m_dofsPerCell], &dofs[duplicate.second * m_dofsPerCell],
+			m_dofsPerCell * sizeof(real));
+}
+
+void seissol::checkpoint::mpio::WavefieldGlobal::initHeader(WavefieldHeader &header)
+{
+	seissol::checkpoint::Wavefield::initHeader(header);
+
+	header.value(m_numCellsComp) = m_numCells;
+	header.value(m_dofsPerCellComp) = m_dofsPerCell;
+}
+
+void seissol::checkpoint::mpio::WavefieldGlobal::write(const void* header, size_t headerSize)
+{
+	SCOREP_USER_REGION("CheckPoint_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	logInfo(rank()) << "Checkpoint backend: Writing.";
+
+	// Write the header
+	writeHeader(header, headerSize);
+
+	// Save data
+	SCOREP_USER_REGION_DEFINE(r_write_wavefield);
+	SCOREP_USER_REGION_BEGIN(r_write_wavefield, "checkpoint_write_wavefield", SCOREP_USER_REGION_TYPE_COMMON);
+	checkMPIErr(setDataView(file()));
+
+	checkMPIErr(MPI_File_write_all(file(), const_cast<real*>(dofs()), 1, m_memoryType, MPI_STATUS_IGNORE));
+
+	SCOREP_USER_REGION_END(r_write_wavefield);
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+
+	logInfo(rank()) << "Checkpoint backend: Writing. Done.";
+}
+
+bool seissol::checkpoint::mpio::WavefieldGlobal::validate(MPI_File file)
+{
+	if (setHeaderView(file) != 0) {
+		logWarning() << "Could not set checkpoint header view";
+		return false;
+	}
+
+	int result = true;
+
+	if (rank() == 0 && hasHeader()) { // Only validate on compute nodes
+		// Check the header
+		MPI_File_read(file, header().data(), 1, headerType(), MPI_STATUS_IGNORE);
+
+		if (header().identifier() != identifier()) {
+			logWarning() << "Checkpoint identifier does match";
+			result = false;
+		} else if (header().value(m_numCellsComp) != m_numCells) {
+			logWarning() << "Number of cells in checkpoint does not match";
+			result = false;
+		} else if (header().value(m_dofsPerCellComp) != m_dofsPerCell) {
+			logWarning() << "Number of degrees of freedom per cell in checkpoint does not match";
+			result = false;
+		}
+	}
+
+	// Make sure everybody knows the result of the validation
+	MPI_Bcast(&result, 1, MPI_INT, 0, comm());
+
+	return result;
+}
+
+void seissol::checkpoint::mpio::WavefieldGlobal::writeHeader(const void* header, size_t headerSize)
+{
+	SCOREP_USER_REGION("checkpoint_write_header", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	checkMPIErr(setHeaderView(file()));
+
+	if (rank() == 0)
+		checkMPIErr(MPI_File_write(file(), const_cast<void*>(header), 1, headerType(), MPI_STATUS_IGNORE));
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef CHECKPOINT_MPIO_WAVEFIELD_GLOBAL_H
+#define CHECKPOINT_MPIO_WAVEFIELD_GLOBAL_H
+
+#ifndef USE_MPI
+#include "Checkpoint/WavefieldDummy.h"
+#else // USE_MPI
+
+#include <mpi.h>
+
+#include <utility>
+#include <vector>
+
+#include "CheckPoint.h"
+#include "Checkpoint/Wavefield.h"
+#include "Checkpoint/DynStruct.h"
+
+#endif // USE_MPI
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace mpio
+{
+
+#ifndef USE_MPI
+typedef WavefieldDummy WavefieldGlobal;
+#else // USE_MPI
+
+/**
+ * Layout of the cells of one rank in a checkpoint ordered by global identifiers.
+ */
+struct GlobalCellLayout
+{
+	/** Global identifiers of the stored cells, i.e. their positions in the file (sorted) */
+	std::vector<unsigned long> positions;
+
+	/** Local indices of the stored cells, in the order of positions */
+	std::vector<unsigned long> uniqueCells;
+
+	/** Pairs of duplicated cells and the cell they are copied from */
+	std::vector<std::pair<unsigned long, unsigned long>> duplicates;
+
+	/** Number of cells in the file required by this rank */
+	unsigned long numCells;
+};
+
+/**
+ * Wave field checkpoint which stores the cells ordered by their global identifier.
+ *
+ * The layout of the file does not depend on the partitioning. Thus, the checkpoint
+ * can be loaded with any number of ranks. The redistribution of the cells is left to
+ * the collective I/O of MPI-IO.
+ */
+class WavefieldGlobal : public CheckPoint, virtual public seissol::checkpoint::Wavefield
+{
+private:
+	/** The number of cells component in the header */
+	DynStruct::Component<unsigned long> m_numCellsComp;
+
+	/** The number of dofs per cell component in the header */
+	DynStruct::Component<unsigned long> m_dofsPerCellComp;
+
+	/** Total number of cells in the file */
+	unsigned long m_numCells;
+
+	/** Number of dofs per cell */
+	unsigned long m_dofsPerCell;
+
+	/** Pairs of duplicated cells and the cell they are copied from */
+	std::vector<std::pair<unsigned long, unsigned long>> m_duplicates;
+
+	/** The MPI data type selecting the unique cells in the dofs buffer */
+	MPI_Datatype m_memoryType;
+
+public:
+	WavefieldGlobal()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Wavefield(IDENTIFIER),
+		CheckPoint(IDENTIFIER),
+		m_numCells(0), m_dofsPerCell(0),
+		m_memoryType(MPI_DATATYPE_NULL)
+	{
+	}
+
+	void setHeader(WavefieldHeader &header) override;
+
+	bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1) override;
+
+	void load(real* dofs) override;
+
+	void initHeader(WavefieldHeader &header) override;
+
+	void write(const void* header, size_t headerSize) override;
+
+	/**
+	 * Sorts the local cells by their global identifiers. Only the first cell with an identifier
+	 * is stored, the other cells with the same identifier are duplicates of it. Cells with the
+	 * identifier INVALID_ID are ignored.
+	 */
+	static GlobalCellLayout computeLayout(const std::vector<unsigned long> &ids);
+
+	void close()
+	{
+		if (m_memoryType != MPI_DATATYPE_NULL)
+			MPI_Type_free(&m_memoryType);
+
+		CheckPoint::close();
+	}
+
+protected:
+	bool validate(MPI_File file) override;
+
+	void writeHeader(const void* header, size_t headerSize);
+
+protected:
+	static const unsigned long IDENTIFIER = 0x7A3C1;
+};
+
+#endif // USE_MPI
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_MPIO_WAVEFIELD_GLOBAL_H
@@ -8,6 +8,7 @@
 #include "FrictionSolverCommon.h"
 #include "Initializer/Parameters/DRParameters.h"
 #include "Monitoring/instrumentation.hpp"
+#include "Parallel/TaskLoop.hpp"
 
 namespace seissol::dr::friction_law {
 /**
@@ -32,10 +33,7 @@ class BaseFrictionLaw : public FrictionSolver {
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
 
     // loop over all dynamic rupture faces, in this LTS layer
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (unsigned ltsFace = 0; ltsFace < layerData.getNumberOfCells(); ++ltsFace) {
+    parallel::forEach(layerData.getNumberOfCells(), [&](unsigned ltsFace) {
       alignas(ALIGNMENT) FaultStresses faultStresses{};
       SCOREP_USER_REGION_BEGIN(
           myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
@@ -48,58 +46,15 @@ class BaseFrictionLaw : public FrictionSolver {
       LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
       SCOREP_USER_REGION_END(myRegionHandle)
 
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePreHook");
-      // define some temporary variables
-      std::array<real, misc::numPaddedPoints> stateVariableBuffer{0};
-      std::array<real, misc::numPaddedPoints> strengthBuffer{0};
-
-      static_cast<Derived*>(this)->preHook(stateVariableBuffer, ltsFace);
-      LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(myRegionHandle,
-                               "computeDynamicRuptureUpdateFrictionAndSlip",
-                               SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
       TractionResults tractionResults = {};
 
-      // loop over sub time steps (i.e. quadrature points in time)
-      for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
-        common::adjustInitialStress(initialStressInFaultCS[ltsFace],
-                                    nucleationStressInFaultCS[ltsFace],
-                                    initialPressure[ltsFace],
-                                    nucleationPressure[ltsFace],
-                                    this->mFullUpdateTime,
-                                    this->drParameters->t0,
-                                    this->deltaT[timeIndex]);
-
-        static_cast<Derived*>(this)->updateFrictionAndSlip(faultStresses,
-                                                           tractionResults,
-                                                           stateVariableBuffer,
-                                                           strengthBuffer,
-                                                           ltsFace,
-                                                           timeIndex);
-      }
-      LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
-      SCOREP_USER_REGION_END(myRegionHandle)
+      // faces which stay locked during the whole time step skip the friction update
+      const bool isLocked =
+          static_cast<Derived*>(this)->updateLockedFace(faultStresses, tractionResults, ltsFace);
 
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePostHook");
-      static_cast<Derived*>(this)->postHook(stateVariableBuffer, ltsFace);
-
-      common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
-                                     ruptureTime[ltsFace],
-                                     slipRateMagnitude[ltsFace],
-                                     mFullUpdateTime);
-
-      static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
-
-      common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
-      LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
-      SCOREP_USER_REGION_END(myRegionHandle)
+      if (!isLocked) {
+        updateFace(faultStresses, tractionResults, ltsFace);
+      }
 
       SCOREP_USER_REGION_BEGIN(myRegionHandle,
                                "computeDynamicRupturePostcomputeImposedState",
@@ -135,7 +90,79 @@ class BaseFrictionLaw : public FrictionSolver {
                                       spaceWeights,
                                       godunovData[ltsFace]);
       }
+    });
+  }
+
+  /**
+   * Runs the friction update and the output bookkeeping of a fault face for the whole time step.
+   */
+  void updateFace(const FaultStresses& faultStresses,
+                  TractionResults& tractionResults,
+                  unsigned int ltsFace) {
+    SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePreHook");
+    // define some temporary variables
+    std::array<real, misc::numPaddedPoints> stateVariableBuffer{0};
+    std::array<real, misc::numPaddedPoints> strengthBuffer{0};
+
+    static_cast<Derived*>(this)->preHook(stateVariableBuffer, ltsFace);
+    LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                             "computeDynamicRuptureUpdateFrictionAndSlip",
+                             SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
+    // loop over sub time steps (i.e. quadrature points in time)
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+      common::adjustInitialStress(initialStressInFaultCS[ltsFace],
+                                  nucleationStressInFaultCS[ltsFace],
+                                  initialPressure[ltsFace],
+                                  nucleationPressure[ltsFace],
+                                  this->mFullUpdateTime,
+                                  this->drParameters->t0,
+                                  this->deltaT[timeIndex]);
+
+      static_cast<Derived*>(this)->updateFrictionAndSlip(faultStresses,
+                                                         tractionResults,
+                                                         stateVariableBuffer,
+                                                         strengthBuffer,
+                                                         ltsFace,
+                                                         timeIndex);
     }
+    LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePostHook");
+    static_cast<Derived*>(this)->postHook(stateVariableBuffer, ltsFace);
+
+    common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
+                                   ruptureTime[ltsFace],
+                                   slipRateMagnitude[ltsFace],
+                                   mFullUpdateTime);
+
+    static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
+
+    common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
+    LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
+    SCOREP_USER_REGION_END(myRegionHandle)
+  }
+
+  /**
+   * Checks whether the fault face stays locked during the whole time step, i.e. whether the
+   * friction update leaves slip, state and friction coefficient unchanged. If so, sets the
+   * tractions to the ones of the locked interface and returns true, such that the friction
+   * update and the output bookkeeping of the face can be skipped.
+   * Friction laws which do not support this return false.
+   */
+  bool updateLockedFace(const FaultStresses& faultStresses,
+                        TractionResults& tractionResults,
+                        unsigned int ltsFace) {
+    return false;
   }
 };
 } // namespace seissol::dr::friction_law
@@ -36,7 +36,7 @@ class FastVelocityWeakeningLaw
  * @param localSlipRate \f$ V \f$
  * @return \f$ \Psi(t) \f$
  */
-#pragma omp declare simd
+#pragma omp declare simd uniform(this, face, timeIncrement) linear(pointIndex)
   real updateStateVariable(unsigned int pointIndex,
                            unsigned int face,
                            real stateVarReference,
@@ -79,7 +79,7 @@ class FastVelocityWeakeningLaw
  * @param localStateVariable \f$ \Psi \f$
  * @return \f$ \mu \f$
  */
-#pragma omp declare simd
+#pragma omp declare simd uniform(this, ltsFace) linear(pointIndex)
   real updateMu(unsigned int ltsFace,
                 unsigned int pointIndex,
                 real localSlipRateMagnitude,
@@ -103,7 +103,7 @@ class FastVelocityWeakeningLaw
  * @param localStateVariable \f$ \Psi \f$
  * @return \f$ \mu \f$
  */
-#pragma omp declare simd
+#pragma omp declare simd uniform(this, ltsFace) linear(pointIndex)
   real updateMuDerivative(unsigned int ltsFace,
                           unsigned int pointIndex,
                           real localSlipRateMagnitude,
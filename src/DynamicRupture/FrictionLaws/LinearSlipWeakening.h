@@ -3,6 +3,8 @@
 
 #include "BaseFrictionLaw.h"
 
+#include <algorithm>
+
 #include "utils/logger.h"
 
 namespace seissol::dr::friction_law {
@@ -39,6 +41,84 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
     this->frictionFunctionHook(stateVariableBuffer, ltsFace);
   }
 
+  /**
+   * A face stays locked during the time step if it does not slip, is neither nucleated nor
+   * forced to rupture, is not about to heal and if the traction stays below the fault strength at
+   * all time points.
+   * Then, the friction update leaves slip, state and friction coefficient unchanged, and the
+   * tractions are the ones of the locked interface.
+   * As the check is repeated in every time step, a face is updated again as soon as the stress
+   * change brought by the rupture front reaches its strength.
+   */
+  bool updateLockedFace(const FaultStresses& faultStresses,
+                        TractionResults& tractionResults,
+                        unsigned int ltsFace) {
+    if constexpr (!SpecializationT::SupportsLockedFaces) {
+      return false;
+    } else {
+      // the initial stress changes during the nucleation
+      if (this->mFullUpdateTime <= this->drParameters->t0) {
+        return false;
+      }
+
+      const real endTime = this->mFullUpdateTime + this->sumDt;
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        if (this->slipRateMagnitude[ltsFace][pointIndex] != 0.0 ||
+            this->forcedRuptureTime[ltsFace][pointIndex] <= endTime) {
+          return false;
+        }
+        // the instantaneous healing of the friction function (see frictionFunctionHook) would
+        // reset the friction coefficient
+        if ((this->peakSlipRate[ltsFace][pointIndex] > this->drParameters->healingThreshold) &&
+            (this->slipRateMagnitude[ltsFace][pointIndex] < this->drParameters->healingThreshold) &&
+            (this->mu[ltsFace][pointIndex] != muS[ltsFace][pointIndex])) {
+          return false;
+        }
+      }
+
+      for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+        for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+          const real totalNormalStress = this->initialStressInFaultCS[ltsFace][pointIndex][0] +
+                                         faultStresses.normalStress[timeIndex][pointIndex] +
+                                         this->initialPressure[ltsFace][pointIndex] +
+                                         faultStresses.fluidPressure[timeIndex][pointIndex];
+          const real strength = specialization.strengthHook(
+              -cohesion[ltsFace][pointIndex] -
+                  this->mu[ltsFace][pointIndex] * std::min(totalNormalStress, static_cast<real>(0.0)),
+              0.0,
+              this->deltaT[timeIndex],
+              ltsFace,
+              pointIndex);
+          const real totalTraction1 = this->initialStressInFaultCS[ltsFace][pointIndex][3] +
+                                      faultStresses.traction1[timeIndex][pointIndex];
+          const real totalTraction2 = this->initialStressInFaultCS[ltsFace][pointIndex][5] +
+                                      faultStresses.traction2[timeIndex][pointIndex];
+          if (!(misc::magnitude(totalTraction1, totalTraction2) < strength)) {
+            return false;
+          }
+        }
+      }
+
+      for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+        std::copy_n(faultStresses.traction1[timeIndex],
+                    misc::numPaddedPoints,
+                    tractionResults.traction1[timeIndex]);
+        std::copy_n(faultStresses.traction2[timeIndex],
+                    misc::numPaddedPoints,
+                    tractionResults.traction2[timeIndex]);
+      }
+      std::copy_n(faultStresses.traction1[CONVERGENCE_ORDER - 1],
+                  misc::numPaddedPoints,
+                  this->traction1[ltsFace]);
+      std::copy_n(faultStresses.traction2[CONVERGENCE_ORDER - 1],
+                  misc::numPaddedPoints,
+                  this->traction2[ltsFace]);
+      std::fill_n(this->slipRate1[ltsFace], misc::numPaddedPoints, static_cast<real>(0.0));
+      std::fill_n(this->slipRate2[ltsFace], misc::numPaddedPoints, static_cast<real>(0.0));
+      return true;
+    }
+  }
+
   void copyLtsTreeToLocal(seissol::initializer::Layer& layerData,
                           const seissol::initializer::DynamicRupture* const dynRup,
                           real fullUpdateTime) {
@@ -216,6 +296,8 @@ class NoSpecialization {
   public:
   explicit NoSpecialization(seissol::initializer::parameters::DRParameters* parameters) {};
 
+  static constexpr bool SupportsLockedFaces = true;
+
   void copyLtsTreeToLocal(seissol::initializer::Layer& layerData,
                           const seissol::initializer::DynamicRupture* const dynRup,
                           real fullUpdateTime) {};
@@ -253,6 +335,9 @@ class BiMaterialFault {
   explicit BiMaterialFault(seissol::initializer::parameters::DRParameters* parameters)
       : drParameters(parameters) {};
 
+  // the regularised strength evolves also on locked faces
+  static constexpr bool SupportsLockedFaces = false;
+
   void copyLtsTreeToLocal(seissol::initializer::Layer& layerData,
                           const seissol::initializer::DynamicRupture* const dynRup,
                           real fullUpdateTime);
@@ -294,6 +379,8 @@ class TPApprox {
   explicit TPApprox(seissol::initializer::parameters::DRParameters* parameters)
       : drParameters(parameters) {};
 
+  static constexpr bool SupportsLockedFaces = true;
+
   void copyLtsTreeToLocal(seissol::initializer::Layer& layerData,
                           const seissol::initializer::DynamicRupture* const dynRup,
                           real fullUpdateTime) {}
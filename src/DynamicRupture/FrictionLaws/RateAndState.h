@@ -292,42 +292,44 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
                                const std::array<real, misc::numPaddedPoints>& absoluteShearStress,
                                std::array<real, misc::numPaddedPoints>& slipRateTest) {
     // Note that we need double precision here, since single precision led to NaNs.
-    double muF[misc::numPaddedPoints], dMuF[misc::numPaddedPoints];
     double g[misc::numPaddedPoints], dG[misc::numPaddedPoints];
 
+#pragma omp simd
     for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
       // first guess = sliprate value of the previous step
       slipRateTest[pointIndex] = this->slipRateMagnitude[ltsFace][pointIndex];
     }
 
     for (unsigned i = 0; i < settings.maxNumberSlipRateUpdates; i++) {
-#pragma omp simd
+      // all points take the Newton step until the whole face has converged, such that the
+      // convergence check reduces to a mask count instead of a branch per point
+      unsigned numberOfNotConverged = 0;
+#pragma omp simd reduction(+ : numberOfNotConverged)
       for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
         // calculate friction coefficient and objective function
-        muF[pointIndex] = static_cast<Derived*>(this)->updateMu(
+        const double muF = static_cast<Derived*>(this)->updateMu(
             ltsFace, pointIndex, slipRateTest[pointIndex], localStateVariable[pointIndex]);
-        dMuF[pointIndex] = static_cast<Derived*>(this)->updateMuDerivative(
+        const double dMuF = static_cast<Derived*>(this)->updateMuDerivative(
             ltsFace, pointIndex, slipRateTest[pointIndex], localStateVariable[pointIndex]);
-        g[pointIndex] = -this->impAndEta[ltsFace].invEtaS *
-                            (std::fabs(normalStress[pointIndex]) * muF[pointIndex] -
-                             absoluteShearStress[pointIndex]) -
-                        slipRateTest[pointIndex];
+        g[pointIndex] =
+            -this->impAndEta[ltsFace].invEtaS *
+                (std::fabs(normalStress[pointIndex]) * muF - absoluteShearStress[pointIndex]) -
+            slipRateTest[pointIndex];
+
+        // derivative of g
+        dG[pointIndex] =
+            -this->impAndEta[ltsFace].invEtaS * (std::fabs(normalStress[pointIndex]) * dMuF) -
+            1.0;
+
+        // every element of g must be smaller than newtonTolerance (also catches NaNs)
+        numberOfNotConverged += !(std::fabs(g[pointIndex]) < settings.newtonTolerance);
       }
 
-      // max element of g must be smaller than newtonTolerance
-      const bool hasConverged = std::all_of(std::begin(g), std::end(g), [&](auto val) {
-        return std::fabs(val) < settings.newtonTolerance;
-      });
-      if (hasConverged) {
-        return hasConverged;
+      if (numberOfNotConverged == 0) {
+        return true;
       }
 #pragma omp simd
       for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
-
-        // derivative of g
-        dG[pointIndex] = -this->impAndEta[ltsFace].invEtaS *
-                             (std::fabs(normalStress[pointIndex]) * dMuF[pointIndex]) -
-                         1.0;
         // newton update
         const real tmp3 = g[pointIndex] / dG[pointIndex];
         slipRateTest[pointIndex] = std::max(rs::almostZero(), slipRateTest[pointIndex] - tmp3);
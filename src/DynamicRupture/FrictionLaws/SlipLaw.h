@@ -23,7 +23,7 @@ class SlipLaw : public SlowVelocityWeakeningLaw<SlipLaw<TPMethod>, TPMethod> {
  * @param localSlipRate \f$ V \f$
  * @return \f$ \Psi(t) \f$
  */
-#pragma omp declare simd
+#pragma omp declare simd uniform(this, face, timeIncrement) linear(pointIndex)
   double updateStateVariable(int pointIndex,
                              unsigned int face,
                              double stateVarReference,
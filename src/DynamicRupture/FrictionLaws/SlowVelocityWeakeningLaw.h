@@ -18,7 +18,7 @@ class SlowVelocityWeakeningLaw
                           real fullUpdateTime) {}
 
 // Note that we need double precision here, since single precision led to NaNs.
-#pragma omp declare simd
+#pragma omp declare simd uniform(this, face, timeIncrement) linear(pointIndex)
   double updateStateVariable(int pointIndex,
                              unsigned int face,
                              double stateVarReference,
@@ -37,7 +37,7 @@ class SlowVelocityWeakeningLaw
  * @param localStateVariable \f$ \Psi \f$
  * @return \f$ \mu \f$
  */
-#pragma omp declare simd
+#pragma omp declare simd uniform(this, ltsFace) linear(pointIndex)
   double updateMu(unsigned int ltsFace,
                   unsigned int pointIndex,
                   double localSlipRateMagnitude,
@@ -60,7 +60,7 @@ class SlowVelocityWeakeningLaw
  * @param localStateVariable \f$ \Psi \f$
  * @return \f$ \mu \f$
  */
-#pragma omp declare simd
+#pragma omp declare simd uniform(this, ltsFace) linear(pointIndex)
   double updateMuDerivative(unsigned int ltsFace,
                             unsigned int pointIndex,
                             double localSlipRateMagnitude,
@@ -30,6 +30,8 @@ void BaseDRInitializer::initializeFault(const seissol::initializer::DynamicRuptu
   logInfo(rank) << "Initializing Fault, using a quadrature rule with "
                 << misc::numberOfBoundaryGaussPoints << " points.";
   seissol::initializer::FaultParameterDB faultParameterDB;
+  faultParameterDB.setCacheDirectory(
+      seissolInstance.getSeisSolParameters().model.easiCacheDirectory);
   for (auto it = dynRupTree->beginLeaf(seissol::initializer::LayerMask(Ghost));
        it != dynRupTree->endLeaf();
        ++it) {
@@ -6,6 +6,7 @@
 #include "DynamicRupture/Output/DataTypes.hpp"
 #include "DynamicRupture/Output/Geometry.hpp"
 #include "DynamicRupture/Output/OutputAux.hpp"
+#include "DynamicRupture/Output/PickpointSampler.hpp"
 #include "DynamicRupture/Output/ReceiverBasedOutput.hpp"
 #include "Initializer/DynamicRupture.h"
 #include "Initializer/LTS.h"
@@ -18,9 +19,13 @@
 #include "Initializer/typedefs.hpp"
 #include "Kernels/precision.hpp"
 #include "ResultWriter/FaultWriterExecutor.h"
+#include "ResultWriter/ReceiverWriterExecutor.h"
 #include "SeisSol.h"
 #include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <filesystem>
 #include <fstream>
@@ -213,14 +218,17 @@ void OutputManager::initElementwiseOutput() {
 void OutputManager::initPickpointOutput() {
   ppOutputBuilder->build(ppOutputData);
   const auto& seissolParameters = seissolInstance.getSeisSolParameters();
+  const auto& pickpointParameters = seissolParameters.output.pickpointParameters;
 
   std::stringstream baseHeader;
   baseHeader << "VARIABLES = \"Time\"";
+  std::vector<std::string> columnNames{"Time"};
   size_t labelCounter = 0;
-  auto collectVariableNames = [&baseHeader, &labelCounter](auto& var, int) {
+  auto collectVariableNames = [&baseHeader, &columnNames, &labelCounter](auto& var, int) {
     if (var.isActive) {
       for (int dim = 0; dim < var.dim(); ++dim) {
         baseHeader << " ,\"" << writer::FaultWriterExecutor::getLabelName(labelCounter) << '\"';
+        columnNames.emplace_back(writer::FaultWriterExecutor::getLabelName(labelCounter));
         ++labelCounter;
       }
     } else {
@@ -230,6 +238,40 @@ void OutputManager::initPickpointOutput() {
   misc::forEach(ppOutputData->vars, collectVariableNames);
 
   auto& outputData = ppOutputData;
+
+  if (pickpointParameters.printTimeIntervalSec > 0.0) {
+    pickpointSampler = PickpointSampler(pickpointParameters.printTimeIntervalSec);
+  }
+
+  if (isBinaryPickpointOutput()) {
+    // All ranks write to one file, hence all ranks need to provide the same sampling times
+    if (pickpointParameters.printTimeIntervalSec <= 0.0) {
+      logError() << "The binary on-fault receiver output requires printtimeinterval_sec > 0.";
+    }
+
+    std::vector<writer::ReceiverPointRecord> points;
+    for (const auto& receiver : outputData->receiverPoints) {
+      const auto& point = const_cast<ExtVrtxCoords&>(receiver.global);
+      points.push_back({static_cast<std::uint64_t>(receiver.globalReceiverIndex),
+                        {point[0], point[1], point[2]}});
+    }
+    pickpointSampleBuffer.init(points.size(), columnNames.size());
+
+    // Write the samples once per maxPickStore samples; one more sample may fall on the
+    // synchronization point and one on the start time
+    const double interval =
+        std::min(seissolParameters.timeStepping.endTime,
+                 pickpointParameters.printTimeIntervalSec * pickpointParameters.maxPickStore);
+    seissolInstance.pickpointWriter().init(
+        buildFileName(seissolParameters.output.prefix, "faultreceivers", "bin"),
+        columnNames,
+        points,
+        interval,
+        static_cast<size_t>(pickpointParameters.maxPickStore) + 2,
+        this);
+    return;
+  }
+
   for (const auto& receiver : outputData->receiverPoints) {
     const size_t globalIndex = receiver.globalReceiverIndex + 1;
 
@@ -303,7 +345,9 @@ bool OutputManager::isAtPickpoint(double time, double dt) {
 void OutputManager::writePickpointOutput(double time, double dt) {
   const auto& seissolParameters = seissolInstance.getSeisSolParameters();
   if (this->ppOutputBuilder) {
-    if (this->isAtPickpoint(time, dt)) {
+    if (seissolParameters.output.pickpointParameters.printTimeIntervalSec > 0.0) {
+      this->writeTimeBasedPickpointOutput(time, dt);
+    } else if (this->isAtPickpoint(time, dt)) {
 
       const auto& outputData = ppOutputData;
       impl->calcFaultOutput(seissol::initializer::parameters::OutputType::AtPickpoint,
@@ -324,7 +368,52 @@ void OutputManager::writePickpointOutput(double time, double dt) {
   }
 }
 
+void OutputManager::writeTimeBasedPickpointOutput(double time, double dt) {
+  const auto& seissolParameters = seissolInstance.getSeisSolParameters();
+  auto& outputData = ppOutputData;
+
+  if (outputData->currentCacheLevel >= outputData->maxCacheLevel) {
+    this->flushPickpointDataToFile();
+  }
+
+  // The fault output at the end of the step uses the next free cache level, which is
+  // overwritten by the samples afterwards
+  const size_t level = outputData->currentCacheLevel;
+  impl->calcFaultOutput(seissol::initializer::parameters::OutputType::AtPickpoint,
+                        seissolParameters.drParameters.slipRateOutputType,
+                        outputData,
+                        time);
+  outputData->currentCacheLevel = level;
+  pickpointSampler.addSamples(*outputData, time, [this]() { this->flushPickpointDataToFile(); });
+
+  const bool isCloseToEnd = (seissolParameters.timeStepping.endTime - time) < dt * timeMargin;
+  if (isCloseToEnd) {
+    this->flushPickpointDataToFile();
+  }
+}
+
+bool OutputManager::isBinaryPickpointOutput() const {
+  const auto& seissolParameters = seissolInstance.getSeisSolParameters();
+  return seissolParameters.output.pickpointParameters.format ==
+         seissol::initializer::parameters::ReceiverOutputFormat::Binary;
+}
+
+std::size_t OutputManager::collectPickpointSamples(std::uint64_t* sampleCounts,
+                                                   real* samples,
+                                                   std::size_t maxValues) {
+  pickpointSampleBuffer.stage(*ppOutputData);
+  return pickpointSampleBuffer.collect(sampleCounts, samples, maxValues);
+}
+
 void OutputManager::flushPickpointDataToFile() {
+  if (isBinaryPickpointOutput()) {
+    // The pick point writer collects the samples at its synchronization points
+    if (ppOutputData) {
+      pickpointSampleBuffer.stage(*ppOutputData);
+    }
+    return;
+  }
+
   auto& outputData = ppOutputData;
   const auto& seissolParameters = seissolInstance.getSeisSolParameters();
 
@@ -3,9 +3,12 @@
 
 #include "DynamicRupture/Output/Builders/ElementWiseBuilder.hpp"
 #include "DynamicRupture/Output/Builders/PickPointBuilder.hpp"
+#include "DynamicRupture/Output/PickpointSampler.hpp"
 #include "DynamicRupture/Output/ReceiverBasedOutput.hpp"
 #include "Initializer/Parameters/SeisSolParameters.h"
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace seissol {
 class SeisSol;
@@ -31,6 +34,17 @@ class OutputManager {
   void flushPickpointDataToFile();
   void updateElementwiseOutput();
 
+  /**
+   * Moves the samples of the binary pick point output to the buffers of the writer.
+   *
+   * @param sampleCounts Number of samples per receiver.
+   * @param samples Samples (time and values) of all receivers.
+   * @param maxValues Capacity of samples.
+   * @return Number of values in samples.
+   */
+  std::size_t
+      collectPickpointSamples(std::uint64_t* sampleCounts, real* samples, std::size_t maxValues);
+
   private:
   seissol::SeisSol& seissolInstance;
 
@@ -38,6 +52,8 @@ class OutputManager {
   bool isAtPickpoint(double time, double dt);
   void initElementwiseOutput();
   void initPickpointOutput();
+  void writeTimeBasedPickpointOutput(double time, double dt);
+  bool isBinaryPickpointOutput() const;
 
   std::unique_ptr<ElementWiseBuilder> ewOutputBuilder{nullptr};
   std::unique_ptr<PickPointBuilder> ppOutputBuilder{nullptr};
@@ -55,6 +71,9 @@ class OutputManager {
   seissol::geometry::MeshReader* meshReader{nullptr};
 
   size_t iterationStep{0};
+
+  PickpointSampler pickpointSampler{};
+  PickpointSampleBuffer pickpointSampleBuffer{};
   static constexpr double timeMargin{1.005};
   std::string backupTimeStamp{};
 
@@ -0,0 +1,134 @@
+#include "DynamicRupture/Output/PickpointSampler.hpp"
+#include "DynamicRupture/Misc.h"
+#include "DynamicRupture/Output/DataTypes.hpp"
+#include "Kernels/precision.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <utils/logger.h>
+#include <vector>
+
+namespace seissol::dr::output {
+
+void PickpointSampler::addSamples(ReceiverOutputData& outputData,
+                                  double time,
+                                  const std::function<void()>& flush) {
+  copyState(outputData, currentState);
+
+  if (!hasState) {
+    previousState = currentState;
+    previousTime = time;
+    nextSample =
+        static_cast<std::size_t>(std::max(0.0, std::ceil(time / interval - sampleTimeTolerance)));
+    hasState = true;
+  }
+
+  while (static_cast<double>(nextSample) * interval <= time + sampleTimeTolerance * interval) {
+    if (outputData.currentCacheLevel >= outputData.maxCacheLevel) {
+      flush();
+    }
+    addSample(outputData, static_cast<double>(nextSample) * interval, time);
+    ++nextSample;
+  }
+
+  std::swap(previousState, currentState);
+  previousTime = time;
+}
+
+void PickpointSampler::copyState(ReceiverOutputData& outputData, std::vector<real>& state) const {
+  const std::size_t level = outputData.currentCacheLevel;
+  state.clear();
+  auto copyValues = [level, &state](auto& var, int) {
+    if (var.isActive) {
+      for (int dim = 0; dim < var.dim(); ++dim) {
+        for (std::size_t pointId = 0; pointId < var.size; ++pointId) {
+          state.push_back(var(dim, level, pointId));
+        }
+      }
+    }
+  };
+  misc::forEach(outputData.vars, copyValues);
+}
+
+void PickpointSampler::addSample(ReceiverOutputData& outputData,
+                                 double sampleTime,
+                                 double time) const {
+  const std::size_t level = outputData.currentCacheLevel;
+  const double weight =
+      (time > previousTime)
+          ? std::clamp((sampleTime - previousTime) / (time - previousTime), 0.0, 1.0)
+          : 1.0;
+
+  std::size_t offset = 0;
+  auto interpolateValues = [&](auto& var, int index) {
+    if (var.isActive) {
+      // Event times jump from zero to the time of the event, hence they are not interpolated
+      const bool isEventTime =
+          index == VariableID::RuptureTime || index == VariableID::DynamicStressTime;
+      for (int dim = 0; dim < var.dim(); ++dim) {
+        for (std::size_t pointId = 0; pointId < var.size; ++pointId) {
+          const real previous = previousState[offset];
+          const real current = currentState[offset];
+          if (isEventTime) {
+            var(dim, level, pointId) = (current <= sampleTime) ? current : previous;
+          } else {
+            var(dim, level, pointId) = previous + static_cast<real>(weight) * (current - previous);
+          }
+          ++offset;
+        }
+      }
+    }
+  };
+  misc::forEach(outputData.vars, interpolateValues);
+
+  outputData.cachedTime[level] = sampleTime;
+  outputData.currentCacheLevel += 1;
+}
+
+void PickpointSampleBuffer::init(std::size_t numberOfReceivers, std::size_t numberOfColumns) {
+  columns = numberOfColumns;
+  receiverSamples.resize(numberOfReceivers);
+}
+
+void PickpointSampleBuffer::stage(ReceiverOutputData& outputData) {
+  for (std::size_t pointId = 0; pointId < receiverSamples.size(); ++pointId) {
+    auto& samples = receiverSamples[pointId];
+    for (std::size_t level = 0; level < outputData.currentCacheLevel; ++level) {
+      samples.push_back(static_cast<real>(outputData.cachedTime[level]));
+      auto recordResults = [pointId, level, &samples](auto& var, int) {
+        if (var.isActive) {
+          for (int dim = 0; dim < var.dim(); ++dim) {
+            samples.push_back(var(dim, level, pointId));
+          }
+        }
+      };
+      misc::forEach(outputData.vars, recordResults);
+    }
+  }
+  outputData.currentCacheLevel = 0;
+}
+
+std::size_t PickpointSampleBuffer::collect(std::uint64_t* sampleCounts,
+                                           real* samples,
+                                           std::size_t maxValues) {
+  std::size_t numberOfValues = 0;
+  for (std::size_t pointId = 0; pointId < receiverSamples.size(); ++pointId) {
+    auto& pointSamples = receiverSamples[pointId];
+    assert(pointSamples.size() % columns == 0);
+    if (numberOfValues + pointSamples.size() > maxValues) {
+      logError() << "On-fault receiver samples exceed the output buffer of" << maxValues
+                 << "values.";
+    }
+    std::copy(pointSamples.begin(), pointSamples.end(), samples + numberOfValues);
+    sampleCounts[pointId] = pointSamples.size() / columns;
+    numberOfValues += pointSamples.size();
+    pointSamples.clear();
+  }
+  return numberOfValues;
+}
+
+} // namespace seissol::dr::output
@@ -0,0 +1,81 @@
+#ifndef SEISSOL_DR_OUTPUT_PICKPOINT_SAMPLER_HPP
+#define SEISSOL_DR_OUTPUT_PICKPOINT_SAMPLER_HPP
+
+#include "DynamicRupture/Output/DataTypes.hpp"
+#include "Kernels/precision.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace seissol::dr::output {
+
+/**
+ * Samples the fault receivers at multiples of a time interval in simulated time.
+ *
+ * The fault quantities are only known at the end of the dynamic rupture time steps. The samples
+ * in between are interpolated linearly between the neighbouring step ends, i.e. the time
+ * expansion of the step is not evaluated at the sampling times. Rupture time and dynamic stress
+ * time are not interpolated, but set once the sampling time has passed them.
+ */
+class PickpointSampler {
+  public:
+  explicit PickpointSampler(double interval = 0.0) : interval(interval) {}
+
+  /**
+   * Adds the samples up to the given time to the cache of the output data.
+   *
+   * @param outputData Contains the fault output at the end of the step at the current cache
+   *  level, which is overwritten by the samples.
+   * @param time End of the dynamic rupture time step.
+   * @param flush Empties the cache of the output data when it is full.
+   */
+  void addSamples(ReceiverOutputData& outputData,
+                  double time,
+                  const std::function<void()>& flush);
+
+  private:
+  void copyState(ReceiverOutputData& outputData, std::vector<real>& state) const;
+  void addSample(ReceiverOutputData& outputData, double sampleTime, double time) const;
+
+  double interval;
+  bool hasState{false};
+  double previousTime{0.0};
+  std::size_t nextSample{0};
+  std::vector<real> previousState{};
+  std::vector<real> currentState{};
+  // relative to the sampling interval
+  static constexpr double sampleTimeTolerance{1.0e-6};
+};
+
+/**
+ * Keeps the samples (time and values) of the binary pick point output per receiver until they
+ * are handed to the writer.
+ */
+class PickpointSampleBuffer {
+  public:
+  void init(std::size_t numberOfReceivers, std::size_t numberOfColumns);
+
+  /**
+   * Moves the cached samples of the output data to the buffer and empties the cache.
+   */
+  void stage(ReceiverOutputData& outputData);
+
+  /**
+   * Moves the buffered samples to the buffers of the writer.
+   *
+   * @param sampleCounts Number of samples per receiver.
+   * @param samples Samples (time and values) of all receivers.
+   * @param maxValues Capacity of samples.
+   * @return Number of values in samples.
+   */
+  std::size_t collect(std::uint64_t* sampleCounts, real* samples, std::size_t maxValues);
+
+  private:
+  std::size_t columns{0};
+  std::vector<std::vector<real>> receiverSamples{};
+};
+
+} // namespace seissol::dr::output
+
+#endif // SEISSOL_DR_OUTPUT_PICKPOINT_SAMPLER_HPP
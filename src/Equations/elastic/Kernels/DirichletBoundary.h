@@ -7,8 +7,11 @@
 
 #include "Initializer/typedefs.hpp"
 
+#include "Numerical_aux/Functions.h"
 #include "Numerical_aux/Quadrature.h"
 
+#include <algorithm>
+
 #ifdef ACL_DEVICE
 #include "yateto.h"
 #include "device.h"
@@ -46,6 +49,12 @@ class DirichletBoundary {
 
   DirichletBoundary() {
     quadrature::GaussLegendre(quadPoints, quadWeights, CONVERGENCE_ORDER);
+    for (unsigned k = 0; k < CONVERGENCE_ORDER; ++k) {
+      for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
+        projectionWeights[k][point] = 0.5 * (2 * k + 1) * quadWeights[point] *
+                                      seissol::functions::JacobiP(k, 0, 0, quadPoints[point]);
+      }
+    }
   }
 
   template<typename Func, typename MappingKrnl>
@@ -135,6 +144,16 @@ class DirichletBoundary {
   }
 #endif
 
+  /**
+   * Integrates the boundary condition over [startTime, startTime + timeStepWidth].
+   *
+   * If expansionInterval is zero, the boundary condition is evaluated at CONVERGENCE_ORDER
+   * time points in every time step. Otherwise, it is projected onto the Legendre polynomials of
+   * degree < CONVERGENCE_ORDER over [startTime, startTime + max(expansionInterval, timeStepWidth)].
+   * The expansion is stored in the boundary mapping and each time step inside this interval
+   * only integrates the polynomials. The expansion is exact for boundary conditions which are
+   * polynomials of degree < CONVERGENCE_ORDER in time.
+   */
   template<typename Func, typename MappingKrnl>
   void evaluateTimeDependent(const real* dofsVolumeInteriorModal,
 			     int faceIdx,
@@ -143,7 +162,8 @@ class DirichletBoundary {
 			     Func&& evaluateBoundaryCondition,
 			     real* dofsFaceBoundaryNodal,
 			     double startTime,
-			     double timeStepWidth) const {
+			     double timeStepWidth,
+			     double expansionInterval = 0.0) const {
     // TODO(Lukas) Implement functions which depend on the interior values...
     auto boundaryDofs = init::INodal::view::create(dofsFaceBoundaryNodal);
   
@@ -151,6 +171,23 @@ class DirichletBoundary {
 		  "Need evaluation at all nodes!");
 
     assert(boundaryMapping.nodes != nullptr);
+
+    if (expansionInterval > 0.0) {
+      assert(boundaryMapping.analyticalExpansion != nullptr);
+      auto& expansion = *boundaryMapping.analyticalExpansion;
+      // Tolerate round-off in the accumulated simulation time
+      const double tolerance = 1e-6 * timeStepWidth;
+      if (startTime < expansion.start - tolerance ||
+          startTime + timeStepWidth > expansion.end + tolerance) {
+        expand(boundaryMapping.nodes,
+               std::forward<Func>(evaluateBoundaryCondition),
+               startTime,
+               std::max(expansionInterval, timeStepWidth),
+               expansion);
+      }
+      integrateExpansion(expansion, startTime, timeStepWidth, dofsFaceBoundaryNodal);
+      return;
+    }
   
     // Compute quad points/weights for interval [t, t+dt]
     double timePoints[CONVERGENCE_ORDER];
@@ -184,8 +221,80 @@ class DirichletBoundary {
   }
 
  private:
+  /**
+   * Projects the boundary condition onto Legendre polynomials over [startTime, startTime + length]
+   * using the Gauss-Legendre quadrature, which is exact for polynomials of degree < CONVERGENCE_ORDER.
+   */
+  template<typename Func>
+  void expand(const real* nodes,
+              Func&& evaluateBoundaryCondition,
+              double startTime,
+              double length,
+              AnalyticalBoundaryExpansion& expansion) const {
+    alignas(ALIGNMENT) real dofsFaceBoundaryNodalTmp[tensor::INodal::size()];
+    auto boundaryDofsTmp = init::INodal::view::create(dofsFaceBoundaryNodalTmp);
+
+    std::fill_n(expansion.coefficients, CONVERGENCE_ORDER * tensor::INodal::size(), 0);
+    for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
+      boundaryDofsTmp.setZero();
+      evaluateBoundaryCondition(nodes,
+                                startTime + 0.5 * length * (quadPoints[point] + 1.0),
+                                boundaryDofsTmp);
+      for (unsigned k = 0; k < CONVERGENCE_ORDER; ++k) {
+        const real weight = projectionWeights[k][point];
+        real* coefficients = expansion.coefficients + k * tensor::INodal::size();
+        for (unsigned i = 0; i < tensor::INodal::size(); ++i) {
+          coefficients[i] += weight * dofsFaceBoundaryNodalTmp[i];
+        }
+      }
+    }
+    expansion.start = startTime;
+    expansion.end = startTime + length;
+  }
+
+  /**
+   * Integrates the expansion over [startTime, startTime + timeStepWidth], i.e. computes
+   * dofsFaceBoundaryNodal = coefficients * integrals, where integrals holds the integrals of the
+   * Legendre polynomials.
+   */
+  static void integrateExpansion(const AnalyticalBoundaryExpansion& expansion,
+                                 double startTime,
+                                 double timeStepWidth,
+                                 real* dofsFaceBoundaryNodal) {
+    const double length = expansion.end - expansion.start;
+    const double xi0 = 2.0 * (startTime - expansion.start) / length - 1.0;
+    const double xi1 = 2.0 * (startTime + timeStepWidth - expansion.start) / length - 1.0;
+
+    // int P_k = (P_{k+1} - P_{k-1}) / (2k+1) for k > 0, and dt = length / 2 dxi
+    double legendre0[CONVERGENCE_ORDER + 1];
+    double legendre1[CONVERGENCE_ORDER + 1];
+    for (unsigned k = 0; k <= CONVERGENCE_ORDER; ++k) {
+      legendre0[k] = seissol::functions::JacobiP(k, 0, 0, xi0);
+      legendre1[k] = seissol::functions::JacobiP(k, 0, 0, xi1);
+    }
+    real integrals[CONVERGENCE_ORDER];
+    integrals[0] = 0.5 * length * (xi1 - xi0);
+    for (unsigned k = 1; k < CONVERGENCE_ORDER; ++k) {
+      integrals[k] = 0.5 * length *
+                     (legendre1[k + 1] - legendre1[k - 1] - legendre0[k + 1] + legendre0[k - 1]) /
+                     (2 * k + 1);
+    }
+
+    for (unsigned i = 0; i < tensor::INodal::size(); ++i) {
+      dofsFaceBoundaryNodal[i] = integrals[0] * expansion.coefficients[i];
+    }
+    for (unsigned k = 1; k < CONVERGENCE_ORDER; ++k) {
+      const real* coefficients = expansion.coefficients + k * tensor::INodal::size();
+      for (unsigned i = 0; i < tensor::INodal::size(); ++i) {
+        dofsFaceBoundaryNodal[i] += integrals[k] * coefficients[i];
+      }
+    }
+  }
+
   double quadPoints[CONVERGENCE_ORDER];
   double quadWeights[CONVERGENCE_ORDER];
+  // (2k+1)/2 * w_q * P_k(x_q), i.e. the L2 projection onto the Legendre polynomial P_k
+  double projectionWeights[CONVERGENCE_ORDER][CONVERGENCE_ORDER];
 };
 
 
@@ -50,7 +50,11 @@ namespace seissol::kernels {
         GravitationalFreeSurfaceBc gravitationalFreeSurfaceBc;
         LocalTmp(double graviationalAcceleration) : gravitationalFreeSurfaceBc(graviationalAcceleration) {};
     };
-#ifndef ACL_DEVICE
+#if defined(USE_COMPACT_INTEGRATION_DATA)
+    // the neighbor flux solvers are computed from the geometry and the material
+    LTSTREE_GENERATE_INTERFACE_GETTERED(LocalData, initializer::LTS, cellInformation, localIntegration, neighboringIntegration, dofs, faceDisplacements, boundaryMapping, material)
+    LTSTREE_GENERATE_INTERFACE_GETTERED(NeighborData, initializer::LTS, cellInformation, localIntegration, neighboringIntegration, dofs, material)
+#elif !defined(ACL_DEVICE)
     LTSTREE_GENERATE_INTERFACE_GETTERED(LocalData, initializer::LTS, cellInformation, localIntegration, neighboringIntegration, dofs, faceDisplacements, boundaryMapping, material)
     LTSTREE_GENERATE_INTERFACE_GETTERED(NeighborData, initializer::LTS, cellInformation, neighboringIntegration, dofs)
 #else
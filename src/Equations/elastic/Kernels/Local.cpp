@@ -49,6 +49,9 @@
 #include <stdint.h>
 #include "GravitationalFreeSurfaceBC.h"
 #include "SeisSol.h"
+#ifdef USE_COMPACT_INTEGRATION_DATA
+#include "Kernels/CellMatrices.h"
+#endif
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
@@ -144,11 +147,18 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   assert(reinterpret_cast<uintptr_t>(i_timeIntegratedDegreesOfFreedom) % ALIGNMENT == 0);
   assert(reinterpret_cast<uintptr_t>(data.dofs()) % ALIGNMENT == 0);
 
+#ifdef USE_COMPACT_INTEGRATION_DATA
+  alignas(ALIGNMENT) real starMatrices[3][tensor::star::size(0)];
+  computeStarMatrices(data.material(), data.localIntegration(), starMatrices);
+#else
+  const auto& starMatrices = data.localIntegration().starMatrices;
+#endif
+
   kernel::volume volKrnl = m_volumeKernelPrototype;
   volKrnl.Q = data.dofs();
   volKrnl.I = i_timeIntegratedDegreesOfFreedom;
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    volKrnl.star(i) = data.localIntegration().starMatrices[i];
+    volKrnl.star(i) = starMatrices[i];
   }
 
   // Optional source term
@@ -163,9 +173,28 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   volKrnl.execute();
 
   for (int face = 0; face < 4; ++face) {
+    const FaceType faceType = data.cellInformation().faceTypes[face];
+#ifdef USE_COMPACT_INTEGRATION_DATA
+    // the neighbor flux solver is only required for the boundary conditions below
+    alignas(ALIGNMENT) real localFluxSolver[tensor::AplusT::size()];
+    alignas(ALIGNMENT) real neighborFluxSolver[tensor::AminusT::size()];
+    const bool nodalBoundary = faceType == FaceType::freeSurfaceGravity ||
+                               faceType == FaceType::dirichlet ||
+                               faceType == FaceType::analytical;
+    computeFluxSolvers(data.material(),
+                       data.localIntegration(),
+                       face,
+                       faceType,
+                       faceType != FaceType::dynamicRupture ? localFluxSolver : nullptr,
+                       nodalBoundary ? neighborFluxSolver : nullptr);
+#else
+    const real* localFluxSolver = data.localIntegration().nApNm1[face];
+    const real* neighborFluxSolver = data.neighboringIntegration().nAmNm1[face];
+#endif
+
     // no element local contribution in the case of dynamic rupture boundary conditions
-    if (data.cellInformation().faceTypes[face] != FaceType::dynamicRupture) {
-      lfKrnl.AplusT = data.localIntegration().nApNm1[face];
+    if (faceType != FaceType::dynamicRupture) {
+      lfKrnl.AplusT = localFluxSolver;
       lfKrnl.execute(face);
     }
 
@@ -175,10 +204,10 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
     nodalLfKrnl.INodal = dofsFaceBoundaryNodal;
     nodalLfKrnl._prefetch.I = i_timeIntegratedDegreesOfFreedom + tensor::I::size();
     nodalLfKrnl._prefetch.Q = data.dofs() + tensor::Q::size();
-    nodalLfKrnl.AminusT = data.neighboringIntegration().nAmNm1[face];
+    nodalLfKrnl.AminusT = neighborFluxSolver;
 
     // Include some boundary conditions here.
-    switch (data.cellInformation().faceTypes[face]) {
+    switch (faceType) {
     case FaceType::freeSurfaceGravity:
       {
         assert(cellBoundaryMapping != nullptr);
@@ -258,7 +287,8 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
                                               applyAnalyticalSolution,
                                               dofsFaceBoundaryNodal,
                                               time,
-                                              timeStepWidth);
+                                              timeStepWidth,
+                                              analyticalExpansionInterval());
       nodalLfKrnl.execute(face);
       break;
       }
@@ -403,7 +433,8 @@ void seissol::kernels::Local::evaluateBatchedTimeDependentBc(
                                                 applyAnalyticalSolution,
                                                 dofsFaceBoundaryNodal,
                                                 time,
-                                                timeStepWidth);
+                                                timeStepWidth,
+                                                analyticalExpansionInterval());
 
         auto nodalLfKrnl = this->m_nodalLfKrnlPrototype;
         nodalLfKrnl.Q = data.dofs();
@@ -466,10 +497,15 @@ unsigned seissol::kernels::Local::bytesIntegral()
 {
   unsigned reals = 0;
 
+#ifdef USE_COMPACT_INTEGRATION_DATA
+  // geometry and material, the star matrices and flux solvers are computed on the fly
+  reals += sizeof(LocalIntegrationData) / sizeof(real) + sizeof(CellMaterialData) / sizeof(real);
+#else
   // star matrices load
   reals += yateto::computeFamilySize<tensor::star>();
   // flux solvers
   reals += 4 * tensor::AplusT::size();
+#endif
 
   // DOFs write
   reals += tensor::Q::size();
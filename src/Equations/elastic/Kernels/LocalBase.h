@@ -63,6 +63,8 @@ struct GlobalData;
 class seissol::kernels::LocalBase {
   protected:
     double gravitationalAcceleration;
+    double analyticalBoundaryRefreshInterval{0.0};
+    double endTime{0.0};
     static void checkGlobalData(GlobalData const* global, size_t alignment);
     kernel::volume m_volumeKernelPrototype;
     kernel::localFlux m_localFluxKernelPrototype;
@@ -91,10 +93,28 @@ public:
       gravitationalAcceleration = g;
     }
 
+    void setAnalyticalBoundaryExpansion(double refreshInterval, double simulationEndTime) {
+      analyticalBoundaryRefreshInterval = refreshInterval;
+      endTime = simulationEndTime;
+    }
+
     physics::InitialField* getInitCond(size_t index) {
       const auto& condition = this->initConds->at(index);
       return condition.get();
     }
+
+    /**
+     * Returns the length of the time intervals over which analytical boundary conditions are
+     * expanded, see DirichletBoundary::evaluateTimeDependent. The expansion of polynomials in time
+     * is exact, hence a single expansion covers the whole simulation.
+     */
+    double analyticalExpansionInterval() {
+      const int degree = getInitCond(0)->polynomialDegreeInTime();
+      if (degree >= 0 && degree < CONVERGENCE_ORDER) {
+        return endTime;
+      }
+      return analyticalBoundaryRefreshInterval;
+    }
 };
 #endif
 
@@ -71,9 +71,14 @@
 
 #include "Kernels/Neighbor.h"
 
+#include <algorithm>
 #include <cassert>
 #include <stdint.h>
 
+#ifdef USE_COMPACT_INTEGRATION_DATA
+#include "Kernels/CellMatrices.h"
+#endif
+
 void seissol::kernels::NeighborBase::checkGlobalData(GlobalData const* global, size_t alignment) {
 #ifndef NDEBUG
   for( int l_neighbor = 0; l_neighbor < 4; ++l_neighbor ) {
@@ -138,10 +143,21 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(NeighborData& data,
       assert(reinterpret_cast<uintptr_t>(i_timeIntegrated[l_face]) % ALIGNMENT == 0 );
       assert(data.cellInformation().faceRelations[l_face][0] < 4
              && data.cellInformation().faceRelations[l_face][1] < 3);
+#ifdef USE_COMPACT_INTEGRATION_DATA
+      alignas(ALIGNMENT) real neighborFluxSolver[tensor::AminusT::size()];
+      computeFluxSolvers(data.material(),
+                         data.localIntegration(),
+                         l_face,
+                         data.cellInformation().faceTypes[l_face],
+                         nullptr,
+                         neighborFluxSolver);
+#else
+      const real* neighborFluxSolver = data.neighboringIntegration().nAmNm1[l_face];
+#endif
       kernel::neighboringFlux nfKrnl = m_nfKrnlPrototype;
       nfKrnl.Q = data.dofs();
       nfKrnl.I = i_timeIntegrated[l_face];
-      nfKrnl.AminusT = data.neighboringIntegration().nAmNm1[l_face];
+      nfKrnl.AminusT = neighborFluxSolver;
       nfKrnl._prefetch.I = faceNeighbors_prefetch[l_face];
       nfKrnl.execute(data.cellInformation().faceRelations[l_face][1],
 		     data.cellInformation().faceRelations[l_face][0],
@@ -169,6 +185,70 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(NeighborData& data,
   }
 }
 
+void seissol::kernels::Neighbor::computeGroupedNeighborsIntegral(NeighborData::Loader& loader,
+                                                                 const NeighborGroups& groups,
+                                                                 unsigned block,
+                                                                 CellDRMapping const (*cellDrMapping)[4],
+                                                                 real* (*timeIntegrated)[4],
+                                                                 float* (*compressedFaceNeighbors)[4]) {
+  const unsigned* cells = groups.cells();
+
+  for (const auto* group = groups.groupsBegin(block); group != groups.groupsEnd(block); ++group) {
+    const unsigned face = group->key.faceId;
+
+    if (group->key.typeId == *FaceKinds::DynamicRupture) {
+      // No neighboring cell contribution, interior bc.
+      const unsigned side = group->key.faceRelationId % 4;
+      const unsigned faceRelation = group->key.faceRelationId / 4;
+
+      dynamicRupture::kernel::nodalFlux drKrnl = m_drKrnlPrototype;
+      for (unsigned i = group->begin; i < group->end; ++i) {
+        const auto& mapping = cellDrMapping[cells[i]][face];
+        assert(reinterpret_cast<uintptr_t>(mapping.godunov) % ALIGNMENT == 0);
+
+        drKrnl.fluxSolver = mapping.fluxSolver;
+        drKrnl.QInterpolated = mapping.godunov;
+        drKrnl.Q = loader.entry(cells[i]).dofs();
+        drKrnl._prefetch.I = cellDrMapping[cells[i + 1 < group->end ? i + 1 : i]][face].godunov;
+        drKrnl.execute(side, faceRelation);
+      }
+    } else {
+      // Standard neighboring flux, all cells of the group use the same flux matrices
+      const unsigned h = group->key.faceRelationId % 3;
+      const unsigned j = (group->key.faceRelationId / 3) % 4;
+
+      kernel::neighboringFlux nfKrnl = m_nfKrnlPrototype;
+      for (unsigned i = group->begin; i < group->end; ++i) {
+        auto data = loader.entry(cells[i]);
+        assert(reinterpret_cast<uintptr_t>(data.dofs()) % ALIGNMENT == 0);
+        assert(reinterpret_cast<uintptr_t>(timeIntegrated[cells[i]][face]) % ALIGNMENT == 0);
+#ifdef USE_COMPACT_INTEGRATION_DATA
+        alignas(ALIGNMENT) real neighborFluxSolver[tensor::AminusT::size()];
+        computeFluxSolvers(data.material(),
+                           data.localIntegration(),
+                           face,
+                           data.cellInformation().faceTypes[face],
+                           nullptr,
+                           neighborFluxSolver);
+#else
+        const real* neighborFluxSolver = data.neighboringIntegration().nAmNm1[face];
+#endif
+        nfKrnl.Q = data.dofs();
+        nfKrnl.I = timeIntegrated[cells[i]][face];
+        // Convert the single precision buffer of the neighbor to full precision
+        alignas(ALIGNMENT) real neighborTimeIntegrated[tensor::I::size()];
+        if (compressedFaceNeighbors != nullptr && compressedFaceNeighbors[cells[i]][face] != nullptr) {
+          std::copy_n(compressedFaceNeighbors[cells[i]][face], tensor::I::size(), neighborTimeIntegrated);
+          nfKrnl.I = neighborTimeIntegrated;
+        }
+        nfKrnl.AminusT = neighborFluxSolver;
+        nfKrnl._prefetch.I = timeIntegrated[cells[i + 1 < group->end ? i + 1 : i]][face];
+        nfKrnl.execute(h, j, face);
+      }
+    }
+  }
+}
+
 void seissol::kernels::Neighbor::computeBatchedNeighborsIntegral(ConditionalPointersToRealsTable &table) {
 #ifdef ACL_DEVICE
   kernel::gpu_neighboringFlux neighFluxKrnl = deviceNfKrnlPrototype;
@@ -288,10 +368,22 @@ unsigned seissol::kernels::Neighbor::bytesNeighborsIntegral()
 {
   unsigned reals = 0;
 
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+  // DOFs load, DOFs write; the tElasticDOFS are stored in single precision
+  reals += 2 * tensor::Q::size();
+  unsigned bytes = 4 * tensor::I::size() * sizeof(float);
+#else
   // 4 * tElasticDOFS load, DOFs load, DOFs write
   reals += 4 * tensor::I::size() + 2 * tensor::Q::size();
+  unsigned bytes = 0;
+#endif
+#ifdef USE_COMPACT_INTEGRATION_DATA
+  // geometry and material, the flux solvers are computed on the fly
+  reals += sizeof(LocalIntegrationData) / sizeof(real) + sizeof(CellMaterialData) / sizeof(real);
+#else
   // flux solvers load
   reals += 4 * tensor::AminusT::size();
+#endif
   
-  return reals * sizeof(real);
+  return bytes + reals * sizeof(real);
 }
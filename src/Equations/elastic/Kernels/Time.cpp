@@ -84,6 +84,9 @@ extern long long libxsmm_num_total_flops;
 
 #include "Kernels/common.hpp"
 #include "Kernels/denseMatrixOps.hpp"
+#ifdef USE_COMPACT_INTEGRATION_DATA
+#include "Kernels/CellMatrices.h"
+#endif
 
 #include <cstring>
 #include <cassert>
@@ -166,6 +169,13 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
                                       return f == FaceType::freeSurfaceGravity;
                                     });
 
+#ifdef USE_COMPACT_INTEGRATION_DATA
+  alignas(ALIGNMENT) real starMatrices[3][tensor::star::size(0)];
+  computeStarMatrices(data.material(), data.localIntegration(), starMatrices);
+#else
+  const auto& starMatrices = data.localIntegration().starMatrices;
+#endif
+
 #ifdef USE_STP
   //Note: We could use the space time predictor for elasticity.
   //This is not tested and experimental
@@ -173,7 +183,7 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
   alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()]{};
   kernel::spaceTimePredictor krnl = m_krnlPrototype;
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    krnl.star(i) = data.localIntegration().starMatrices[i];
+    krnl.star(i) = starMatrices[i];
   }
   krnl.Q = const_cast<real*>(data.dofs());
   krnl.I = o_timeIntegrated;
@@ -187,7 +197,7 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
 
   kernel::derivative krnl = m_krnlPrototype;
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    krnl.star(i) = data.localIntegration().starMatrices[i];
+    krnl.star(i) = starMatrices[i];
   }
 
   // Optional source term
@@ -320,14 +330,26 @@ unsigned seissol::kernels::Time::bytesAder()
 {
   unsigned reals = 0;
   
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+  // DOFs load; tDOFs load and write in single precision
+  reals += tensor::Q::size();
+  unsigned bytes = 2 * tensor::I::size() * sizeof(float);
+#else
   // DOFs load, tDOFs load, tDOFs write
   reals += tensor::Q::size() + 2 * tensor::I::size();
+  unsigned bytes = 0;
+#endif
+#ifdef USE_COMPACT_INTEGRATION_DATA
+  // gradients and material, the star matrices are computed on the fly
+  reals += 9 + sizeof(CellMaterialData) / sizeof(real);
+#else
   // star matrices, source matrix
   reals += yateto::computeFamilySize<tensor::star>();
+#endif
            
   /// \todo incorporate derivatives
 
-  return reals * sizeof(real);
+  return bytes + reals * sizeof(real);
 }
 
 void seissol::kernels::Time::computeIntegral( double                            i_expansionPoint,
@@ -135,6 +135,26 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(  NeighborData&
   nKrnl.execute();
 }
 
+void seissol::kernels::Neighbor::computeGroupedNeighborsIntegral(NeighborData::Loader& loader,
+                                                                 const NeighborGroups& groups,
+                                                                 unsigned block,
+                                                                 CellDRMapping const (*cellDrMapping)[4],
+                                                                 real* (*timeIntegrated)[4]) {
+  // The anelastic update needs the contributions of all faces at once, hence cell-wise
+  for (unsigned cell = groups.blockBegin(block); cell < groups.blockEnd(block); ++cell) {
+    auto data = loader.entry(cell);
+
+    real* faceNeighbors_prefetch[4];
+    for (unsigned face = 0; face < 4; ++face) {
+      faceNeighbors_prefetch[face] = (data.cellInformation().faceTypes[face] != FaceType::dynamicRupture) ?
+                                     timeIntegrated[cell][face] :
+                                     cellDrMapping[cell][face].godunov;
+    }
+
+    computeNeighborsIntegral(data, cellDrMapping[cell], timeIntegrated[cell], faceNeighbors_prefetch);
+  }
+}
+
 void seissol::kernels::Neighbor::flopsNeighborsIntegral(const FaceType i_faceTypes[4],
                                                         const int i_neighboringIndices[4][2],
                                                         CellDRMapping const (&cellDrMapping)[4],
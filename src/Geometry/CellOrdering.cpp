@@ -0,0 +1,165 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2024, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Locality-preserving orderings of cells
+ **/
+
+#include "CellOrdering.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <queue>
+
+namespace seissol::geometry {
+
+std::uint64_t hilbertIndex(std::array<std::uint32_t, 3> coords, unsigned int bits) {
+  // J. Skilling, Programming the Hilbert curve, AIP Conference Proceedings 707 (2004)
+  const std::uint32_t highestBit = 1U << (bits - 1);
+
+  // Inverse undo of the excess work
+  for (std::uint32_t q = highestBit; q > 1; q >>= 1) {
+    const std::uint32_t p = q - 1;
+    for (int i = 0; i < 3; ++i) {
+      if ((coords[i] & q) != 0) {
+        coords[0] ^= p;
+      } else {
+        const std::uint32_t t = (coords[0] ^ coords[i]) & p;
+        coords[0] ^= t;
+        coords[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < 3; ++i) {
+    coords[i] ^= coords[i - 1];
+  }
+  std::uint32_t t = 0;
+  for (std::uint32_t q = highestBit; q > 1; q >>= 1) {
+    if ((coords[2] & q) != 0) {
+      t ^= q - 1;
+    }
+  }
+  for (int i = 0; i < 3; ++i) {
+    coords[i] ^= t;
+  }
+
+  // Interleave the bits of the transposed index
+  std::uint64_t index = 0;
+  for (int bit = bits - 1; bit >= 0; --bit) {
+    for (int i = 0; i < 3; ++i) {
+      index = (index << 1) | ((coords[i] >> bit) & 1U);
+    }
+  }
+  return index;
+}
+
+std::vector<std::size_t> hilbertOrder(const std::vector<Eigen::Vector3d>& points) {
+  constexpr unsigned int Bits = 21;
+  constexpr double MaxCoord = static_cast<double>((1U << Bits) - 1);
+
+  Eigen::Vector3d min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d max = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+  for (const auto& point : points) {
+    min = min.cwiseMin(point);
+    max = max.cwiseMax(point);
+  }
+  // The same scaling in all dimensions, s.t. the curve is not distorted
+  const double extent = (max - min).maxCoeff();
+  const double scale = extent > 0 ? MaxCoord / extent : 0;
+
+  std::vector<std::uint64_t> indices(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    std::array<std::uint32_t, 3> coords;
+    for (int dim = 0; dim < 3; ++dim) {
+      coords[dim] = static_cast<std::uint32_t>((points[i](dim) - min(dim)) * scale);
+    }
+    indices[i] = hilbertIndex(coords, Bits);
+  }
+
+  std::vector<std::size_t> order(points.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&indices](std::size_t a, std::size_t b) {
+    return indices[a] < indices[b];
+  });
+  return order;
+}
+
+std::vector<std::size_t>
+    reverseCuthillMcKeeOrder(const std::vector<std::vector<std::size_t>>& adjacency) {
+  const std::size_t numNodes = adjacency.size();
+  auto byDegree = [&adjacency](std::size_t a, std::size_t b) {
+    return adjacency[a].size() < adjacency[b].size() ||
+           (adjacency[a].size() == adjacency[b].size() && a < b);
+  };
+
+  // Start each connected component with a node of minimal degree
+  std::vector<std::size_t> startNodes(numNodes);
+  std::iota(startNodes.begin(), startNodes.end(), 0);
+  std::sort(startNodes.begin(), startNodes.end(), byDegree);
+
+  std::vector<std::size_t> order;
+  order.reserve(numNodes);
+  std::vector<bool> visited(numNodes, false);
+  std::vector<std::size_t> neighbors;
+  for (const auto start : startNodes) {
+    if (visited[start]) {
+      continue;
+    }
+
+    // Breadth-first search, visiting the neighbours by increasing degree
+    visited[start] = true;
+    std::size_t next = order.size();
+    order.push_back(start);
+    while (next < order.size()) {
+      const std::size_t node = order[next++];
+      neighbors.clear();
+      for (const auto neighbor : adjacency[node]) {
+        if (!visited[neighbor]) {
+          visited[neighbor] = true;
+          neighbors.push_back(neighbor);
+        }
+      }
+      std::sort(neighbors.begin(), neighbors.end(), byDegree);
+      order.insert(order.end(), neighbors.begin(), neighbors.end());
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+} // namespace seissol::geometry
@@ -0,0 +1,77 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2024, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Locality-preserving orderings of cells
+ **/
+
+#ifndef GEOMETRY_CELLORDERING_H_
+#define GEOMETRY_CELLORDERING_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace seissol::geometry {
+
+/**
+ * Returns the index of a grid point along a Hilbert curve through the grid.
+ *
+ * @param coords The coordinates of the point, each less than 2^bits
+ * @param bits The number of bits per coordinate (at most 21)
+ */
+std::uint64_t hilbertIndex(std::array<std::uint32_t, 3> coords, unsigned int bits);
+
+/**
+ * Returns the indices of the points in the order of a Hilbert curve through their bounding box.
+ */
+std::vector<std::size_t> hilbertOrder(const std::vector<Eigen::Vector3d>& points);
+
+/**
+ * Returns the reverse Cuthill-McKee order of the nodes of a graph.
+ *
+ * Neighbouring nodes end up close to each other in the order, which keeps the accesses to
+ * the neighbours of a node local.
+ *
+ * @param adjacency The neighbours of each node
+ */
+std::vector<std::size_t>
+    reverseCuthillMcKeeOrder(const std::vector<std::vector<std::size_t>>& adjacency);
+
+} // namespace seissol::geometry
+
+#endif // GEOMETRY_CELLORDERING_H_
@@ -0,0 +1,197 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2024, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Bounding volume hierarchy for locating points in a tetrahedral mesh
+ **/
+
+#include "PointLocator.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "MeshTools.h"
+
+namespace seissol::geometry {
+
+namespace {
+// Relative padding of the bounding boxes, s.t. points on a face are not missed due to round-off
+constexpr double BoxPadding = 1e-10;
+
+bool boxContains(const std::array<std::array<double, 3>, 2>& box, const Eigen::Vector3d& point) {
+  for (int dim = 0; dim < 3; ++dim) {
+    if (point(dim) < box[0][dim] || point(dim) > box[1][dim]) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+PointLocator::PointLocator(const std::vector<Vertex>& vertices,
+                           const std::vector<Element>& elements)
+    : elements(elements), planeEquations(elements.size()), elementOrder(elements.size()) {
+  std::vector<Box> boxes(elements.size());
+  std::vector<Eigen::Vector3d> centers(elements.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t elem = 0; elem < elements.size(); ++elem) {
+    for (int face = 0; face < 4; ++face) {
+      VrtxCoords n, p;
+      MeshTools::pointOnPlane(elements[elem], face, vertices, p);
+      MeshTools::normal(elements[elem], face, vertices, n);
+      for (int i = 0; i < 3; ++i) {
+        planeEquations[elem][face][i] = n[i];
+      }
+      planeEquations[elem][face][3] = -MeshTools::dot(n, p);
+    }
+
+    auto& box = boxes[elem];
+    box[0].fill(std::numeric_limits<double>::max());
+    box[1].fill(std::numeric_limits<double>::lowest());
+    for (const auto vertex : elements[elem].vertices) {
+      for (int dim = 0; dim < 3; ++dim) {
+        box[0][dim] = std::min(box[0][dim], vertices[vertex].coords[dim]);
+        box[1][dim] = std::max(box[1][dim], vertices[vertex].coords[dim]);
+      }
+    }
+    double extent = 0.0;
+    for (int dim = 0; dim < 3; ++dim) {
+      extent = std::max(extent, box[1][dim] - box[0][dim]);
+      centers[elem](dim) = 0.5 * (box[0][dim] + box[1][dim]);
+    }
+    for (int dim = 0; dim < 3; ++dim) {
+      box[0][dim] -= BoxPadding * extent;
+      box[1][dim] += BoxPadding * extent;
+    }
+  }
+
+  std::iota(elementOrder.begin(), elementOrder.end(), 0);
+  if (!elements.empty()) {
+    nodes.reserve(2 * (elements.size() / MaxLeafSize + 1));
+    build(0, elements.size(), boxes, centers);
+  }
+}
+
+std::size_t PointLocator::build(std::size_t begin,
+                                std::size_t end,
+                                const std::vector<Box>& boxes,
+                                const std::vector<Eigen::Vector3d>& centers) {
+  const auto nodeIndex = nodes.size();
+  nodes.emplace_back();
+
+  Box box;
+  box[0].fill(std::numeric_limits<double>::max());
+  box[1].fill(std::numeric_limits<double>::lowest());
+  Eigen::Vector3d centerMin = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d centerMax = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+  for (auto i = begin; i < end; ++i) {
+    const auto elem = elementOrder[i];
+    for (int dim = 0; dim < 3; ++dim) {
+      box[0][dim] = std::min(box[0][dim], boxes[elem][0][dim]);
+      box[1][dim] = std::max(box[1][dim], boxes[elem][1][dim]);
+    }
+    centerMin = centerMin.cwiseMin(centers[elem]);
+    centerMax = centerMax.cwiseMax(centers[elem]);
+  }
+  nodes[nodeIndex].box = box;
+
+  if (end - begin <= MaxLeafSize) {
+    nodes[nodeIndex].offset = begin;
+    nodes[nodeIndex].count = end - begin;
+    return nodeIndex;
+  }
+
+  // Split at the median of the element centers along the longest axis
+  int axis = 0;
+  (centerMax - centerMin).maxCoeff(&axis);
+  const auto middle = begin + (end - begin) / 2;
+  std::nth_element(elementOrder.begin() + begin,
+                   elementOrder.begin() + middle,
+                   elementOrder.begin() + end,
+                   [&](std::size_t a, std::size_t b) { return centers[a](axis) < centers[b](axis); });
+
+  build(begin, middle, boxes, centers);
+  const auto right = build(middle, end, boxes, centers);
+  nodes[nodeIndex].offset = right;
+  nodes[nodeIndex].count = 0;
+  return nodeIndex;
+}
+
+bool PointLocator::contains(std::size_t element, const Eigen::Vector3d& point) const {
+  for (const auto& plane : planeEquations[element]) {
+    const double distance =
+        plane[0] * point(0) + plane[1] * point(1) + plane[2] * point(2) + plane[3];
+    if (distance > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::optional<std::size_t> PointLocator::findElement(const Eigen::Vector3d& point) const {
+  std::optional<std::size_t> found;
+  if (nodes.empty()) {
+    return found;
+  }
+
+  // The median split bounds the depth of the tree by log2(#elements)
+  std::array<std::size_t, 64> stack;
+  std::size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const auto& node = nodes[stack[--stackSize]];
+    if (!boxContains(node.box, point)) {
+      continue;
+    }
+    if (node.count == 0) {
+      stack[stackSize++] = node.offset;
+      stack[stackSize++] = &node - nodes.data() + 1;
+      continue;
+    }
+    for (auto i = node.offset; i < node.offset + node.count; ++i) {
+      const auto elem = elementOrder[i];
+      if (contains(elem, point) &&
+          (!found.has_value() || elements[elem].localId < elements[*found].localId)) {
+        found = elem;
+      }
+    }
+  }
+  return found;
+}
+
+} // namespace seissol::geometry
@@ -0,0 +1,101 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2024, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Bounding volume hierarchy for locating points in a tetrahedral mesh
+ **/
+
+#ifndef GEOMETRY_POINTLOCATOR_H_
+#define GEOMETRY_POINTLOCATOR_H_
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "MeshDefinition.h"
+
+namespace seissol::geometry {
+
+/**
+ * Finds the tetrahedra which contain given points.
+ *
+ * The bounding boxes of the elements are organized in a bounding volume hierarchy,
+ * s.t. a query only tests the O(log(elements)) elements whose bounding boxes contain the point.
+ * The index is immutable after construction; queries can be run concurrently.
+ */
+class PointLocator {
+  public:
+  PointLocator(const std::vector<Vertex>& vertices, const std::vector<Element>& elements);
+
+  /**
+   * Returns the index (in the element vector) of the element which contains the point.
+   * If the point lies on a face shared by several elements, the one with the smallest
+   * localId is returned.
+   */
+  std::optional<std::size_t> findElement(const Eigen::Vector3d& point) const;
+
+  private:
+  using Box = std::array<std::array<double, 3>, 2>;
+
+  struct Node {
+    Box box;
+    //! first element in elementOrder (leaf), or index of the right child (inner node)
+    std::size_t offset;
+    //! number of elements of a leaf; 0 for inner nodes, whose left child directly follows
+    std::size_t count;
+  };
+
+  static constexpr std::size_t MaxLeafSize = 8;
+
+  std::size_t build(std::size_t begin,
+                    std::size_t end,
+                    const std::vector<Box>& boxes,
+                    const std::vector<Eigen::Vector3d>& centers);
+
+  bool contains(std::size_t element, const Eigen::Vector3d& point) const;
+
+  const std::vector<Element>& elements;
+
+  //! plane equations (normal and offset) of the four faces of each element
+  std::vector<std::array<std::array<double, 4>, 4>> planeEquations;
+  std::vector<std::size_t> elementOrder;
+  std::vector<Node> nodes;
+};
+
+} // namespace seissol::geometry
+
+#endif // GEOMETRY_POINTLOCATOR_H_
@@ -43,6 +43,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -60,6 +61,11 @@ class VariableSubsampler {
   private:
   std::vector<basisFunction::SampledBasisFunctions<T>> m_BasisFunctions;
 
+  using Matrix = Eigen::Matrix<real, Eigen::Dynamic, Eigen::Dynamic>;
+
+  /** The basis functions sampled at the sub cells (sub cells x basis functions) */
+  Matrix m_basisMatrix;
+
   /** The original number of cells (without refinement) */
   const unsigned int m_numCells;
 
@@ -84,6 +90,21 @@ class VariableSubsampler {
                      unsigned int numAlignedDOF);
 
   void get(const real* inData, const unsigned int* cellMap, int variable, real* outData) const;
+
+  /**
+   * Evaluates several variables with one pass over the input data.
+   *
+   * The sub cell values of all variables of a cell are computed by a single matrix-matrix
+   * multiplication.
+   *
+   * @param variables The variables that should be evaluated
+   * @param outData One output buffer for each variable in <code>variables</code>
+   * @return False if a value is not finite
+   */
+  bool get(const real* inData,
+           const unsigned int* cellMap,
+           const std::vector<unsigned int>& variables,
+           real* const* outData) const;
 };
 
 //------------------------------------------------------------------------------
@@ -112,6 +133,13 @@ VariableSubsampler<T>::VariableSubsampler(unsigned int numCells,
 
   delete[] subCells;
   delete[] additionalVertices;
+
+  m_basisMatrix.resize(kSubCellsPerCell, m_BasisFunctions[0].getSize());
+  for (unsigned int i = 0; i < kSubCellsPerCell; i++) {
+    for (unsigned int j = 0; j < m_BasisFunctions[i].getSize(); j++) {
+      m_basisMatrix(i, j) = m_BasisFunctions[i].m_data[j];
+    }
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -135,6 +163,52 @@ void VariableSubsampler<T>::get(const real* inData,
 
 //------------------------------------------------------------------------------
 
+template <typename T>
+bool VariableSubsampler<T>::get(const real* inData,
+                                const unsigned int* cellMap,
+                                const std::vector<unsigned int>& variables,
+                                real* const* outData) const {
+  if (variables.empty()) {
+    return true;
+  }
+
+  // Only the variables up to the last requested one are evaluated
+  const unsigned int numVariables = *std::max_element(variables.begin(), variables.end()) + 1;
+  assert(numVariables <= kNumVariables);
+  const auto numBasisFunctions = m_basisMatrix.cols();
+
+  bool finite = true;
+#ifdef _OPENMP
+#pragma omp parallel reduction(&& : finite)
+#endif
+  {
+    Matrix subCellValues(kSubCellsPerCell, numVariables);
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (unsigned int c = 0; c < m_numCells; ++c) {
+      const Eigen::Map<const Matrix, 0, Eigen::OuterStride<>> dofs(
+          &inData[getInVarOffset(c, 0, cellMap)],
+          numBasisFunctions,
+          numVariables,
+          Eigen::OuterStride<>(kNumAlignedDOF));
+      subCellValues.noalias() = m_basisMatrix * dofs;
+
+      for (std::size_t i = 0; i < variables.size(); ++i) {
+        Eigen::Map<Eigen::Matrix<real, Eigen::Dynamic, 1>> out(&outData[i][getOutVarOffset(c, 0)],
+                                                               kSubCellsPerCell);
+        out = subCellValues.col(variables[i]);
+        finite = finite && out.allFinite();
+      }
+    }
+  }
+
+  return finite;
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace refinement
 } // namespace seissol
 
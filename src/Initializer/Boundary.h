@@ -19,10 +19,13 @@ namespace seissol {
 
 struct seissol::initializer::Boundary {
   Variable<BoundaryFaceInformation> faceInformation;
+  // Time expansions of the analytical boundary faces only, in the order of faceInformation
+  Bucket analyticalExpansions;
   
   void addTo(LTSTree& tree) {
     LayerMask mask = LayerMask(Ghost);
     tree.addVar(faceInformation, mask, 1, MEMKIND_BOUNDARY);
+    tree.addBucket(analyticalExpansions, ALIGNMENT, MEMKIND_BOUNDARY);
   }
 };
 #endif
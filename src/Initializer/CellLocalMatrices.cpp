@@ -41,6 +41,7 @@
 
 #include "CellLocalMatrices.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "Initializer/ParameterDB.h"
@@ -49,6 +50,7 @@
 #include "Equations/Setup.h"
 #include "Model/common.hpp"
 #include "Geometry/MeshTools.h"
+#include "Kernels/CellMatrices.h"
 #include "generated_code/tensor.h"
 #include "generated_code/kernel.h"
 #include <utils/logger.h>
@@ -56,25 +58,6 @@
 #include <device.h>
 #endif
 
-void setStarMatrix( real* i_AT,
-                    real* i_BT,
-                    real* i_CT,
-                    real  i_grad[3],
-                    real* o_starMatrix )
-{
-  for (unsigned idx = 0; idx < seissol::tensor::star::size(0); ++idx) {
-    o_starMatrix[idx] = i_grad[0] * i_AT[idx];
-  }
-
-  for (unsigned idx = 0; idx < seissol::tensor::star::size(1); ++idx) {
-    o_starMatrix[idx] += i_grad[1] * i_BT[idx];
-  }
-
-  for (unsigned idx = 0; idx < seissol::tensor::star::size(2); ++idx) {
-    o_starMatrix[idx] += i_grad[2] * i_CT[idx];
-  }
-}
-
 void seissol::initializer::initializeCellLocalMatrices( seissol::geometry::MeshReader const&      i_meshReader,
                                                          LTSTree*               io_ltsTree,
                                                          LTS*                   i_lts,
@@ -103,31 +86,7 @@ void seissol::initializer::initializeCellLocalMatrices( seissol::geometry::MeshR
     CellLocalInformation*       cellInformation         = it->var(i_lts->cellInformation);
 
 #ifdef _OPENMP
-  #pragma omp parallel
-    {
-#endif
-    real ATData[tensor::star::size(0)];
-    real ATtildeData[tensor::star::size(0)];
-    real BTData[tensor::star::size(1)];
-    real CTData[tensor::star::size(2)];
-    auto AT = init::star::view<0>::create(ATData);
-    // AT with elastic parameters in local coordinate system, used for flux kernel
-    auto ATtilde = init::star::view<0>::create(ATtildeData);
-    auto BT = init::star::view<0>::create(BTData);
-    auto CT = init::star::view<0>::create(CTData);
-
-    real TData[seissol::tensor::T::size()];
-    real TinvData[seissol::tensor::Tinv::size()];
-    auto T = init::T::view::create(TData);
-    auto Tinv = init::Tinv::view::create(TinvData);
-
-    real QgodLocalData[tensor::QgodLocal::size()];
-    real QgodNeighborData[tensor::QgodNeighbor::size()];
-    auto QgodLocal = init::QgodLocal::view::create(QgodLocalData);
-    auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
-    
-#ifdef _OPENMP
-    #pragma omp for schedule(static)
+    #pragma omp parallel for schedule(static)
 #endif
     for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
       unsigned clusterId = cellInformation[cell].clusterId;
@@ -137,9 +96,7 @@ void seissol::initializer::initializeCellLocalMatrices( seissol::geometry::MeshR
       real x[4];
       real y[4];
       real z[4];
-      real gradXi[3];
-      real gradEta[3];
-      real gradZeta[3];
+      real gradients[3][3];
 
       // Iterate over all 4 vertices of the tetrahedron
       for (unsigned vertex = 0; vertex < 4; ++vertex) {
@@ -149,14 +106,14 @@ void seissol::initializer::initializeCellLocalMatrices( seissol::geometry::MeshR
         z[vertex] = coords[2];
       }
 
-      seissol::transformations::tetrahedronGlobalToReferenceJacobian( x, y, z, gradXi, gradEta, gradZeta );
+      seissol::transformations::tetrahedronGlobalToReferenceJacobian( x, y, z, gradients[0], gradients[1], gradients[2] );
 
-      seissol::model::getTransposedCoefficientMatrix( material[cell].local, 0, AT );
-      seissol::model::getTransposedCoefficientMatrix( material[cell].local, 1, BT );
-      seissol::model::getTransposedCoefficientMatrix( material[cell].local, 2, CT );
-      setStarMatrix(ATData, BTData, CTData, gradXi, localIntegration[cell].starMatrices[0]);
-      setStarMatrix(ATData, BTData, CTData, gradEta, localIntegration[cell].starMatrices[1]);
-      setStarMatrix(ATData, BTData, CTData, gradZeta, localIntegration[cell].starMatrices[2]);
+#ifdef USE_COMPACT_INTEGRATION_DATA
+      // the star matrices are computed on the fly from the material
+      std::copy_n(&gradients[0][0], 9, &localIntegration[cell].gradients[0][0]);
+#else
+      seissol::kernels::computeStarMatrices(material[cell], gradients, localIntegration[cell].starMatrices);
+#endif
 
       double volume = MeshTools::volume(elements[meshId], vertices);
 
@@ -170,53 +127,27 @@ void seissol::initializer::initializeCellLocalMatrices( seissol::geometry::MeshR
         MeshTools::normalize(tangent1, tangent1);
         MeshTools::normalize(tangent2, tangent2);
 
-        real NLocalData[6*6];
-        seissol::model::getBondMatrix(normal, tangent1, tangent2, NLocalData);
-        if (material[cell].local.getMaterialType() == seissol::model::MaterialType::anisotropic) {
-          seissol::model::getTransposedGodunovState(  seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)),
-                                                      seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].neighbor[side])),
-                                                      cellInformation[cell].faceTypes[side],
-                                                      QgodLocal,
-                                                      QgodNeighbor );
-          seissol::model::getTransposedCoefficientMatrix( seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)), 0, ATtilde );
-        } else {
-          seissol::model::getTransposedGodunovState(  material[cell].local,
-                                                      material[cell].neighbor[side],     
-                                                      cellInformation[cell].faceTypes[side],
-                                                      QgodLocal,
-                                                      QgodNeighbor );
-          seissol::model::getTransposedCoefficientMatrix( material[cell].local, 0, ATtilde );
-        }
-
-        // Calculate transposed T instead
-        seissol::model::getFaceRotationMatrix(normal, tangent1, tangent2, T, Tinv);
-
         // Scale with |S_side|/|J| and multiply with -1 as the flux matrices
         // must be subtracted.
         real fluxScale = -2.0 * surface / (6.0 * volume);
 
-        kernel::computeFluxSolverLocal localKrnl;
-        localKrnl.fluxScale = fluxScale;
-        localKrnl.AplusT = localIntegration[cell].nApNm1[side];
-        localKrnl.QgodLocal = QgodLocalData;
-        localKrnl.T = TData;
-        localKrnl.Tinv = TinvData;
-        localKrnl.star(0) = ATtildeData;
-        localKrnl.execute();
-        
-        kernel::computeFluxSolverNeighbor neighKrnl;
-        neighKrnl.fluxScale = fluxScale;
-        neighKrnl.AminusT = neighboringIntegration[cell].nAmNm1[side];
-        neighKrnl.QgodNeighbor = QgodNeighborData;
-        neighKrnl.T = TData;
-        neighKrnl.Tinv = TinvData;
-        neighKrnl.star(0) = ATtildeData;
-        if (cellInformation[cell].faceTypes[side] == FaceType::dirichlet ||
-            cellInformation[cell].faceTypes[side] == FaceType::freeSurfaceGravity) {
-          // Already rotated!
-          neighKrnl.Tinv = init::identityT::Values;
-        }
-        neighKrnl.execute();
+#ifdef USE_COMPACT_INTEGRATION_DATA
+        // the flux solvers are computed on the fly from the material and the face geometry
+        std::copy_n(normal, 3, localIntegration[cell].faceFrames[side][0]);
+        std::copy_n(tangent1, 3, localIntegration[cell].faceFrames[side][1]);
+        std::copy_n(tangent2, 3, localIntegration[cell].faceFrames[side][2]);
+        localIntegration[cell].fluxScales[side] = fluxScale;
+#else
+        seissol::kernels::computeFluxSolvers( material[cell],
+                                              side,
+                                              cellInformation[cell].faceTypes[side],
+                                              normal,
+                                              tangent1,
+                                              tangent2,
+                                              fluxScale,
+                                              localIntegration[cell].nApNm1[side],
+                                              neighboringIntegration[cell].nAmNm1[side] );
+#endif
       }
 
       seissol::model::initializeSpecificLocalData(  material[cell].local,
@@ -225,11 +156,7 @@ void seissol::initializer::initializeCellLocalMatrices( seissol::geometry::MeshR
 
       seissol::model::initializeSpecificNeighborData( material[cell].local,
                                                       &neighboringIntegration[cell].specific );
-
     }
-#ifdef _OPENMP
-    }
-#endif
     ltsToMesh += it->getNumberOfCells();
   }
 }
@@ -0,0 +1,57 @@
+#ifndef SEISSOL_INITIALIZER_HALOFACELAYOUT_H_
+#define SEISSOL_INITIALIZER_HALOFACELAYOUT_H_
+
+#include <vector>
+#include <yateto.h>
+
+#include "Kernels/precision.hpp"
+#include "generated_code/tensor.h"
+
+namespace seissol::initializer {
+
+/**
+ * A cell of a copy or ghost region in the face-restricted halo exchange.
+ */
+struct HaloFaceCell {
+  //! time buffer or time derivatives of the cell
+  real* data;
+
+  //! true if data points to time derivatives
+  bool derivatives;
+
+  //! local face of the cell which is shared with the other rank; -1 if the volume data is sent
+  int face;
+
+  /**
+   * Number of reals this cell occupies in a packed region.
+   */
+  unsigned packedSize() const {
+    if (face < 0) {
+      return derivatives ? yateto::computeFamilySize<tensor::dQ>() : tensor::I::size();
+    }
+    return derivatives ? yateto::computeFamilySize<tensor::facedQ>() : tensor::faceI::size();
+  }
+};
+
+/**
+ * Layout of the face-restricted halo exchange of a time cluster.
+ * The cells of a region are in the same order as in the copy and ghost regions of the
+ * MeshStructure; instead of the regions themselves, the packed face data is communicated.
+ */
+struct HaloFaceLayout {
+  //! cells of the copy regions, [region][cell]
+  std::vector<std::vector<HaloFaceCell>> copyRegions;
+
+  //! cells of the ghost regions, [region][cell]
+  std::vector<std::vector<HaloFaceCell>> ghostRegions;
+
+  //! sizes of the packed copy regions (in reals)
+  std::vector<unsigned> copyRegionSizes;
+
+  //! sizes of the packed ghost regions (in reals)
+  std::vector<unsigned> ghostRegionSizes;
+};
+
+} // namespace seissol::initializer
+
+#endif // SEISSOL_INITIALIZER_HALOFACELAYOUT_H_
@@ -1,6 +1,8 @@
 #include "Init.hpp"
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 
 #include "InitIO.hpp"
 #include "InitMesh.hpp"
@@ -10,6 +12,7 @@
 #include "Monitoring/Unit.hpp"
 #include "Numerical_aux/Statistics.h"
 #include "Parallel/MPI.h"
+#include "Parallel/Numa.h"
 #include "ResultWriter/ThreadsPinningWriter.h"
 #include "SeisSol.h"
 
@@ -42,6 +45,52 @@ static void reportDeviceMemoryStatus() {
 #endif
 }
 
+static void reportNumaPlacement(seissol::SeisSol& seissolInstance) {
+#ifndef ACL_DEVICE
+  const auto rank = seissol::MPI::mpi.rank();
+  auto& memoryManager = seissolInstance.getMemoryManager();
+
+  std::vector<std::size_t> bytesPerNode;
+  bool known = true;
+  for (const auto* tree : {memoryManager.getLtsTree(),
+                           memoryManager.getDynamicRuptureTree(),
+                           memoryManager.getBoundaryTree()}) {
+    known = tree->addBytesPerNumaNode(bytesPerNode) && known;
+  }
+  const auto threadsPerNode = seissol::parallel::loopThreadsPerNumaNode();
+  known = known && !threadsPerNode.empty();
+
+  // Memory on NUMA nodes without compute threads is always accessed remotely
+  std::size_t totalBytes = 0;
+  std::size_t remoteBytes = 0;
+  for (std::size_t node = 0; node < bytesPerNode.size(); ++node) {
+    totalBytes += bytesPerNode[node];
+    if (node >= threadsPerNode.size() || threadsPerNode[node] == 0) {
+      remoteBytes += bytesPerNode[node];
+    }
+  }
+  const double remoteFraction =
+      known && totalBytes > 0 ? remoteBytes / static_cast<double>(totalBytes) : 0.0;
+  const auto summary = seissol::statistics::parallelSummary(remoteFraction * 100.0);
+
+  if (!known) {
+    logInfo(rank) << "The NUMA placement of the LTS data is unknown.";
+    return;
+  }
+  for (std::size_t node = 0; node < std::max(bytesPerNode.size(), threadsPerNode.size()); ++node) {
+    const auto bytes = node < bytesPerNode.size() ? bytesPerNode[node] : 0;
+    const auto threads = node < threadsPerNode.size() ? threadsPerNode[node] : 0;
+    if (bytes > 0 || threads > 0) {
+      logInfo(rank) << "LTS data on NUMA node" << node << ":" << UnitByte.formatPrefix(bytes)
+                    << "with" << threads << "compute threads";
+    }
+  }
+  logInfo(rank) << "LTS data on NUMA nodes without compute threads (%):"
+                << " mean =" << summary.mean << " std =" << summary.std << " min =" << summary.min
+                << " median =" << summary.median << " max =" << summary.max;
+#endif
+}
+
 static void initSeisSol(seissol::SeisSol& seissolInstance) {
   const auto& seissolParams = seissolInstance.getSeisSolParameters();
 
@@ -63,6 +112,7 @@ static void initSeisSol(seissol::SeisSol& seissolInstance) {
 
 static void reportHardwareRelatedStatus(seissol::SeisSol& seissolInstance) {
   reportDeviceMemoryStatus();
+  reportNumaPlacement(seissolInstance);
 
   const auto& seissolParams = seissolInstance.getSeisSolParameters();
   writer::ThreadsPinningWriter pinningWriter(seissolParams.output.prefix);
@@ -76,6 +126,8 @@ static void closeSeisSol(seissol::SeisSol& seissolInstance) {
   seissolInstance.checkPointManager().close();
   seissolInstance.faultWriter().close();
   seissolInstance.freeSurfaceWriter().close();
+  seissolInstance.receiverWriter().close();
+  seissolInstance.pickpointWriter().close();
 
   // deallocate memory manager
   seissolInstance.deleteMemoryManager();
@@ -5,6 +5,7 @@
 #include "Initializer/BasicTypedefs.hpp"
 #include "SeisSol.h"
 #include <cstring>
+#include <limits>
 #include <vector>
 
 #include "Parallel/MPI.h"
@@ -17,6 +18,7 @@ static void setupCheckpointing(seissol::SeisSol& seissolInstance) {
 
   auto* lts = memoryManager.getLts();
   auto* ltsTree = memoryManager.getLtsTree();
+  auto* ltsLut = memoryManager.getLtsLut();
   auto* dynRup = memoryManager.getDynamicRupture();
   auto* dynRupTree = memoryManager.getDynamicRuptureTree();
 
@@ -46,6 +48,38 @@ static void setupCheckpointing(seissol::SeisSol& seissolInstance) {
   size_t numSides = seissolInstance.meshReader().getFault().size();
   unsigned int numBndGP = seissol::dr::misc::numberOfBoundaryGaussPoints;
 
+  if (seissolParams.output.checkpointParameters.backend ==
+      seissol::initializer::parameters::CheckpointingBackend::MPIO_GLOBAL) {
+    // Identify cells by their global id, and fault sides by the global id of the element and
+    // the face of the element, such that the checkpoint does not depend on the partitioning
+    const auto& elements = seissolInstance.meshReader().getElements();
+    const auto& fault = seissolInstance.meshReader().getFault();
+    constexpr auto InvalidId = seissol::checkpoint::CheckPoint::INVALID_ID;
+
+    const unsigned* ltsToMesh = ltsLut->getLtsToMeshLut(lts->dofs.mask);
+    std::vector<unsigned long> cellIds(ltsTree->getNumberOfCells(lts->dofs.mask));
+    for (std::size_t cell = 0; cell < cellIds.size(); ++cell) {
+      const unsigned meshId = ltsToMesh[cell];
+      cellIds[cell] = meshId == std::numeric_limits<unsigned>::max() ? InvalidId
+                                                                     : elements[meshId].globalId;
+    }
+
+    const auto* faceInformation = dynRupTree->var(dynRup->faceInformation);
+    std::vector<unsigned long> sideIds(2 * numSides, InvalidId);
+    for (std::size_t face = 0; face < numSides; ++face) {
+      const auto& faultFace = fault[faceInformation[face].meshFace];
+      if (faultFace.element >= 0) {
+        sideIds[2 * face] = 4 * elements[faultFace.element].globalId + faultFace.side;
+      }
+      if (faultFace.neighborElement >= 0) {
+        sideIds[2 * face + 1] =
+            4 * elements[faultFace.neighborElement].globalId + faultFace.neighborSide;
+      }
+    }
+
+    seissolInstance.checkPointManager().setGlobalIds(cellIds, sideIds);
+  }
+
   bool hasCheckpoint = seissolInstance.checkPointManager().init(
       reinterpret_cast<real*>(ltsTree->var(lts->dofs)),
       ltsTree->getNumberOfCells(lts->dofs.mask) * tensor::Q::size(),
@@ -173,7 +173,8 @@ static void readMeshPUML(const seissol::initializer::parameters::SeisSolParamete
                           static_cast<unsigned int>(seissolParams.timeStepping.lts.getRate()),
                           seissolParams.timeStepping.vertexWeight.weightElement,
                           seissolParams.timeStepping.vertexWeight.weightDynamicRupture,
-                          seissolParams.timeStepping.vertexWeight.weightFreeSurfaceWithGravity};
+                          seissolParams.timeStepping.vertexWeight.weightFreeSurfaceWithGravity,
+                          seissolParams.timeStepping.vertexWeight.costModelFileName};
 
   auto ltsWeights = getLtsWeightsImplementation(
       seissolParams.timeStepping.lts.getLtsWeightsType(), config, seissolInstance);
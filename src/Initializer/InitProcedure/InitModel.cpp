@@ -31,10 +31,12 @@ using Plasticity = seissol::model::Plasticity;
 template <typename T>
 static std::vector<T> queryDB(seissol::initializer::QueryGenerator* queryGen,
                               const std::string& fileName,
+                              const std::string& cacheDirectory,
                               size_t size) {
   std::vector<T> vectorDB(size);
   seissol::initializer::MaterialParameterDB<T> parameterDB;
   parameterDB.setMaterialVector(&vectorDB);
+  parameterDB.setCacheDirectory(cacheDirectory);
   parameterDB.evaluateModel(fileName, queryGen);
   return vectorDB;
 }
@@ -79,21 +81,30 @@ void initializeCellMaterial(seissol::SeisSol& seissolInstance) {
   seissol::initializer::QueryGenerator* queryGen =
       getBestQueryGenerator(seissol::initializer::CellToVertexArray::fromMeshReader(meshReader));
   auto materialsDB = queryDB<Material_t>(
-      queryGen, seissolParams.model.materialFileName, meshReader.getElements().size());
+      queryGen,
+      seissolParams.model.materialFileName,
+      seissolParams.model.easiCacheDirectory,
+      meshReader.getElements().size());
 
   // plasticity (if needed)
   std::vector<Plasticity> plasticityDB;
   if (seissolParams.model.plasticity) {
     // plasticity information is only needed on all interior+copy cells.
     plasticityDB = queryDB<Plasticity>(
-        queryGen, seissolParams.model.materialFileName, meshReader.getElements().size());
+        queryGen,
+        seissolParams.model.materialFileName,
+        seissolParams.model.easiCacheDirectory,
+        meshReader.getElements().size());
   }
 
   // material retrieval for ghost layers
   seissol::initializer::QueryGenerator* queryGenGhost = getBestQueryGenerator(
       seissol::initializer::CellToVertexArray::fromVectors(ghostVertices, ghostGroups));
   auto materialsDBGhost = queryDB<Material_t>(
-      queryGenGhost, seissolParams.model.materialFileName, ghostVertices.size());
+      queryGenGhost,
+      seissolParams.model.materialFileName,
+      seissolParams.model.easiCacheDirectory,
+      ghostVertices.size());
 
 #if defined(USE_VISCOELASTIC) || defined(USE_VISCOELASTIC2)
   // we need to compute all model parameters before we can use them...
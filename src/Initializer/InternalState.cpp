@@ -181,3 +181,32 @@ void seissol::initializer::InternalState::setUpInteriorPointers(       unsigned
                        o_buffers,
                        o_derivatives );
 }
+
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+void seissol::initializer::InternalState::setUpCompressedInteriorPointers(       unsigned int                  i_numberOfInteriorCells,
+                                                                            const struct CellLocalInformation  *i_cellLocalInformation,
+                                                                                  real                         *i_derivativesMemory,
+                                                                                  float                        *i_buffersMemory,
+                                                                                  real                        **o_buffers,
+                                                                                  float                       **o_compressedBuffers,
+                                                                                  real                        **o_derivatives ) {
+  unsigned int l_bufferCounter = 0;
+  unsigned int l_derivativeCounter = 0;
+
+  for( unsigned int l_cell = 0; l_cell < i_numberOfInteriorCells; l_cell++ ) {
+    o_buffers[l_cell] = NULL;
+
+    if( (i_cellLocalInformation[l_cell].ltsSetup >> 8 ) % 2 ) {
+      o_compressedBuffers[l_cell] = i_buffersMemory + l_bufferCounter * tensor::I::size();
+      l_bufferCounter++;
+    }
+    else o_compressedBuffers[l_cell] = NULL;
+
+    if( (i_cellLocalInformation[l_cell].ltsSetup >> 9 ) % 2 ) {
+      o_derivatives[l_cell] = i_derivativesMemory + l_derivativeCounter * yateto::computeFamilySize<tensor::dQ>();
+      l_derivativeCounter++;
+    }
+    else o_derivatives[l_cell] = NULL;
+  }
+}
+#endif
@@ -128,6 +128,28 @@ class seissol::initializer::InternalState {
                                              real                         *i_interiorMemory,
                                              real                        **o_buffers,
                                              real                        **o_derivatives );
+
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    /**
+     * Sets up the pointers to the single precision time buffers and the time derivatives in the interior.
+     * The full precision buffers are not used in the interior and set to NULL.
+     *
+     * @param i_numberOfInteriorCells number of cells in the interior.
+     * @param i_cellLocalInformation cell local information (points to first cell local information in the interior).
+     * @param i_derivativesMemory chunk of memory for the time derivatives of the interior.
+     * @param i_buffersMemory chunk of memory for the single precision time buffers of the interior.
+     * @param o_buffers will be set to NULL.
+     * @param o_compressedBuffers will be set to the single precision time buffers; set to NULL if no buffer for a cell exists.
+     * @param o_derivatives will be set to time derivatives; set to NULL if no derivatives exist for a cell.
+     **/
+    static void setUpCompressedInteriorPointers(       unsigned int                  i_numberOfInteriorCells,
+                                                 const struct CellLocalInformation  *i_cellLocalInformation,
+                                                       real                         *i_derivativesMemory,
+                                                       float                        *i_buffersMemory,
+                                                       real                        **o_buffers,
+                                                       float                       **o_compressedBuffers,
+                                                       real                        **o_derivatives );
+#endif
 };
 
 #endif
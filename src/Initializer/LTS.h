@@ -104,6 +104,12 @@ struct seissol::initializer::LTS {
   Variable<real*[4]>                      faceDisplacements;
   Bucket                                  buffersDerivatives;
   Bucket                                  faceDisplacementsBuffer;
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+  // buffers of the interior cells, the ghost and copy layers are communicated in full precision
+  Variable<float*>                        compressedBuffers;
+  Variable<float*[4]>                     compressedFaceNeighbors;
+  Bucket                                  compressedBuffersStorage;
+#endif
 
 #ifdef ACL_DEVICE
   Variable<LocalIntegrationData>          localIntegrationOnDevice;
@@ -141,6 +147,11 @@ struct seissol::initializer::LTS {
 
     tree.addBucket(buffersDerivatives,                          PAGESIZE_HEAP,      MEMKIND_TIMEBUCKET );
     tree.addBucket(faceDisplacementsBuffer,                     PAGESIZE_HEAP,      MEMKIND_TIMEDOFS );
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    tree.addVar(       compressedBuffers,      LayerMask(),                 1,      MEMKIND_TIMEDOFS );
+    tree.addVar( compressedFaceNeighbors, LayerMask(Ghost),                 1,      MEMKIND_TIMEDOFS );
+    tree.addBucket(compressedBuffersStorage,                    PAGESIZE_HEAP,      MEMKIND_TIMEBUCKET );
+#endif
 
 #ifdef ACL_DEVICE
     tree.addVar(   localIntegrationOnDevice,   LayerMask(Ghost),  1,      seissol::memory::DeviceGlobalMemory);
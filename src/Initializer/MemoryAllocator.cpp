@@ -71,6 +71,12 @@
 #include "MemoryAllocator.h"
 #include "Parallel/MPI.h"
 
+#include <algorithm>
+#include <cstdint>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <utils/logger.h>
 
 #ifdef ACL_DEVICE
@@ -172,16 +178,55 @@ void seissol::memory::printMemoryAlignment( std::vector< std::vector<unsigned lo
 seissol::memory::ManagedAllocator::~ManagedAllocator()
 {
   for (AddressVector::const_iterator it = m_dataMemoryAddresses.begin(); it != m_dataMemoryAddresses.end(); ++it) {
-    seissol::memory::free(it->second, it->first);
+    if (it->mappedSize > 0) {
+      munmap(it->pointer, it->mappedSize);
+    } else {
+      seissol::memory::free(it->pointer, it->memkind);
+    }
   }
 
   // reset memory vectors
   m_dataMemoryAddresses.clear();
 }
 
+void* seissol::memory::mapPages(size_t size, size_t alignment, size_t& mappedSize) {
+  const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  alignment = std::max(alignment, pageSize);
+  if (alignment % pageSize != 0) {
+    return nullptr;
+  }
+  mappedSize = (size + pageSize - 1) / pageSize * pageSize;
+
+  // Map additional memory to be able to align the chunk and unmap the remainder
+  const size_t overallSize = mappedSize + alignment - pageSize;
+  void* mapping = mmap(nullptr, overallSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    return nullptr;
+  }
+  char* begin = static_cast<char*>(mapping);
+  const auto address = reinterpret_cast<uintptr_t>(begin);
+  char* aligned = begin + (alignment - address % alignment) % alignment;
+  if (aligned != begin) {
+    munmap(begin, aligned - begin);
+  }
+  char* end = begin + overallSize;
+  if (aligned + mappedSize != end) {
+    munmap(aligned + mappedSize, end - (aligned + mappedSize));
+  }
+  return aligned;
+}
+
 void* seissol::memory::ManagedAllocator::allocateMemory( size_t i_size, size_t i_alignment, enum Memkind i_memkind )
 {
+  if (i_memkind == Standard && i_size >= MapPagesThreshold) {
+    size_t mappedSize = 0;
+    void* l_ptrBuffer = mapPages(i_size, i_alignment, mappedSize);
+    if (l_ptrBuffer != nullptr) {
+      m_dataMemoryAddresses.push_back( Address{i_memkind, l_ptrBuffer, mappedSize} );
+      return l_ptrBuffer;
+    }
+  }
   void* l_ptrBuffer = seissol::memory::allocate(i_size, i_alignment, i_memkind);
-  m_dataMemoryAddresses.push_back( Address(i_memkind, l_ptrBuffer) );
+  m_dataMemoryAddresses.push_back( Address{i_memkind, l_ptrBuffer, 0} );
   return l_ptrBuffer;
 }
@@ -93,6 +93,16 @@ namespace seissol {
     void* allocate(size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard);
     void free(void* i_pointer, enum Memkind i_memkind = Standard);   
 
+    /**
+     * Maps fresh anonymous pages, which are aligned to the given alignment. The pages are released
+     * with munmap(pointer, mappedSize).
+     *
+     * @param mappedSize size of the mapping, i.e. size rounded up to full pages.
+     * @return pointer to the mapping, or nullptr if the alignment is no multiple of the page size
+     *         or if the mapping fails.
+     **/
+    void* mapPages(size_t size, size_t alignment, size_t& mappedSize);
+
     /**
      * Prints the memory alignment of in terms of relative start and ends in bytes.
      *
@@ -108,7 +118,12 @@ namespace seissol {
  **/
 class seissol::memory::ManagedAllocator {
   private:
-    typedef std::pair<enum Memkind, void*> Address; 
+    struct Address {
+      enum Memkind memkind;
+      void* pointer;
+      //! size of the mapping if the memory was mapped with mapPages, 0 otherwise
+      size_t mappedSize;
+    };
     typedef std::vector<Address>       AddressVector;
   
     //! holds all memory addresses, which point to data arrays and have been returned by mallocs calling functions of the memory allocator.
@@ -130,6 +145,13 @@ class seissol::memory::ManagedAllocator {
      * @return pointer, which points to the aligned memory of the given size.
      **/
     void* allocateMemory( size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard );
+
+    /**
+     * Large chunks of standard memory are mapped directly from the operating system instead of
+     * taking them from the heap, which may return pages that have already been touched (and hence
+     * placed on a NUMA node) before. Thus, the placement of the chunk is decided by the first touch.
+     **/
+    static constexpr size_t MapPagesThreshold = 2 * 1024 * 1024;
 };
 
 #endif
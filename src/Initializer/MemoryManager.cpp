@@ -71,6 +71,7 @@
 
 #include <unordered_set>
 #include <cmath>
+#include <limits>
 #include <type_traits>
 
 #ifdef _OPENMP
@@ -84,6 +85,8 @@
 #include "InternalState.h"
 #include "Kernels/common.hpp"
 #include "Kernels/Touch.h"
+#include "Parallel/Helper.hpp"
+#include "Parallel/MPI.h"
 #include "SeisSol.h"
 #include "generated_code/tensor.h"
 
@@ -319,6 +322,119 @@ void seissol::initializer::MemoryManager::initializeCommunicationStructure() {
     }
   }
 }
+
+void seissol::initializer::MemoryManager::initializeHaloFaceLayouts() {
+  real** ltsBuffers = m_ltsTree.var(m_lts.buffers);
+
+  // faces of the ghost cells (bit mask, indexed by the lts id) which are used by the copy cells
+  std::vector<unsigned char> usedFaces(m_ltsTree.getNumberOfCells(), 0);
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    Layer& copy = m_ltsTree.child(tc).child<Copy>();
+    CellLocalInformation* cellInformation = copy.var(m_lts.cellInformation);
+    for (unsigned cell = 0; cell < copy.getNumberOfCells(); ++cell) {
+      for (unsigned face = 0; face < 4; ++face) {
+        if (cellInformation[cell].faceTypes[face] == FaceType::regular ||
+            cellInformation[cell].faceTypes[face] == FaceType::periodic ||
+            cellInformation[cell].faceTypes[face] == FaceType::dynamicRupture) {
+          usedFaces[cellInformation[cell].faceNeighborIds[face]] |= 1 << cellInformation[cell].faceRelations[face][0];
+        }
+      }
+    }
+  }
+
+  // the face of a ghost cell is sent to the owner of the cell, iff exactly one face is used
+  std::vector<std::vector<std::vector<signed char>>> ghostFaces(m_ltsTree.numChildren());
+  std::vector<std::vector<std::vector<signed char>>> copyFaces(m_ltsTree.numChildren());
+  std::vector<MPI_Request> requests;
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    Layer& ghost = m_ltsTree.child(tc).child<Ghost>();
+    const auto ghostOffset = static_cast<unsigned>(ghost.var(m_lts.buffers) - ltsBuffers);
+    const MeshStructure& meshStructure = m_meshStructure[tc];
+
+    ghostFaces[tc].resize(meshStructure.numberOfRegions);
+    copyFaces[tc].resize(meshStructure.numberOfRegions);
+
+    unsigned l_offset = 0;
+    for (unsigned l_region = 0; l_region < meshStructure.numberOfRegions; ++l_region) {
+      auto& faces = ghostFaces[tc][l_region];
+      faces.resize(meshStructure.numberOfGhostRegionCells[l_region], -1);
+      for (unsigned l_cell = 0; l_cell < faces.size(); ++l_cell) {
+        const unsigned mask = usedFaces[ghostOffset + l_offset + l_cell];
+        for (int face = 0; face < 4; ++face) {
+          if (mask == (1u << face)) {
+            faces[l_cell] = face;
+          }
+        }
+      }
+      l_offset += meshStructure.numberOfGhostRegionCells[l_region];
+      copyFaces[tc][l_region].resize(meshStructure.numberOfCopyRegionCells[l_region]);
+
+      // the tags match the ones of the time data in the opposite direction
+      requests.emplace_back();
+      MPI_Isend(faces.data(),
+                static_cast<int>(faces.size()),
+                MPI_SIGNED_CHAR,
+                meshStructure.neighboringClusters[l_region][0],
+                timeData + meshStructure.receiveIdentifiers[l_region],
+                seissol::MPI::mpi.comm(),
+                &requests.back());
+      requests.emplace_back();
+      MPI_Irecv(copyFaces[tc][l_region].data(),
+                static_cast<int>(copyFaces[tc][l_region].size()),
+                MPI_SIGNED_CHAR,
+                meshStructure.neighboringClusters[l_region][0],
+                timeData + meshStructure.sendIdentifiers[l_region],
+                seissol::MPI::mpi.comm(),
+                &requests.back());
+    }
+  }
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+
+  unsigned long l_volumeSize = 0;
+  unsigned long l_packedSize = 0;
+  m_haloFaceLayouts.resize(m_ltsTree.numChildren());
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    Layer& ghost = m_ltsTree.child(tc).child<Ghost>();
+    Layer& copy = m_ltsTree.child(tc).child<Copy>();
+    const MeshStructure& meshStructure = m_meshStructure[tc];
+    HaloFaceLayout& layout = m_haloFaceLayouts[tc];
+
+    layout.copyRegions.resize(meshStructure.numberOfRegions);
+    layout.ghostRegions.resize(meshStructure.numberOfRegions);
+    layout.copyRegionSizes.resize(meshStructure.numberOfRegions, 0);
+    layout.ghostRegionSizes.resize(meshStructure.numberOfRegions, 0);
+
+    // the first cells of a region communicate derivatives, the remaining ones buffers
+    unsigned l_copyOffset = 0;
+    unsigned l_ghostOffset = 0;
+    for (unsigned l_region = 0; l_region < meshStructure.numberOfRegions; ++l_region) {
+      for (unsigned l_cell = 0; l_cell < meshStructure.numberOfCopyRegionCells[l_region]; ++l_cell) {
+        const bool derivatives = l_cell < meshStructure.numberOfCommunicatedCopyRegionDerivatives[l_region];
+        real* data = derivatives ? copy.var(m_lts.derivatives)[l_copyOffset + l_cell]
+                                 : copy.var(m_lts.buffers)[l_copyOffset + l_cell];
+        const HaloFaceCell cell{data, derivatives, copyFaces[tc][l_region][l_cell]};
+        layout.copyRegions[l_region].push_back(cell);
+        layout.copyRegionSizes[l_region] += cell.packedSize();
+      }
+      for (unsigned l_cell = 0; l_cell < meshStructure.numberOfGhostRegionCells[l_region]; ++l_cell) {
+        const bool derivatives = l_cell < meshStructure.numberOfGhostRegionDerivatives[l_region];
+        real* data = derivatives ? ghost.var(m_lts.derivatives)[l_ghostOffset + l_cell]
+                                 : ghost.var(m_lts.buffers)[l_ghostOffset + l_cell];
+        const HaloFaceCell cell{data, derivatives, ghostFaces[tc][l_region][l_cell]};
+        layout.ghostRegions[l_region].push_back(cell);
+        layout.ghostRegionSizes[l_region] += cell.packedSize();
+      }
+      l_copyOffset += meshStructure.numberOfCopyRegionCells[l_region];
+      l_ghostOffset += meshStructure.numberOfGhostRegionCells[l_region];
+
+      l_volumeSize += meshStructure.copyRegionSizes[l_region];
+      l_packedSize += layout.copyRegionSizes[l_region];
+    }
+  }
+
+  logInfo(seissol::MPI::mpi.rank()) << "Face-restricted halo exchange: sending" << l_packedSize
+                                    << "instead of" << l_volumeSize << "reals per copy layer update.";
+}
 #endif
 
 void seissol::initializer::MemoryManager::initializeFaceNeighbors( unsigned    cluster,
@@ -336,9 +452,16 @@ void seissol::initializer::MemoryManager::initializeFaceNeighbors( unsigned    c
   real** derivatives = m_ltsTree.var(m_lts.derivatives);  // faceNeighborIds are ltsIds and not layer-local
   real *(*faceNeighbors)[4] = layer.var(m_lts.faceNeighbors);
   CellLocalInformation* cellInformation = layer.var(m_lts.cellInformation);
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+  float** compressedBuffers = m_ltsTree.var(m_lts.compressedBuffers);
+  float *(*compressedFaceNeighbors)[4] = layer.var(m_lts.compressedFaceNeighbors);
+#endif
 
   for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
     for (unsigned face = 0; face < 4; ++face) {
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+      compressedFaceNeighbors[cell][face] = nullptr;
+#endif
       if (cellInformation[cell].faceTypes[face] == FaceType::regular ||
 	  cellInformation[cell].faceTypes[face] == FaceType::periodic ||
 	  cellInformation[cell].faceTypes[face] == FaceType::dynamicRupture) {
@@ -349,6 +472,12 @@ void seissol::initializer::MemoryManager::initializeFaceNeighbors( unsigned    c
         // neighboring cell provides a time buffer
         else {
           faceNeighbors[cell][face] = buffers[ cellInformation[cell].faceNeighborIds[face] ];
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+          // interior neighbors provide their buffer in single precision
+          compressedFaceNeighbors[cell][face] = compressedBuffers[ cellInformation[cell].faceNeighborIds[face] ];
+          assert(faceNeighbors[cell][face] != nullptr || compressedFaceNeighbors[cell][face] != nullptr);
+          continue;
+#endif
         }
         assert(faceNeighbors[cell][face] != nullptr);
       }
@@ -359,6 +488,11 @@ void seissol::initializer::MemoryManager::initializeFaceNeighbors( unsigned    c
 	       cellInformation[cell].faceTypes[face] == FaceType::analytical) {
         if( (cellInformation[cell].ltsSetup >> face) % 2 == 0 ) { // free surface on buffers
           faceNeighbors[cell][face] = layer.var(m_lts.buffers)[cell];
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+          compressedFaceNeighbors[cell][face] = layer.var(m_lts.compressedBuffers)[cell];
+          assert(faceNeighbors[cell][face] != nullptr || compressedFaceNeighbors[cell][face] != nullptr);
+          continue;
+#endif
         }
         else { // free surface on derivatives
           faceNeighbors[cell][face] = layer.var(m_lts.derivatives)[cell];
@@ -411,6 +545,15 @@ void seissol::initializer::MemoryManager::initializeBuffersDerivatives() {
     /*
      * Interior
      */
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    InternalState::setUpCompressedInteriorPointers( m_meshStructure[tc].numberOfInteriorCells,
+                                                    cluster.child<Interior>().var(m_lts.cellInformation),
+                                                    static_cast<real*>(cluster.child<Interior>().bucket(m_lts.buffersDerivatives)),
+                                                    static_cast<float*>(cluster.child<Interior>().bucket(m_lts.compressedBuffersStorage)),
+                                                    cluster.child<Interior>().var(m_lts.buffers),
+                                                    cluster.child<Interior>().var(m_lts.compressedBuffers),
+                                                    cluster.child<Interior>().var(m_lts.derivatives) );
+#else
     InternalState::setUpInteriorPointers( m_meshStructure[tc].numberOfInteriorCells,
                                           cluster.child<Interior>().var(m_lts.cellInformation),
                                           m_numberOfInteriorBuffers[tc],
@@ -418,6 +561,7 @@ void seissol::initializer::MemoryManager::initializeBuffersDerivatives() {
                                           static_cast<real*>(cluster.child<Interior>().bucket(m_lts.buffersDerivatives)),
                                           cluster.child<Interior>().var(m_lts.buffers),
                                           cluster.child<Interior>().var(m_lts.derivatives)  );
+#endif
   }
 }
 
@@ -499,20 +643,27 @@ void seissol::initializer::MemoryManager::fixateBoundaryLtsTree() {
     CellLocalInformation* cellInformation = layer->var(m_lts.cellInformation);
 
     unsigned numberOfBoundaryFaces = 0;
+    unsigned numberOfAnalyticalFaces = 0;
 #ifdef _OPENMP
-    #pragma omp parallel for schedule(static) reduction(+ : numberOfBoundaryFaces)
+    #pragma omp parallel for schedule(static) reduction(+ : numberOfBoundaryFaces, numberOfAnalyticalFaces)
 #endif // _OPENMP
     for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
       for (unsigned face = 0; face < 4; ++face) {
         if (requiresNodalFlux(cellInformation[cell].faceTypes[face])) {
           ++numberOfBoundaryFaces;
         }
+        if (cellInformation[cell].faceTypes[face] == FaceType::analytical) {
+          ++numberOfAnalyticalFaces;
+        }
       }
     }
     boundaryLayer->setNumberOfCells(numberOfBoundaryFaces);
+    boundaryLayer->setBucketSize(m_boundary.analyticalExpansions,
+                                 numberOfAnalyticalFaces * sizeof(AnalyticalBoundaryExpansion));
   }
   m_boundaryTree.allocateVariables();
   m_boundaryTree.touchVariables();
+  m_boundaryTree.allocateBuckets();
 
   // The boundary tree is now allocated, now we only need to map from cell lts
   // to face lts.
@@ -523,8 +674,14 @@ void seissol::initializer::MemoryManager::fixateBoundaryLtsTree() {
     auto* cellInformation = layer->var(m_lts.cellInformation);
     auto* boundaryMapping = layer->var(m_lts.boundaryMapping);
     auto* faceInformation = boundaryLayer->var(m_boundary.faceInformation);
+    AnalyticalBoundaryExpansion* analyticalExpansions = nullptr;
+    if (boundaryLayer->getBucketSize(m_boundary.analyticalExpansions) > 0) {
+      analyticalExpansions = static_cast<AnalyticalBoundaryExpansion*>(
+          boundaryLayer->bucket(m_boundary.analyticalExpansions));
+    }
 
     auto boundaryFace = 0;
+    auto analyticalFace = 0;
     for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
       for (unsigned face = 0; face < 4; ++face) {
         if (requiresNodalFlux(cellInformation[cell].faceTypes[face])) {
@@ -533,6 +690,16 @@ void seissol::initializer::MemoryManager::fixateBoundaryLtsTree() {
           boundaryMapping[cell][face].TinvData = faceInformation[boundaryFace].TinvData;
           boundaryMapping[cell][face].easiBoundaryMap = faceInformation[boundaryFace].easiBoundaryMap;
           boundaryMapping[cell][face].easiBoundaryConstant = faceInformation[boundaryFace].easiBoundaryConstant;
+          if (cellInformation[cell].faceTypes[face] == FaceType::analytical) {
+            auto& expansion = analyticalExpansions[analyticalFace];
+            // no expansion has been computed yet
+            expansion.start = std::numeric_limits<double>::infinity();
+            expansion.end = -std::numeric_limits<double>::infinity();
+            boundaryMapping[cell][face].analyticalExpansion = &expansion;
+            ++analyticalFace;
+          } else {
+            boundaryMapping[cell][face].analyticalExpansion = nullptr;
+          }
           ++boundaryFace;
         } else {
           boundaryMapping[cell][face].nodes = nullptr;
@@ -540,6 +707,7 @@ void seissol::initializer::MemoryManager::fixateBoundaryLtsTree() {
           boundaryMapping[cell][face].TinvData = nullptr;
           boundaryMapping[cell][face].easiBoundaryMap = nullptr;
           boundaryMapping[cell][face].easiBoundaryConstant = nullptr;
+          boundaryMapping[cell][face].analyticalExpansion = nullptr;
         }
       }
     }
@@ -698,7 +866,13 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
       l_copySize     += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfCopyRegionDerivatives[tc][l_region];
     }
 #endif // USE_MPI
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    // the interior buffers are stored separately in single precision
+    cluster.child<Interior>().setBucketSize(m_lts.compressedBuffersStorage,
+                                            sizeof(float) * tensor::Q::size() * m_numberOfInteriorBuffers[tc]);
+#else
     l_interiorSize += sizeof(real) * tensor::Q::size() * m_numberOfInteriorBuffers[tc];
+#endif
     l_interiorSize += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfInteriorDerivatives[tc];
 
     cluster.child<Ghost>().setBucketSize(m_lts.buffersDerivatives, l_ghostSize);
@@ -739,12 +913,21 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
     real** buffers = it->var(m_lts.buffers);
     real** derivatives = it->var(m_lts.derivatives);
     kernels::touchBuffersDerivatives(buffers, derivatives, it->getNumberOfCells());
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    kernels::touchCompressedBuffers(it->var(m_lts.compressedBuffers), it->getNumberOfCells());
+#endif
   }
 #endif
 
 #ifdef USE_MPI
   // initialize the communication structure
   initializeCommunicationStructure();
+
+#ifndef ACL_DEVICE
+  if (useFaceRestrictedMpi()) {
+    initializeHaloFaceLayouts();
+  }
+#endif // ACL_DEVICE
 #endif
 
   initializeFaceDisplacements();
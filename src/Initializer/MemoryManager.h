@@ -87,6 +87,7 @@
 #include "Initializer/DynamicRupture.h"
 #include "Initializer/InputAux.hpp"
 #include "Initializer/Boundary.h"
+#include "Initializer/HaloFaceLayout.h"
 #include "Initializer/ParameterDB.h"
 
 #include "Physics/InitialField.h"
@@ -181,6 +182,9 @@ class MemoryManager {
 
     EasiBoundary m_easiBoundary;
 
+    //! layouts of the face-restricted halo exchange per cluster; empty if not used
+    std::vector<HaloFaceLayout> m_haloFaceLayouts;
+
     /**
      * Corrects the LTS Setups (buffer or derivatives, never both) in the ghost region
      **/
@@ -227,6 +231,12 @@ class MemoryManager {
      * Initializes the communication structure.
      **/
     void initializeCommunicationStructure();
+
+    /**
+     * Derives the layouts of the face-restricted halo exchange.
+     * The faces of the ghost cells which are used by local cells are sent to the owning ranks.
+     **/
+    void initializeHaloFaceLayouts();
 #endif
 
   public:
@@ -301,6 +311,16 @@ class MemoryManager {
      **/
     std::pair<MeshStructure*, CompoundGlobalData>
     getMemoryLayout(unsigned int i_cluster);
+
+    /**
+     * Gets the layout of the face-restricted halo exchange of a time cluster.
+     *
+     * @param i_cluster local id of the time cluster.
+     * @return nullptr if the face-restricted halo exchange is not used.
+     **/
+    const HaloFaceLayout* getHaloFaceLayout(unsigned int i_cluster) const {
+      return m_haloFaceLayouts.empty() ? nullptr : &m_haloFaceLayouts[i_cluster];
+    }
                           
     inline LTSTree* getLtsTree() {
       return &m_ltsTree;
@@ -0,0 +1,190 @@
+#include "ParameterCache.h"
+
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <system_error>
+
+#include <utils/logger.h>
+#include <yaml-cpp/yaml.h>
+
+#include "Common/filesystem.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::initializer {
+
+namespace {
+constexpr std::uint64_t CacheMagic = 0x5345495353434143; // "SEISSCAC"
+
+// FNV-1a
+class Hash {
+  public:
+  void add(const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+      m_value ^= bytes[i];
+      m_value *= 0x100000001b3;
+    }
+  }
+
+  template <typename T>
+  void add(const T& value) {
+    add(&value, sizeof(T));
+  }
+
+  void add(const std::string& value) {
+    add(value.size());
+    add(value.data(), value.size());
+  }
+
+  std::uint64_t value() const { return m_value; }
+
+  private:
+  std::uint64_t m_value{0xcbf29ce484222325};
+};
+
+// Collects all scalars of a model which name an existing file, e.g. the files of ASAGI, NetCDF
+// or included YAML components.
+void collectReferencedFiles(const YAML::Node& node,
+                            const seissol::filesystem::path& modelDirectory,
+                            std::set<std::string>& files) {
+  if (node.IsScalar()) {
+    const auto& value = node.Scalar();
+    std::error_code error;
+    for (const auto& candidate : {seissol::filesystem::path(value), modelDirectory / value}) {
+      if (seissol::filesystem::is_regular_file(candidate, error)) {
+        files.insert(candidate.string());
+        break;
+      }
+    }
+  } else if (node.IsSequence()) {
+    for (const auto& child : node) {
+      collectReferencedFiles(child, modelDirectory, files);
+    }
+  } else if (node.IsMap()) {
+    for (const auto& child : node) {
+      collectReferencedFiles(child.second, modelDirectory, files);
+    }
+  }
+}
+} // namespace
+
+std::uint64_t ParameterCache::modelKey(const std::string& modelFileName) {
+  Hash hash;
+
+  std::ifstream modelFile(modelFileName, std::ios::binary);
+  if (!modelFile) {
+    logError() << "Could not read the model" << modelFileName;
+  }
+  std::stringstream content;
+  content << modelFile.rdbuf();
+  hash.add(content.str());
+
+  std::set<std::string> files;
+  try {
+    const auto modelDirectory = seissol::filesystem::path(modelFileName).parent_path();
+    collectReferencedFiles(YAML::Load(content.str()), modelDirectory, files);
+  } catch (const YAML::Exception& error) {
+    logError() << "Could not parse the model" << modelFileName << ":" << error.what();
+  }
+  for (const auto& file : files) {
+    std::error_code error;
+    hash.add(file);
+    hash.add(static_cast<std::uint64_t>(seissol::filesystem::file_size(file, error)));
+    hash.add(static_cast<std::int64_t>(
+        seissol::filesystem::last_write_time(file, error).time_since_epoch().count()));
+  }
+
+  return hash.value();
+}
+
+ParameterCache::ParameterCache(const std::string& directory,
+                               const std::string& modelFileName,
+                               const easi::Query& query,
+                               const std::vector<std::string>& parameters) {
+  if (directory.empty()) {
+    return;
+  }
+
+  Hash hash;
+  hash.add(modelKey(modelFileName));
+  hash.add(parameters.size());
+  for (const auto& parameter : parameters) {
+    hash.add(parameter);
+  }
+  const unsigned numPoints = query.numPoints();
+  hash.add(numPoints);
+  for (unsigned point = 0; point < numPoints; ++point) {
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      hash.add(query.x(point, dim));
+    }
+    hash.add(query.group(point));
+  }
+  m_key = hash.value();
+
+  std::error_code error;
+  seissol::filesystem::create_directories(directory, error);
+
+  std::stringstream fileName;
+  fileName << directory << "/easi-" << std::hex << std::setw(16) << std::setfill('0') << m_key
+           << ".bin";
+  m_fileName = fileName.str();
+}
+
+bool ParameterCache::read(std::vector<double>& values, std::size_t expectedSize) const {
+  if (!enabled()) {
+    return false;
+  }
+  int valid = readLocal(values, expectedSize) ? 1 : 0;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &valid, 1, MPI_INT, MPI_MIN, seissol::MPI::mpi.comm());
+#endif
+  return valid == 1;
+}
+
+bool ParameterCache::readLocal(std::vector<double>& values, std::size_t expectedSize) const {
+  std::ifstream file(m_fileName, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  std::uint64_t header[3] = {0, 0, 0};
+  file.read(reinterpret_cast<char*>(header), sizeof(header));
+  if (!file || header[0] != CacheMagic || header[1] != m_key || header[2] != expectedSize) {
+    logWarning() << "Ignoring the invalid easi cache file" << m_fileName;
+    return false;
+  }
+  std::vector<double> cached(header[2]);
+  file.read(reinterpret_cast<char*>(cached.data()), cached.size() * sizeof(double));
+  if (!file) {
+    logWarning() << "Ignoring the truncated easi cache file" << m_fileName;
+    return false;
+  }
+  values = std::move(cached);
+  return true;
+}
+
+void ParameterCache::write(const std::vector<double>& values) const {
+  if (!enabled()) {
+    return;
+  }
+  // Write to a temporary file first, such that an aborted run does not leave a truncated cache
+  const auto temporaryName = m_fileName + ".tmp";
+  std::ofstream file(temporaryName, std::ios::binary);
+  const std::uint64_t header[3] = {CacheMagic, m_key, values.size()};
+  file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+  file.close();
+  if (!file) {
+    logWarning() << "Could not write the easi cache file" << m_fileName;
+    return;
+  }
+  std::error_code error;
+  seissol::filesystem::rename(temporaryName, m_fileName, error);
+  if (error) {
+    logWarning() << "Could not write the easi cache file" << m_fileName << ":" << error.message();
+  }
+}
+
+} // namespace seissol::initializer
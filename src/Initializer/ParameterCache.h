@@ -0,0 +1,60 @@
+#ifndef SEISSOL_PARAMETERCACHE_H
+#define SEISSOL_PARAMETERCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "easi/Query.h"
+
+namespace seissol::initializer {
+
+/**
+ * Stores the results of an easi query on disk, such that a later run with the same model and
+ * the same query points does not need to evaluate the model again.
+ *
+ * Every rank uses its own file. The file name is a hash of the model file, of the files
+ * referenced by the model (their sizes and modification times), of the query points and groups
+ * and of the queried parameters. As the query points are generated from the local part of the
+ * mesh, the mesh and its partition are part of the key.
+ */
+class ParameterCache {
+  public:
+  /**
+   * The cache is disabled if the directory is empty.
+   */
+  ParameterCache(const std::string& directory,
+                 const std::string& modelFileName,
+                 const easi::Query& query,
+                 const std::vector<std::string>& parameters);
+
+  bool enabled() const { return !m_fileName.empty(); }
+
+  const std::string& fileName() const { return m_fileName; }
+
+  /**
+   * Reads the cached values; returns false if there is no valid cache file with expectedSize
+   * values. As easi may evaluate a model collectively (e.g. with ASAGI), the cache is only used
+   * if it is valid on all ranks, which all have to call this function.
+   */
+  bool read(std::vector<double>& values, std::size_t expectedSize) const;
+
+  void write(const std::vector<double>& values) const;
+
+  /**
+   * Returns the key of the model file, i.e. a hash of its contents and of the sizes and
+   * modification times of all files it references.
+   */
+  static std::uint64_t modelKey(const std::string& modelFileName);
+
+  private:
+  bool readLocal(std::vector<double>& values, std::size_t expectedSize) const;
+
+  std::string m_fileName;
+  std::uint64_t m_key{0};
+};
+
+} // namespace seissol::initializer
+
+#endif // SEISSOL_PARAMETERCACHE_H
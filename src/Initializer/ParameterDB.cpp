@@ -54,6 +54,8 @@
 #include <algorithm>
 #include <cmath>
 
+#include "Initializer/ParameterCache.h"
+
 #include "DynamicRupture/Misc.h"
 #include "Numerical_aux/Quadrature.h"
 #include "Numerical_aux/Transformation.h"
@@ -264,16 +266,16 @@ namespace initializer {
 using namespace seissol::model;
 
 template <>
-void MaterialParameterDB<ElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<ElasticMaterial>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<ElasticMaterial>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("rho", &ElasticMaterial::rho);
   adapter.addBindingPoint("mu", &ElasticMaterial::mu);
   adapter.addBindingPoint("lambda", &ElasticMaterial::lambda);
 }
 
 template <>
-void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<ViscoElasticMaterial>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("rho", &ViscoElasticMaterial::rho);
   adapter.addBindingPoint("mu", &ViscoElasticMaterial::mu);
   adapter.addBindingPoint("lambda", &ViscoElasticMaterial::lambda);
@@ -282,8 +284,8 @@ void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(
 }
 
 template <>
-void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<PoroElasticMaterial>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("bulk_solid", &PoroElasticMaterial::bulkSolid);
   adapter.addBindingPoint("rho", &PoroElasticMaterial::rho);
   adapter.addBindingPoint("lambda", &PoroElasticMaterial::lambda);
@@ -297,8 +299,8 @@ void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(
 }
 
 template <>
-void MaterialParameterDB<Plasticity>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<Plasticity>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<Plasticity>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("bulkFriction", &Plasticity::bulkFriction);
   adapter.addBindingPoint("plastCo", &Plasticity::plastCo);
   adapter.addBindingPoint("s_xx", &Plasticity::s_xx);
@@ -310,8 +312,8 @@ void MaterialParameterDB<Plasticity>::addBindingPoints(
 }
 
 template <>
-void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<AnisotropicMaterial>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("rho", &AnisotropicMaterial::rho);
   adapter.addBindingPoint("c11", &AnisotropicMaterial::c11);
   adapter.addBindingPoint("c12", &AnisotropicMaterial::c12);
@@ -336,12 +338,79 @@ void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(
   adapter.addBindingPoint("c66", &AnisotropicMaterial::c66);
 }
 
+namespace {
+// Collects the parameters of a material, in the same order as they are bound to easi
+template <class T>
+struct MaterialFields {
+  std::vector<std::string> names;
+  std::vector<double T::*> members;
+
+  template <typename Member>
+  void addBindingPoint(const std::string& name, Member member) {
+    names.push_back(name);
+    members.push_back(member);
+  }
+};
+
+template <class T>
+MaterialFields<T> materialFields() {
+  MaterialFields<T> fields;
+  MaterialParameterDB<T>().addBindingPoints(fields);
+  return fields;
+}
+} // namespace
+
+template <class T>
+bool MaterialParameterDB<T>::readCache(const ParameterCache& cache, unsigned numMaterials) {
+  const auto fields = materialFields<T>();
+  std::vector<double> values;
+  if (!cache.read(values, numMaterials * fields.members.size())) {
+    return false;
+  }
+
+#pragma omp parallel for schedule(static)
+  for (unsigned i = 0; i < numMaterials; ++i) {
+    T material{};
+    for (std::size_t field = 0; field < fields.members.size(); ++field) {
+      material.*(fields.members[field]) = values[i * fields.members.size() + field];
+    }
+    m_materials->at(i) = material;
+  }
+  logInfo(MPI::mpi.rank()) << "Read the material parameters from the easi cache.";
+  return true;
+}
+
+template <class T>
+void MaterialParameterDB<T>::writeCache(const ParameterCache& cache, unsigned numMaterials) const {
+  if (!cache.enabled()) {
+    return;
+  }
+  const auto fields = materialFields<T>();
+  std::vector<double> values(numMaterials * fields.members.size());
+#pragma omp parallel for schedule(static)
+  for (unsigned i = 0; i < numMaterials; ++i) {
+    for (std::size_t field = 0; field < fields.members.size(); ++field) {
+      values[i * fields.members.size() + field] = m_materials->at(i).*(fields.members[field]);
+    }
+  }
+  cache.write(values);
+}
+
 template <class T>
 void MaterialParameterDB<T>::evaluateModel(const std::string& fileName,
                                            const QueryGenerator* const queryGen) {
-  easi::Component* model = loadEasiModel(fileName);
   easi::Query query = queryGen->generate();
   const unsigned numPoints = query.numPoints();
+  const auto* averageGenerator = dynamic_cast<const ElementAverageGenerator*>(queryGen);
+  const unsigned numMaterials =
+      (averageGenerator != nullptr) ? numPoints / NUM_QUADPOINTS : numPoints;
+
+  const ParameterCache cache(m_cacheDirectory, fileName, query, materialFields<T>().names);
+  if (readCache(cache, numMaterials)) {
+    return;
+  }
+
+  easi::Component* model = loadEasiModel(fileName);
 
   std::vector<T> materialsFromQuery(numPoints);
   easi::ArrayOfStructsAdapter<T> adapter(materialsFromQuery.data());
@@ -349,9 +418,9 @@ void MaterialParameterDB<T>::evaluateModel(const std::string& fileName,
   model->evaluate(query, adapter);
 
   // Only use homogenization when ElementAverageGenerator has been supplied
-  if (const ElementAverageGenerator* gen = dynamic_cast<const ElementAverageGenerator*>(queryGen)) {
+  if (averageGenerator != nullptr) {
     const unsigned numElems = numPoints / NUM_QUADPOINTS;
-    std::array<double, NUM_QUADPOINTS> quadratureWeights{gen->getQuadratureWeights()};
+    std::array<double, NUM_QUADPOINTS> quadratureWeights{averageGenerator->getQuadratureWeights()};
 
 // Compute homogenized material parameters for every element in a specialization for the
 // particular material
@@ -367,6 +436,8 @@ void MaterialParameterDB<T>::evaluateModel(const std::string& fileName,
     }
   }
   delete model;
+
+  writeCache(cache, numMaterials);
 }
 
 // Computes the averaged material, assuming that materialsFromQuery, stores
@@ -483,8 +554,14 @@ ViscoElasticMaterial MaterialParameterDB<ViscoElasticMaterial>::computeAveragedM
 template <>
 void MaterialParameterDB<AnisotropicMaterial>::evaluateModel(const std::string& fileName,
                                                              const QueryGenerator* const queryGen) {
-  easi::Component* model = loadEasiModel(fileName);
   easi::Query query = queryGen->generate();
+  const ParameterCache cache(
+      m_cacheDirectory, fileName, query, materialFields<AnisotropicMaterial>().names);
+  if (readCache(cache, query.numPoints())) {
+    return;
+  }
+
+  easi::Component* model = loadEasiModel(fileName);
   auto suppliedParameters = model->suppliedParameters();
   // TODO(Sebastian): inhomogeneous materials, where in some parts only mu and lambda are given
   //                  and in other parts the full elastic tensor is given
@@ -508,13 +585,36 @@ void MaterialParameterDB<AnisotropicMaterial>::evaluateModel(const std::string&
     model->evaluate(query, arrayOfStructsAdapter);
   }
   delete model;
+
+  writeCache(cache, query.numPoints());
 }
 
 void FaultParameterDB::evaluateModel(const std::string& fileName,
                                      const QueryGenerator* const queryGen) {
-  easi::Component* model = loadEasiModel(fileName);
   easi::Query query = queryGen->generate();
+  const unsigned numPoints = query.numPoints();
+
+  // sorted, such that the layout of the cache does not depend on the order of the hash map
+  std::vector<std::string> names;
+  for (const auto& kv : m_parameters) {
+    names.push_back(kv.first);
+  }
+  std::sort(names.begin(), names.end());
+
+  const ParameterCache cache(m_cacheDirectory, fileName, query, names);
+  std::vector<double> values;
+  if (cache.read(values, names.size() * numPoints)) {
+    for (std::size_t p = 0; p < names.size(); ++p) {
+      const auto& [memory, stride] = m_parameters.at(names[p]);
+      for (unsigned i = 0; i < numPoints; ++i) {
+        memory[i * stride] = static_cast<real>(values[p * numPoints + i]);
+      }
+    }
+    logInfo(MPI::mpi.rank()) << "Read the fault parameters from the easi cache.";
+    return;
+  }
 
+  easi::Component* model = loadEasiModel(fileName);
   easi::ArraysAdapter<real> adapter;
   for (auto& kv : m_parameters) {
     adapter.addBindingPoint(kv.first, kv.second.first, kv.second.second);
@@ -522,6 +622,17 @@ void FaultParameterDB::evaluateModel(const std::string& fileName,
   model->evaluate(query, adapter);
 
   delete model;
+
+  if (cache.enabled()) {
+    values.resize(names.size() * numPoints);
+    for (std::size_t p = 0; p < names.size(); ++p) {
+      const auto& [memory, stride] = m_parameters.at(names[p]);
+      for (unsigned i = 0; i < numPoints; ++i) {
+        values[p * numPoints + i] = memory[i * stride];
+      }
+    }
+    cache.write(values);
+  }
 }
 
 } // namespace initializer
@@ -84,6 +84,7 @@ template <class T>
 class MaterialParameterDB;
 class FaultParameterDB;
 class EasiBoundary;
+class ParameterCache;
 
 // temporary struct until we have something like a lazy vector/iterator "map" (as in on-demand,
 // element-wise function application)
@@ -176,6 +177,15 @@ class seissol::initializer::ParameterDB {
   public:
   virtual void evaluateModel(const std::string& fileName, const QueryGenerator* const queryGen) = 0;
   static easi::Component* loadModel(const std::string& fileName);
+
+  /**
+   * Caches the results of the queries in the given directory (see ParameterCache); an empty
+   * directory disables the cache.
+   */
+  void setCacheDirectory(const std::string& directory) { m_cacheDirectory = directory; }
+
+  protected:
+  std::string m_cacheDirectory;
 };
 
 template <class T>
@@ -186,9 +196,14 @@ class seissol::initializer::MaterialParameterDB : seissol::initializer::Paramete
                             const std::vector<T>& materialsFromQuery);
   void evaluateModel(const std::string& fileName, const QueryGenerator* const queryGen) override;
   void setMaterialVector(std::vector<T>* materials) { m_materials = materials; }
-  void addBindingPoints(easi::ArrayOfStructsAdapter<T>& adapter) {};
+  template <typename Adapter>
+  void addBindingPoints(Adapter& adapter) {}
+  using ParameterDB::setCacheDirectory;
 
   private:
+  bool readCache(const ParameterCache& cache, unsigned numMaterials);
+  void writeCache(const ParameterCache& cache, unsigned numMaterials) const;
+
   std::vector<T>* m_materials;
 };
 
@@ -199,6 +214,7 @@ class seissol::initializer::FaultParameterDB : seissol::initializer::ParameterDB
   }
   virtual void evaluateModel(const std::string& fileName, const QueryGenerator* const queryGen);
   static std::set<std::string> faultProvides(const std::string& fileName);
+  using ParameterDB::setCacheDirectory;
 
   private:
   std::unordered_map<std::string, std::pair<real*, unsigned>> m_parameters;
@@ -38,7 +38,13 @@ InitializationParameters readInitializationParameters(ParameterReader* baseReade
   const auto magnitude = reader->readWithDefault("magnitude", 0.0);
   const auto width = reader->readWithDefault("width", std::numeric_limits<double>::infinity());
   const auto k = reader->readWithDefault("k", 0.0);
+  const auto analyticalBoundaryRefreshInterval =
+      reader->readWithDefault("analyticalboundaryrefreshinterval", 0.0);
+  if (analyticalBoundaryRefreshInterval < 0) {
+    logError() << "AnalyticalBoundaryRefreshInterval must not be negative.";
+  }
 
-  return InitializationParameters{type, origin, kVec, ampField, magnitude, width, k};
+  return InitializationParameters{
+      type, origin, kVec, ampField, magnitude, width, k, analyticalBoundaryRefreshInterval};
 }
 } // namespace seissol::initializer::parameters
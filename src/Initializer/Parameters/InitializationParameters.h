@@ -30,6 +30,7 @@ struct InitializationParameters {
   double magnitude;
   double width;
   double k;
+  double analyticalBoundaryRefreshInterval;
 };
 
 InitializationParameters readInitializationParameters(ParameterReader* baseReader);
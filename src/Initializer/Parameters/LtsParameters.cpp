@@ -43,6 +43,7 @@ LtsParameters readLtsParameters(ParameterReader* baseReader) {
                                       LtsWeightsTypes::ExponentialWeights,
                                       LtsWeightsTypes::ExponentialBalancedWeights,
                                       LtsWeightsTypes::EncodedBalancedWeights,
+                                      LtsWeightsTypes::CalibratedWeights,
                                   });
   return LtsParameters(rate,
                        wiggleFactorMinimum,
@@ -137,6 +138,7 @@ TimeSteppingParameters readTimeSteppingParameters(ParameterReader* baseReader) {
   const auto weightDynamicRupture = reader->readWithDefault("vertexweightdynamicrupture", 100);
   const auto weightFreeSurfaceWithGravity =
       reader->readWithDefault("vertexweightfreesurfacewithgravity", 100);
+  const auto costModelFileName = reader->readWithDefault("ltscostmodel", std::string(""));
   const double cfl = reader->readWithDefault("cfl", 0.5);
   double maxTimestepWidth;
 
@@ -181,11 +183,12 @@ TimeSteppingParameters readTimeSteppingParameters(ParameterReader* baseReader) {
                           "material",
                           "npolymap"});
 
-  return TimeSteppingParameters({weightElement, weightDynamicRupture, weightFreeSurfaceWithGravity},
-                                cfl,
-                                maxTimestepWidth,
-                                endTime,
-                                ltsParameters);
+  return TimeSteppingParameters(
+      {weightElement, weightDynamicRupture, weightFreeSurfaceWithGravity, costModelFileName},
+      cfl,
+      maxTimestepWidth,
+      endTime,
+      ltsParameters);
 }
 
 } // namespace seissol::initializer::parameters
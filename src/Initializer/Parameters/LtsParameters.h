@@ -1,6 +1,8 @@
 #ifndef SEISSOL_LTS_PARAMETERS_H
 #define SEISSOL_LTS_PARAMETERS_H
 
+#include <string>
+
 #include "ParameterReader.h"
 
 namespace seissol::initializer::parameters {
@@ -9,6 +11,7 @@ enum class LtsWeightsTypes : int {
   ExponentialWeights = 0,
   ExponentialBalancedWeights,
   EncodedBalancedWeights,
+  CalibratedWeights,
   Count
 };
 
@@ -16,6 +19,8 @@ struct VertexWeightParameters {
   int weightElement;
   int weightDynamicRupture;
   int weightFreeSurfaceWithGravity;
+  // measured costs of a previous run, used by the calibrated weights
+  std::string costModelFileName;
 };
 
 enum class AutoMergeCostBaseline {
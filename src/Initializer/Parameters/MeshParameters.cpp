@@ -24,6 +24,13 @@ MeshParameters readMeshParameters(ParameterReader* baseReader) {
                                                             {"i64", BoundaryFormat::I64},
                                                             {"i32x4", BoundaryFormat::I32x4},
                                                         });
+  const CellOrdering cellOrdering =
+      reader->readWithDefaultStringEnum<CellOrdering>(
+          "cellordering",
+          "mesh",
+          {{"mesh", CellOrdering::Mesh},
+           {"hilbert", CellOrdering::Hilbert},
+           {"rcm", CellOrdering::ReverseCuthillMcKee}});
 
   const auto displacementRaw = seissol::initializer::convertStringToArray<double, 3>(
       reader->readWithDefault("displacement", std::string("0.0 0.0 0.0")));
@@ -47,6 +54,7 @@ MeshParameters readMeshParameters(ParameterReader* baseReader) {
                         meshFormat,
                         meshFileName,
                         partitioningLib,
+                        cellOrdering,
                         displacement,
                         scaling};
 }
@@ -13,12 +13,15 @@ enum class MeshFormat : int { Netcdf, PUML, CubeGenerator };
 
 enum class BoundaryFormat : int { Auto, I32, I64, I32x4 };
 
+enum class CellOrdering : int { Mesh, Hilbert, ReverseCuthillMcKee };
+
 struct MeshParameters {
   bool showEdgeCutStatistics;
   BoundaryFormat pumlBoundaryFormat;
   MeshFormat meshFormat;
   std::string meshFileName;
   std::string partitioningLib;
+  CellOrdering cellOrdering;
   Eigen::Vector3d displacement;
   Eigen::Matrix3d scaling;
 };
@@ -41,6 +41,8 @@ ModelParameters readModelParameters(ParameterReader* baseReader) {
   const std::string materialFileName =
       reader->readOrFail<std::string>("materialfilename", "No material file given.");
   const bool hasBoundaryFile = boundaryFileName != "";
+  const std::string easiCacheDirectory =
+      reader->readWithDefault("easicachedirectory", std::string(""));
 
   const bool plasticity = reader->readWithDefault("plasticity", false);
   const bool useCellHomogenizedMaterial =
@@ -72,6 +74,7 @@ ModelParameters readModelParameters(ParameterReader* baseReader) {
                          tv,
                          boundaryFileName,
                          materialFileName,
+                         easiCacheDirectory,
                          itmParameters};
 }
 } // namespace seissol::initializer::parameters
@@ -61,6 +61,7 @@ struct ModelParameters {
   double tv;
   std::string boundaryFileName;
   std::string materialFileName;
+  std::string easiCacheDirectory;
   ITMParameters itmParameters;
 };
 
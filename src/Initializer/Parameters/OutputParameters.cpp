@@ -34,6 +34,7 @@ CheckpointParameters readCheckpointParameters(ParameterReader* baseReader) {
            {"hdf5", CheckpointingBackend::HDF5},
            {"mpio", CheckpointingBackend::MPIO},
            {"mpio_async", CheckpointingBackend::MPIO_ASYNC},
+           {"mpio_global", CheckpointingBackend::MPIO_GLOBAL},
            {"sionlib", CheckpointingBackend::SIONLIB}});
     } else {
       reader->markUnused({"CheckpointingBackend"});
@@ -118,7 +119,10 @@ PickpointParameters readPickpointParameters(ParameterReader* baseReader) {
   auto* reader = baseReader->readSubNode("pickpoint");
 
   const auto printTimeInterval = reader->readWithDefault("printtimeinterval", 1);
-  const auto maxPickStore = 50;
+  const auto maxPickStore = reader->readWithDefault("maxpickstore", 50);
+  if (maxPickStore <= 0) {
+    logError() << "maxPickStore must be positive.";
+  }
 
   const auto outputMaskString =
       reader->readWithDefault<std::string>("outputmask", "1 1 1 1 1 1 0 0 0 0 0 0");
@@ -126,9 +130,21 @@ PickpointParameters readPickpointParameters(ParameterReader* baseReader) {
 
   const auto pickpointFileName = reader->readWithDefault("ppfilename", std::string(""));
 
+  const auto printTimeIntervalSec = reader->readWithDefault("printtimeinterval_sec", 0.0);
+
+  const auto format = reader->readWithDefaultStringEnum<ReceiverOutputFormat>(
+      "ppoutputformat",
+      "ascii",
+      {{"ascii", ReceiverOutputFormat::Ascii}, {"binary", ReceiverOutputFormat::Binary}});
+
   reader->warnDeprecated({"noutpoints"});
 
-  return PickpointParameters{printTimeInterval, maxPickStore, outputMask, pickpointFileName};
+  return PickpointParameters{printTimeInterval,
+                             maxPickStore,
+                             outputMask,
+                             pickpointFileName,
+                             printTimeIntervalSec,
+                             format};
 }
 
 ReceiverOutputParameters readReceiverParameters(ParameterReader* baseReader) {
@@ -141,8 +157,13 @@ ReceiverOutputParameters readReceiverParameters(ParameterReader* baseReader) {
   const auto computeRotation = reader->readWithDefault("receivercomputerotation", false);
   const auto samplingInterval = reader->readWithDefault("pickdt", 0.0);
   const auto fileName = reader->readWithDefault("rfilename", std::string(""));
+  const auto format = reader->readWithDefaultStringEnum<ReceiverOutputFormat>(
+      "receiveroutputformat",
+      "ascii",
+      {{"ascii", ReceiverOutputFormat::Ascii}, {"binary", ReceiverOutputFormat::Binary}});
 
-  return ReceiverOutputParameters{enabled, computeRotation, interval, samplingInterval, fileName};
+  return ReceiverOutputParameters{
+      enabled, computeRotation, interval, samplingInterval, fileName, format};
 }
 
 WaveFieldOutputParameters readWaveFieldParameters(ParameterReader* baseReader) {
@@ -208,6 +229,7 @@ OutputParameters readOutputParameters(ParameterReader* baseReader) {
 
   const auto loopStatisticsNetcdfOutput =
       reader->readWithDefault("loopstatisticsnetcdfoutput", false);
+  const auto costModelOutput = reader->readWithDefault("costmodeloutput", false);
   const auto format = reader->readWithDefaultEnum<OutputFormat>(
       "format", OutputFormat::None, {OutputFormat::None, OutputFormat::Xdmf});
   const auto xdmfWriterBackend = reader->readWithDefaultStringEnum<xdmfwriter::BackendType>(
@@ -239,6 +261,7 @@ OutputParameters readOutputParameters(ParameterReader* baseReader) {
                           "faultoutputflag"});
 
   return OutputParameters(loopStatisticsNetcdfOutput,
+                          costModelOutput,
                           format,
                           xdmfWriterBackend,
                           prefix,
@@ -14,7 +14,7 @@ namespace seissol::initializer::parameters {
 
 constexpr double veryLongTime = 1.0e100;
 
-enum CheckpointingBackend { POSIX, HDF5, MPIO, MPIO_ASYNC, SIONLIB, DISABLED };
+enum CheckpointingBackend { POSIX, HDF5, MPIO, MPIO_ASYNC, MPIO_GLOBAL, SIONLIB, DISABLED };
 
 enum class FaultRefinement { Triple = 1, Quad = 2, None = 3 };
 
@@ -51,11 +51,16 @@ struct FreeSurfaceOutputParameters {
   double interval;
 };
 
+enum class ReceiverOutputFormat { Ascii, Binary };
+
 struct PickpointParameters {
   int printTimeInterval{1};
   int maxPickStore{50};
   std::array<bool, 12> outputMask{true, true, true};
   std::string pickpointFileName{};
+  // samples in simulated time if positive, otherwise every printTimeInterval iterations
+  double printTimeIntervalSec{0.0};
+  ReceiverOutputFormat format{ReceiverOutputFormat::Ascii};
 };
 
 struct ReceiverOutputParameters {
@@ -64,6 +69,7 @@ struct ReceiverOutputParameters {
   double interval;
   double samplingInterval;
   std::string fileName;
+  ReceiverOutputFormat format;
 };
 
 struct OutputInterval {
@@ -106,6 +112,7 @@ struct WaveFieldOutputParameters {
 
 struct OutputParameters {
   bool loopStatisticsNetcdfOutput;
+  bool costModelOutput;
   OutputFormat format;
   xdmfwriter::BackendType xdmfWriterBackend;
   std::string prefix;
@@ -119,6 +126,7 @@ struct OutputParameters {
 
   OutputParameters() = default;
   OutputParameters(bool loopStatisticsNetcdfOutput,
+                   bool costModelOutput,
                    OutputFormat format,
                    xdmfwriter::BackendType xdmfWriterBackend,
                    std::string prefix,
@@ -129,7 +137,8 @@ struct OutputParameters {
                    PickpointParameters pickpointParameters,
                    ReceiverOutputParameters receiverParameters,
                    WaveFieldOutputParameters waveFieldParameters)
-      : loopStatisticsNetcdfOutput(loopStatisticsNetcdfOutput), format(format),
+      : loopStatisticsNetcdfOutput(loopStatisticsNetcdfOutput), costModelOutput(costModelOutput),
+        format(format),
         xdmfWriterBackend(xdmfWriterBackend), prefix(prefix),
         checkpointParameters(checkpointParameters), elementwiseParameters(elementwiseParameters),
         energyParameters(energyParameters), freeSurfaceParameters(freeSurfaceParameters),
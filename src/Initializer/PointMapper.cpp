@@ -70,7 +70,8 @@
 
 #include "PointMapper.h"
 #include <cstring>
-#include "Initializer/MemoryAllocator.h"
+#include <vector>
+#include "Geometry/PointLocator.h"
 #include <utils/logger.h>
 #include "Parallel/MPI.h"
 
@@ -96,88 +97,22 @@ void seissol::initializer::findMeshIds(Eigen::Vector3d const* points,
 
   memset(contained, 0, numPoints * sizeof(short));
 
-  double (*planeEquations)[4][4] = static_cast<double(*)[4][4]>(seissol::memory::allocate(elements.size() * sizeof(double[4][4]), ALIGNMENT));
-  for (unsigned elem = 0; elem < elements.size(); ++elem) {
-    for (int face = 0; face < 4; ++face) {
-      VrtxCoords n, p;
-      MeshTools::pointOnPlane(elements[elem], face, vertices, p);
-      MeshTools::normal(elements[elem], face, vertices, n);
+  const seissol::geometry::PointLocator locator(vertices, elements);
 
-      for (unsigned i = 0; i < 3; ++i) {
-        planeEquations[elem][i][face] = n[i];
-      }
-      planeEquations[elem][3][face] = - MeshTools::dot(n, p);
-    }
-  }
-
-  double (*points1)[4] = new double[numPoints][4];
-  for (unsigned point = 0; point < numPoints; ++point) {
-    points1[point][0] = points[point](0);
-    points1[point][1] = points[point](1);
-    points1[point][2] = points[point](2);
-    points1[point][3] = 1.0;
-  }
-
-/// @TODO Could use the code generator for the following
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-  for (unsigned elem = 0; elem < elements.size(); ++elem) {
-#if 0 //defined(__AVX__)
-    __m256d zero = _mm256_setzero_pd();
-      __m256d planeDims[4];
-      for (unsigned i = 0; i < 4; ++i) {
-        planeDims[i] = _mm256_load_pd(&planeEquations[elem][i][0]);
-      }
-#endif
-    for (unsigned point = 0; point < numPoints; ++point) {
-      int l_notInside = 0;
-#if 0 //defined(__AVX__)
-      // Not working because <0 => 0 should actually be  <=0 => 0
-      /*__m256d result = _mm256_setzero_pd();
-      for (unsigned dim = 0; dim < 4; ++dim) {
-        result = _mm256_add_pd(result, _mm256_mul_pd(planeDims[dim], _mm256_broadcast_sd(&points1[point][dim])) );
-      }
-      // >0 => (2^64)-1 ; <0 = 0
-      __m256d inside4 = _mm256_cmp_pd(result, zero, _CMP_GE_OQ);
-      l_notInside = _mm256_movemask_pd(inside4);*/
-#else
-      double result[4] = { 0.0, 0.0, 0.0, 0.0 };
-      for (unsigned dim = 0; dim < 4; ++dim) {
-        for (unsigned face = 0; face < 4; ++face) {
-          result[face] += planeEquations[elem][dim][face] * points1[point][dim];
-        }
-      }
-      for (unsigned face = 0; face < 4; ++face) {
-        l_notInside += (result[face] > 0.0) ? 1 : 0;
-      }
-#endif
-      if (l_notInside == 0) {
-#ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-          /* It might actually happen that a point is found in two tetrahedrons
-           * if it lies on the boundary. In this case we arbitrarily assign
-           * it to the one with the higher meshId.
-           * @todo Check if this is a problem with the numerical scheme. */
-          /*if (contained[point] != 0) {
-             logError() << "point with id " << point << " was already found in a different element!";
-          }*/
-          auto localId = static_cast<unsigned>(elements[elem].localId);
-          if ((contained[point] == 0) || (meshIds[point] > localId)) {
-            contained[point] = 1;
-            meshIds[point] = elements[elem].localId;
-          }
-#ifdef _OPENMP
-        }
-#endif
-      }
+  for (unsigned point = 0; point < numPoints; ++point) {
+    /* It might actually happen that a point is found in two tetrahedrons
+     * if it lies on the boundary. In this case we arbitrarily assign
+     * it to the one with the lower meshId.
+     * @todo Check if this is a problem with the numerical scheme. */
+    const auto elem = locator.findElement(points[point]);
+    if (elem.has_value()) {
+      contained[point] = 1;
+      meshIds[point] = elements[*elem].localId;
     }
   }
-
-  seissol::memory::free(planeEquations);
-  delete[] points1;
 }
 
 #ifdef USE_MPI
@@ -186,26 +121,23 @@ void seissol::initializer::cleanDoubles(short* contained, unsigned numPoints)
   int myrank = seissol::MPI::mpi.rank();
   int size = seissol::MPI::mpi.size();
 
-  short* globalContained = new short[size * numPoints];
-  MPI_Allgather(contained, numPoints, MPI_SHORT, globalContained, numPoints, MPI_SHORT, seissol::MPI::mpi.comm());
+  // The lowest rank which contains a point owns it
+  std::vector<int> owner(numPoints);
+  for (unsigned point = 0; point < numPoints; ++point) {
+    owner[point] = (contained[point] == 1) ? myrank : size;
+  }
+  MPI_Allreduce(MPI_IN_PLACE, owner.data(), numPoints, MPI_INT, MPI_MIN, seissol::MPI::mpi.comm());
 
   unsigned cleaned = 0;
   for (unsigned point = 0; point < numPoints; ++point) {
-    if (contained[point] == 1) {
-      for (int rank = 0; rank < myrank; ++rank) {
-        if (globalContained[rank * numPoints + point] == 1) {
-          contained[point] = 0;
-          ++cleaned;
-          break;
-        }
-      }
+    if (contained[point] == 1 && owner[point] != myrank) {
+      contained[point] = 0;
+      ++cleaned;
     }
   }
 
   if (cleaned > 0) {
     logInfo(myrank) << "Cleaned " << cleaned << " double occurring points on rank " << myrank << ".";
   }
-
-  delete[] globalContained;
 }
 #endif
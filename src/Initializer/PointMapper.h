@@ -45,7 +45,7 @@
 
 namespace seissol {
   namespace initializer {
-    /** Finds the tetrahedrons that contain the points.
+    /** Finds the tetrahedrons that contain the points (cf. geometry::PointLocator).
      *  In "contained" we save if the point source is contained in the mesh.
      *  We use short here as bool. For MPI use cleanDoubles afterwards.
      */
@@ -62,6 +62,7 @@ namespace seissol {
                      short* contained,
                      unsigned* meshIds);
   #ifdef USE_MPI
+    /** Assigns points which are contained on several ranks to the lowest of these ranks. */
     void cleanDoubles(short* contained, unsigned numPoints);
 #endif
   }
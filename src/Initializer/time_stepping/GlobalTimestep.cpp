@@ -54,6 +54,7 @@ GlobalTimestep
   std::vector<Material> materials(cellToVertex.size);
   seissol::initializer::MaterialParameterDB<Material> parameterDB;
   parameterDB.setMaterialVector(&materials);
+  parameterDB.setCacheDirectory(seissolParams.model.easiCacheDirectory);
   parameterDB.evaluateModel(velocityModel, queryGen);
 
   GlobalTimestep timestep;
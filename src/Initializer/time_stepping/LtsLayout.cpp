@@ -47,9 +47,11 @@
 #include "LtsLayout.h"
 #include "MultiRate.hpp"
 #include "GlobalTimestep.hpp"
+#include <algorithm>
 #include <iterator>
 
 #include "Initializer/ParameterDB.h"
+#include "Geometry/CellOrdering.h"
 
 #include <iomanip>
 
@@ -84,6 +86,19 @@ void seissol::initializer::time_stepping::LtsLayout::setMesh( const seissol::geo
 
   m_cellClusterIds     = new unsigned int[ m_cells.size() ];
 
+  // the Hilbert ordering sorts the cells by their barycenters
+  if( seissolParams.mesh.cellOrdering == seissol::initializer::parameters::CellOrdering::Hilbert ) {
+    const std::vector<Vertex>& vertices = i_mesh.getVertices();
+    m_cellBarycenters.resize( m_cells.size() );
+    for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+      m_cellBarycenters[l_cell].setZero();
+      for( unsigned int l_vertex = 0; l_vertex < 4; l_vertex++ ) {
+        m_cellBarycenters[l_cell] += Eigen::Map<const Eigen::Vector3d>( vertices[ m_cells[l_cell].vertices[l_vertex] ].coords );
+      }
+      m_cellBarycenters[l_cell] *= 0.25;
+    }
+  }
+
   // initialize with invalid values
   for (unsigned int l_cell = 0; l_cell < m_cells.size(); ++l_cell) {
     m_cellClusterIds[l_cell] = std::numeric_limits<unsigned int>::max();
@@ -1153,6 +1168,68 @@ void seissol::initializer::time_stepping::LtsLayout::deriveClusteredGhost() {
 #endif // USE_MPI
 }
 
+void seissol::initializer::time_stepping::LtsLayout::reorderClusteredInterior() {
+  const int rank = seissol::MPI::mpi.rank();
+  const auto cellOrdering = seissolParams.mesh.cellOrdering;
+
+  for( unsigned int l_cluster = 0; l_cluster < m_clusteredInterior.size(); l_cluster++ ) {
+    std::vector< clusterCell > &l_interior = m_clusteredInterior[l_cluster];
+
+    std::vector< std::size_t > l_order;
+    if( cellOrdering == seissol::initializer::parameters::CellOrdering::Hilbert ) {
+      std::vector< Eigen::Vector3d > l_barycenters( l_interior.size() );
+      for( unsigned int l_cell = 0; l_cell < l_interior.size(); l_cell++ ) {
+        l_barycenters[l_cell] = m_cellBarycenters[ l_interior[l_cell] ];
+      }
+      l_order = seissol::geometry::hilbertOrder( l_barycenters );
+    }
+    else if( cellOrdering == seissol::initializer::parameters::CellOrdering::ReverseCuthillMcKee ) {
+      // the interior is sorted by the mesh ids at this point
+      std::vector< std::vector< std::size_t > > l_adjacency( l_interior.size() );
+      for( unsigned int l_cell = 0; l_cell < l_interior.size(); l_cell++ ) {
+        for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+          const unsigned int l_neighbor = m_cells[ l_interior[l_cell] ].neighbors[l_face];
+          // only neighbors in the interior of the same cluster are relevant
+          if( l_neighbor >= m_cells.size() ) {
+            continue;
+          }
+          std::vector< clusterCell >::const_iterator l_position = std::lower_bound( l_interior.begin(), l_interior.end(), l_neighbor );
+          if( l_position != l_interior.end() && *l_position == l_neighbor ) {
+            l_adjacency[l_cell].push_back( l_position - l_interior.begin() );
+          }
+        }
+      }
+      l_order = seissol::geometry::reverseCuthillMcKeeOrder( l_adjacency );
+    }
+
+    if( !l_order.empty() ) {
+      std::vector< clusterCell > l_reordered( l_interior.size() );
+      for( unsigned int l_cell = 0; l_cell < l_interior.size(); l_cell++ ) {
+        l_reordered[l_cell] = l_interior[ l_order[l_cell] ];
+      }
+      l_interior.swap( l_reordered );
+    }
+  }
+
+  // the barycenters are not required anymore
+  std::vector< Eigen::Vector3d >().swap( m_cellBarycenters );
+
+  // store the position of the cells for the neighbor lookup
+  m_interiorPositions.assign( m_cells.size(), std::numeric_limits<unsigned int>::max() );
+  for( unsigned int l_cluster = 0; l_cluster < m_clusteredInterior.size(); l_cluster++ ) {
+    for( unsigned int l_cell = 0; l_cell < m_clusteredInterior[l_cluster].size(); l_cell++ ) {
+      m_interiorPositions[ m_clusteredInterior[l_cluster][l_cell] ] = l_cell;
+    }
+  }
+
+  if( cellOrdering == seissol::initializer::parameters::CellOrdering::Hilbert ) {
+    logInfo(rank) << "Ordered the interior cells of the time clusters along a Hilbert curve.";
+  }
+  else if( cellOrdering == seissol::initializer::parameters::CellOrdering::ReverseCuthillMcKee ) {
+    logInfo(rank) << "Ordered the interior cells of the time clusters in reverse Cuthill-McKee order.";
+  }
+}
+
 void seissol::initializer::time_stepping::LtsLayout::deriveLayout( enum TimeClustering i_timeClustering,
                                                                     unsigned int        i_clusterRate ) {
 	const int rank = seissol::MPI::mpi.rank();
@@ -1213,7 +1290,10 @@ void seissol::initializer::time_stepping::LtsLayout::deriveLayout( enum TimeClus
 
   // derive the region sizes of the ghost layer
   deriveClusteredGhost();
-  
+
+  // reorder the interior cells for locality
+  reorderClusteredInterior();
+
   // derive dynamic rupture layers
   deriveDynamicRupturePlainCopyInterior();
 }
@@ -52,6 +52,9 @@
 #include <array>
 #include <limits>
 #include <cassert>
+#include <vector>
+
+#include <Eigen/Dense>
 
 namespace seissol {
   namespace initializer {
@@ -75,6 +78,9 @@ class seissol::initializer::time_stepping::LtsLayout {
     //! fault in the local domain
     std::vector<Fault> m_fault;
 
+    //! barycenters of the cells (only required for the Hilbert ordering)
+    std::vector<Eigen::Vector3d> m_cellBarycenters;
+
     //! time step widths of the cells (cfl)
     std::vector<double>       m_cellTimeStepWidths;
 
@@ -161,6 +167,12 @@ class seissol::initializer::time_stepping::LtsLayout {
      **/
     std::vector< std::vector< clusterCell > > m_clusteredInterior;
 
+    /**
+     * position of the interior cells in their cluster
+     * [*]           : mesh id
+     **/
+    std::vector< unsigned int > m_interiorPositions;
+
     /**
      * copy region of a time stepping cluster.
      * first[0]: mpi rank of the neighboring cluster
@@ -348,6 +360,12 @@ class seissol::initializer::time_stepping::LtsLayout {
      **/
     void deriveClusteredGhost();
 
+    /**
+     * Reorders the cells in the interior of each cluster as set in the parameters.
+     * The copy and ghost regions keep the order required for the communication.
+     **/
+    void reorderClusteredInterior();
+
     /**
      * Searches for the position of  cell in the specified ghost region.
      *
@@ -448,14 +466,11 @@ class seissol::initializer::time_stepping::LtsLayout {
       o_localClusterId = m_cellClusterIds[ i_meshId ];
       o_localClusterId = getLocalClusterId( o_localClusterId );
 
-      std::vector< unsigned int >::iterator l_searchResult = std::lower_bound( m_clusteredInterior[o_localClusterId].begin(), // start of the search
-                                                                               m_clusteredInterior[o_localClusterId].end(),   // end of the search
-                                                                               i_meshId );                                    // value to search for
-      o_localCellId = l_searchResult - m_clusteredInterior[o_localClusterId].begin();
+      o_localCellId = m_interiorPositions[ i_meshId ];
 
       // ensure a valid value
-      if( o_localCellId > m_clusteredInterior[o_localClusterId].size() - 1 ||
-          *l_searchResult != i_meshId ) logError() << "no matching neighboring interior cell";
+      if( o_localCellId >= m_clusteredInterior[o_localClusterId].size() ||
+          m_clusteredInterior[o_localClusterId][o_localCellId] != i_meshId ) logError() << "no matching neighboring interior cell";
     }
 
   public:
@@ -0,0 +1,118 @@
+#include "CostModel.h"
+
+#include <fstream>
+
+#include <utils/logger.h>
+#include <yaml-cpp/yaml.h>
+
+namespace seissol::initializer::time_stepping {
+
+namespace {
+double timePerIteration(const LoopStatistics::IterationSums& sums) {
+  return sums.iterations > 0 ? sums.time / sums.iterations : 0.0;
+}
+
+LoopStatistics::IterationSums& operator+=(LoopStatistics::IterationSums& lhs,
+                                          const LoopStatistics::IterationSums& rhs) {
+  lhs.iterations += rhs.iterations;
+  lhs.time += rhs.time;
+  return lhs;
+}
+} // namespace
+
+CostModel CostModel::fromLoopStatistics(const LoopStatistics& loopStatistics,
+                                        unsigned numberOfGlobalClusters,
+                                        MPI_Comm comm) {
+  // The sub-regions are the profiling ids of the time clusters, i.e. the global cluster id for
+  // the interior and the global cluster id plus the number of global clusters for the copy layer
+  const unsigned numberOfSubRegions = 2 * numberOfGlobalClusters;
+  const auto local = loopStatistics.sumsPerSubRegion(
+      loopStatistics.getRegion("computeLocalIntegration"), numberOfSubRegions, comm);
+  const auto neighbor = loopStatistics.sumsPerSubRegion(
+      loopStatistics.getRegion("computeNeighboringIntegration"), numberOfSubRegions, comm);
+  const auto dynamicRupture = loopStatistics.sumsPerSubRegion(
+      loopStatistics.getRegion("computeDynamicRupture"), numberOfSubRegions, comm);
+
+  CostModel model;
+  model.clusters.resize(numberOfGlobalClusters);
+  LoopStatistics::IterationSums totalLocal;
+  LoopStatistics::IterationSums totalNeighbor;
+  LoopStatistics::IterationSums totalDynamicRupture;
+  for (unsigned cluster = 0; cluster < numberOfGlobalClusters; ++cluster) {
+    auto clusterLocal = local[cluster];
+    clusterLocal += local[cluster + numberOfGlobalClusters];
+    auto clusterNeighbor = neighbor[cluster];
+    clusterNeighbor += neighbor[cluster + numberOfGlobalClusters];
+    auto clusterDynamicRupture = dynamicRupture[cluster];
+    clusterDynamicRupture += dynamicRupture[cluster + numberOfGlobalClusters];
+
+    model.clusters[cluster].element =
+        timePerIteration(clusterLocal) + timePerIteration(clusterNeighbor);
+    model.clusters[cluster].dynamicRuptureFace = timePerIteration(clusterDynamicRupture);
+
+    totalLocal += clusterLocal;
+    totalNeighbor += clusterNeighbor;
+    totalDynamicRupture += clusterDynamicRupture;
+  }
+  model.total.element = timePerIteration(totalLocal) + timePerIteration(totalNeighbor);
+  model.total.dynamicRuptureFace = timePerIteration(totalDynamicRupture);
+
+  return model;
+}
+
+CostModel CostModel::read(const std::string& fileName) {
+  YAML::Node node;
+  try {
+    node = YAML::LoadFile(fileName);
+  } catch (const std::exception& error) {
+    logError() << "Could not read the cost model" << fileName << ":" << error.what();
+  }
+
+  auto readCosts = [](const YAML::Node& costs) {
+    return Costs{costs["element"].as<double>(0.0), costs["dynamicRuptureFace"].as<double>(0.0)};
+  };
+
+  CostModel model;
+  model.total = readCosts(node);
+  if (model.total.element <= 0.0) {
+    logError() << "The cost model" << fileName << "contains no element cost.";
+  }
+  for (const auto& cluster : node["clusters"]) {
+    model.clusters.push_back(readCosts(cluster));
+  }
+  return model;
+}
+
+void CostModel::write(const std::string& fileName) const {
+  YAML::Emitter emitter;
+  emitter.SetDoublePrecision(17);
+  emitter << YAML::Comment("Compute time per time step in seconds, measured by the loop statistics");
+  emitter << YAML::BeginMap;
+  emitter << YAML::Key << "element" << YAML::Value << total.element;
+  emitter << YAML::Key << "dynamicRuptureFace" << YAML::Value << total.dynamicRuptureFace;
+  emitter << YAML::Key << "clusters" << YAML::Value << YAML::BeginSeq;
+  for (const auto& cluster : clusters) {
+    emitter << YAML::Flow << YAML::BeginMap;
+    emitter << YAML::Key << "element" << YAML::Value << cluster.element;
+    emitter << YAML::Key << "dynamicRuptureFace" << YAML::Value << cluster.dynamicRuptureFace;
+    emitter << YAML::EndMap;
+  }
+  emitter << YAML::EndSeq;
+  emitter << YAML::EndMap;
+
+  std::ofstream file(fileName);
+  if (!file) {
+    logError() << "Could not write the cost model" << fileName;
+  }
+  file << emitter.c_str() << '\n';
+}
+
+CostModel::Costs CostModel::clusterCosts(int cluster) const {
+  if (cluster >= 0 && cluster < static_cast<int>(clusters.size()) &&
+      clusters[cluster].element > 0.0) {
+    return clusters[cluster];
+  }
+  return total;
+}
+
+} // namespace seissol::initializer::time_stepping
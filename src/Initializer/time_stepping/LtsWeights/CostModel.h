@@ -0,0 +1,50 @@
+#ifndef SEISSOL_LTSWEIGHTSCOSTMODEL_H
+#define SEISSOL_LTSWEIGHTSCOSTMODEL_H
+
+#include <string>
+#include <vector>
+
+#include "Monitoring/LoopStatistics.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::initializer::time_stepping {
+
+/**
+ * Measured compute time per element and per dynamic rupture face, in seconds per time step.
+ *
+ * The model is derived from the loop statistics of a run and used to weight the elements of
+ * the partitioning of the next run on the same mesh.
+ */
+struct CostModel {
+  struct Costs {
+    //! local and neighbor integration of one element
+    double element{0.0};
+    //! friction law and flux of one dynamic rupture face
+    double dynamicRuptureFace{0.0};
+  };
+
+  //! averages over all clusters
+  Costs total{};
+  //! per global time cluster; zero if a cluster has not been measured
+  std::vector<Costs> clusters{};
+
+  /**
+   * Collects the costs over all ranks of comm, which all have to call this function.
+   */
+  static CostModel fromLoopStatistics(const LoopStatistics& loopStatistics,
+                                      unsigned numberOfGlobalClusters,
+                                      MPI_Comm comm);
+
+  static CostModel read(const std::string& fileName);
+
+  void write(const std::string& fileName) const;
+
+  /**
+   * Returns the costs of a cluster, or the averages if the cluster has not been measured.
+   */
+  Costs clusterCosts(int cluster) const;
+};
+
+} // namespace seissol::initializer::time_stepping
+
+#endif // SEISSOL_LTSWEIGHTSCOSTMODEL_H
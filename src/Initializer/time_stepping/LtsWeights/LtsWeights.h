@@ -66,6 +66,7 @@ struct LtsWeightsConfig {
   int vertexWeightElement{};
   int vertexWeightDynamicRupture{};
   int vertexWeightFreeSurfaceWithGravity{};
+  std::string costModelFileName{};
 };
 
 double computeLocalCostOfClustering(const std::vector<int>& clusterIds,
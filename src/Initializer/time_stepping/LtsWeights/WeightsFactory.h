@@ -38,6 +38,9 @@ inline std::unique_ptr<LtsWeights> getLtsWeightsImplementation(parameters::LtsWe
     case parameters::LtsWeightsTypes::EncodedBalancedWeights : {
       return std::make_unique<EncodedBalancedWeights>(config, seissolInstance);
     }
+    case parameters::LtsWeightsTypes::CalibratedWeights : {
+      return std::make_unique<CalibratedWeights>(config, seissolInstance);
+    }
     default : {
       return std::unique_ptr<LtsWeights>(nullptr);
     }
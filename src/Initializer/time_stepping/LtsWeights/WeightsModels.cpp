@@ -10,6 +10,9 @@
 
 #include "generated_code/init.h"
 
+#include <algorithm>
+#include <cmath>
+
 
 namespace seissol::initializer::time_stepping {
 
@@ -82,4 +85,45 @@ void EncodedBalancedWeights::setAllowedImbalances() {
     m_imbalances[i] = mediumLtsWeightImbalance;
   }
 }
+
+
+CalibratedWeights::CalibratedWeights(const LtsWeightsConfig& config,
+                                     seissol::SeisSol& seissolInstance)
+    : LtsWeights(config, seissolInstance) {
+  if (config.costModelFileName.empty()) {
+    logError() << "The calibrated LTS weights require a cost model (LtsCostModel).";
+  }
+  m_costModel = CostModel::read(config.costModelFileName);
+  logInfo(seissol::MPI::mpi.rank()) << "Using the cost model" << config.costModelFileName
+                                    << "for the LTS weights.";
+
+  // The element weight of the parameter file remains the unit of the weights. A dynamic
+  // rupture face is shared by two elements, hence each of them is charged half of its cost.
+  const double dynamicRuptureRatio =
+      0.5 * m_costModel.total.dynamicRuptureFace / m_costModel.total.element;
+  m_vertexWeightDynamicRupture =
+      static_cast<int>(std::lround(dynamicRuptureRatio * m_vertexWeightElement));
+}
+
+void CalibratedWeights::setVertexWeights() {
+  assert(m_ncon == 1 && "single constraint partitioning");
+  int maxCluster = getCluster(m_details.globalMaxTimeStep, m_details.globalMinTimeStep, wiggleFactor, m_rate);
+
+  for (unsigned cell = 0; cell < m_cellCosts.size(); ++cell) {
+    int factor = LtsWeights::ipow(m_rate, maxCluster - m_clusterIds[cell]);
+    // Elements of different clusters differ in their cost, e.g. due to the cache reuse
+    const double clusterRatio =
+        m_costModel.clusterCosts(m_clusterIds[cell]).element / m_costModel.total.element;
+    m_vertexWeights[m_ncon * cell] =
+        std::max(1, static_cast<int>(std::lround(factor * clusterRatio * m_cellCosts[cell])));
+  }
+}
+
+void CalibratedWeights::setAllowedImbalances() {
+  assert(m_ncon == 1 && "single constraint partitioning");
+  m_imbalances.resize(m_ncon);
+
+  constexpr double tinyLtsWeightImbalance{1.01};
+  m_imbalances[0] = tinyLtsWeightImbalance;
+}
 }
@@ -1,6 +1,7 @@
 #ifndef SEISSOL_LTSWEIGHTSMODELS_H
 #define SEISSOL_LTSWEIGHTSMODELS_H
 
+#include "CostModel.h"
 #include "LtsWeights.h"
 
 namespace seissol {
@@ -48,6 +49,24 @@ protected:
   void setVertexWeights() final;
   void setAllowedImbalances() final;
 };
+
+
+/**
+ * Exponential weights with the element and dynamic rupture costs measured in a previous run
+ * (see CostModel), instead of the vertex weights of the parameter file.
+ */
+class CalibratedWeights : public LtsWeights {
+public:
+  explicit CalibratedWeights(const LtsWeightsConfig& config, seissol::SeisSol& seissolInstance);
+  ~CalibratedWeights() override = default;
+
+protected:
+  int evaluateNumberOfConstraints() final { return 1; }
+  void setVertexWeights() final;
+  void setAllowedImbalances() final;
+
+  CostModel m_costModel;
+};
 }
 }
 
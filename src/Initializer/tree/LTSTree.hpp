@@ -45,6 +45,7 @@
 #include "TimeCluster.hpp"
 
 #include "Initializer/MemoryAllocator.h"
+#include "Parallel/Numa.h"
 
 namespace seissol {
   namespace initializer {
@@ -214,6 +215,25 @@ public:
     }
   }
 
+  /**
+   * Adds the estimated number of bytes of all variables and buckets (in host memory) on each NUMA
+   * node to bytesPerNode. Returns false if the placement is unknown.
+   */
+  bool addBytesPerNumaNode(std::vector<size_t>& bytesPerNode) const {
+    bool known = true;
+    for (unsigned var = 0; var < variableSizes.size(); ++var) {
+      if (varInfo[var].memkind != seissol::memory::DeviceGlobalMemory) {
+        known = seissol::parallel::addBytesPerNumaNode(m_vars[var], variableSizes[var], bytesPerNode) && known;
+      }
+    }
+    for (unsigned bucket = 0; bucket < bucketSizes.size(); ++bucket) {
+      if (bucketInfo[bucket].memkind != seissol::memory::DeviceGlobalMemory) {
+        known = seissol::parallel::addBytesPerNumaNode(m_buckets[bucket], bucketSizes[bucket], bytesPerNode) && known;
+      }
+    }
+    return known;
+  }
+
   const std::vector<size_t>& getVariableSizes() {
     return variableSizes;
   }
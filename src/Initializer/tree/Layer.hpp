@@ -44,6 +44,7 @@
 #include "Initializer/MemoryAllocator.h"
 #include "Initializer/BatchRecorders/DataTypes/ConditionalTable.hpp"
 #include "Initializer/DeviceGraph.h"
+#include "Parallel/TaskLoop.hpp"
 #include <bitset>
 #include <limits>
 #include <cstring>
@@ -253,12 +254,13 @@ public:
       // NOTE: we don't touch device global memory because it is in a different address space
       // we will do deep-copy from the host to a device later on
       if (!isMasked(vars[var].mask) && (vars[var].memkind != seissol::memory::DeviceGlobalMemory)) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (unsigned cell = 0; cell < m_numberOfCells; ++cell) {
-          memset(static_cast<char*>(m_vars[var]) + cell * vars[var].bytes, 0, vars[var].bytes);
-        }
+        // First touch with the schedule of the compute loops, such that the pages of a cell are
+        // placed on the NUMA node of the thread which works on this cell.
+        char* memory = static_cast<char*>(m_vars[var]);
+        const size_t bytes = vars[var].bytes;
+        seissol::parallel::forEach(m_numberOfCells, [&](size_t cell) {
+          memset(memory + cell * bytes, 0, bytes);
+        });
       }
     }
   }
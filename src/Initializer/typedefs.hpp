@@ -335,11 +335,22 @@ struct CompoundGlobalData {
 
 // data for the cell local integration
 struct LocalIntegrationData {
+#ifdef USE_COMPACT_INTEGRATION_DATA
+  // gradients of the reference coordinates xi, eta and zeta
+  real gradients[3][3];
+
+  // normal, first and second tangent of the faces
+  real faceFrames[4][3][3];
+
+  // scaling of the flux solvers, -2 |S_side| / (6 |J|)
+  real fluxScales[4];
+#else
   // star matrices
   real starMatrices[3][seissol::tensor::star::size(0)];
 
   // flux solver for element local contribution
   real nApNm1[4][seissol::tensor::AplusT::size()];
+#endif
 
   // equation-specific data
   //TODO(Lukas/Sebastian):
@@ -357,8 +368,10 @@ struct LocalIntegrationData {
 
 // data for the neighboring boundary integration
 struct NeighboringIntegrationData {
+#ifndef USE_COMPACT_INTEGRATION_DATA
   // flux solver for the contribution of the neighboring elements
   real nAmNm1[4][seissol::tensor::AminusT::size()];
+#endif
 
   // equation-specific data
   //TODO(Lukas/Sebastian):
@@ -433,12 +446,24 @@ struct CellDRMapping {
   real* fluxSolver;
 };
 
+/*
+ * Expansion of the nodal boundary data of an analytical boundary face in time, i.e.
+ * INodal(t) = sum_k P_k(2 (t - start) / (end - start) - 1) coefficients[k], where P_k is the
+ * k-th Legendre polynomial. See DirichletBoundary::evaluateTimeDependent.
+ */
+struct AnalyticalBoundaryExpansion {
+  double start;
+  double end;
+  real coefficients[CONVERGENCE_ORDER * seissol::tensor::INodal::size()];
+};
+
 struct CellBoundaryMapping {
   real* nodes;
   real* TData;
   real* TinvData;
   real* easiBoundaryConstant;
   real* easiBoundaryMap;
+  AnalyticalBoundaryExpansion* analyticalExpansion;
 };
 
 struct BoundaryFaceInformation {
@@ -0,0 +1,115 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "CellMatrices.h"
+
+#include "Equations/Setup.h"
+#include "Model/common.hpp"
+#include "generated_code/init.h"
+#include "generated_code/kernel.h"
+
+namespace seissol::kernels {
+
+void computeStarMatrices(const CellMaterialData& material,
+                         const real gradients[3][3],
+                         real starMatrices[3][tensor::star::size(0)]) {
+  real ATData[tensor::star::size(0)];
+  real BTData[tensor::star::size(1)];
+  real CTData[tensor::star::size(2)];
+  auto AT = init::star::view<0>::create(ATData);
+  auto BT = init::star::view<0>::create(BTData);
+  auto CT = init::star::view<0>::create(CTData);
+
+  seissol::model::getTransposedCoefficientMatrix(material.local, 0, AT);
+  seissol::model::getTransposedCoefficientMatrix(material.local, 1, BT);
+  seissol::model::getTransposedCoefficientMatrix(material.local, 2, CT);
+
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    for (unsigned idx = 0; idx < tensor::star::size(0); ++idx) {
+      starMatrices[dim][idx] = gradients[dim][0] * ATData[idx];
+    }
+    for (unsigned idx = 0; idx < tensor::star::size(1); ++idx) {
+      starMatrices[dim][idx] += gradients[dim][1] * BTData[idx];
+    }
+    for (unsigned idx = 0; idx < tensor::star::size(2); ++idx) {
+      starMatrices[dim][idx] += gradients[dim][2] * CTData[idx];
+    }
+  }
+}
+
+void computeFluxSolvers(const CellMaterialData& material,
+                        unsigned side,
+                        FaceType faceType,
+                        const VrtxCoords normal,
+                        const VrtxCoords tangent1,
+                        const VrtxCoords tangent2,
+                        real fluxScale,
+                        real* AplusT,
+                        real* AminusT) {
+  if (AplusT == nullptr && AminusT == nullptr) {
+    return;
+  }
+
+  // AT with elastic parameters in local coordinate system, used for flux kernel
+  real ATtildeData[tensor::star::size(0)];
+  auto ATtilde = init::star::view<0>::create(ATtildeData);
+
+  real TData[tensor::T::size()];
+  real TinvData[tensor::Tinv::size()];
+  auto T = init::T::view::create(TData);
+  auto Tinv = init::Tinv::view::create(TinvData);
+
+  real QgodLocalData[tensor::QgodLocal::size()];
+  real QgodNeighborData[tensor::QgodNeighbor::size()];
+  auto QgodLocal = init::QgodLocal::view::create(QgodLocalData);
+  auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
+
+  if (material.local.getMaterialType() == seissol::model::MaterialType::anisotropic) {
+    real NLocalData[6 * 6];
+    seissol::model::getBondMatrix(normal, tangent1, tangent2, NLocalData);
+    auto localMaterial =
+        *dynamic_cast<const seissol::model::AnisotropicMaterial*>(&material.local);
+    auto neighborMaterial =
+        *dynamic_cast<const seissol::model::AnisotropicMaterial*>(&material.neighbor[side]);
+    const auto local = seissol::model::getRotatedMaterialCoefficients(NLocalData, localMaterial);
+    const auto neighbor =
+        seissol::model::getRotatedMaterialCoefficients(NLocalData, neighborMaterial);
+    seissol::model::getTransposedGodunovState(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+    seissol::model::getTransposedCoefficientMatrix(local, 0, ATtilde);
+  } else {
+    seissol::model::getTransposedGodunovState(
+        material.local, material.neighbor[side], faceType, QgodLocal, QgodNeighbor);
+    seissol::model::getTransposedCoefficientMatrix(material.local, 0, ATtilde);
+  }
+
+  // Calculate transposed T instead
+  seissol::model::getFaceRotationMatrix(normal, tangent1, tangent2, T, Tinv);
+
+  if (AplusT != nullptr) {
+    kernel::computeFluxSolverLocal localKrnl;
+    localKrnl.fluxScale = fluxScale;
+    localKrnl.AplusT = AplusT;
+    localKrnl.QgodLocal = QgodLocalData;
+    localKrnl.T = TData;
+    localKrnl.Tinv = TinvData;
+    localKrnl.star(0) = ATtildeData;
+    localKrnl.execute();
+  }
+
+  if (AminusT != nullptr) {
+    kernel::computeFluxSolverNeighbor neighKrnl;
+    neighKrnl.fluxScale = fluxScale;
+    neighKrnl.AminusT = AminusT;
+    neighKrnl.QgodNeighbor = QgodNeighborData;
+    neighKrnl.T = TData;
+    neighKrnl.Tinv = TinvData;
+    neighKrnl.star(0) = ATtildeData;
+    if (faceType == FaceType::dirichlet || faceType == FaceType::freeSurfaceGravity) {
+      // Already rotated!
+      neighKrnl.Tinv = init::identityT::Values;
+    }
+    neighKrnl.execute();
+  }
+}
+
+} // namespace seissol::kernels
@@ -0,0 +1,80 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef KERNELS_CELLMATRICES_H_
+#define KERNELS_CELLMATRICES_H_
+
+#include "Geometry/MeshDefinition.h"
+#include "Initializer/typedefs.hpp"
+#include "generated_code/tensor.h"
+
+namespace seissol::kernels {
+
+/**
+ * Computes the star matrices A*, B*, and C* of a cell.
+ *
+ * @param gradients The gradients of the reference coordinates xi, eta, and zeta.
+ */
+void computeStarMatrices(const CellMaterialData& material,
+                         const real gradients[3][3],
+                         real starMatrices[3][tensor::star::size(0)]);
+
+/**
+ * Solves the Riemann problem at a face of a cell and computes the flux solvers
+ * for the contribution of the cell and of its neighbor.
+ *
+ * @param normal, tangent1, tangent2 The normalized normal and tangents of the face.
+ * @param fluxScale The scaling -2 |S_side| / (6 |J|) of the flux solvers.
+ * @param AplusT The flux solver for the local contribution (skipped if nullptr).
+ * @param AminusT The flux solver for the neighbor contribution (skipped if nullptr).
+ */
+void computeFluxSolvers(const CellMaterialData& material,
+                        unsigned side,
+                        FaceType faceType,
+                        const VrtxCoords normal,
+                        const VrtxCoords tangent1,
+                        const VrtxCoords tangent2,
+                        real fluxScale,
+                        real* AplusT,
+                        real* AminusT);
+
+#ifdef USE_COMPACT_INTEGRATION_DATA
+/**
+ * Computes the star matrices of a cell from its compact integration data.
+ */
+inline void computeStarMatrices(const CellMaterialData& material,
+                                const LocalIntegrationData& localIntegration,
+                                real starMatrices[3][tensor::star::size(0)]) {
+  computeStarMatrices(material, localIntegration.gradients, starMatrices);
+}
+
+/**
+ * Computes the flux solvers of a face from the compact integration data of the cell.
+ */
+inline void computeFluxSolvers(const CellMaterialData& material,
+                               const LocalIntegrationData& localIntegration,
+                               unsigned side,
+                               FaceType faceType,
+                               real* AplusT,
+                               real* AminusT) {
+  VrtxCoords frame[3];
+  for (unsigned i = 0; i < 3; ++i) {
+    for (unsigned j = 0; j < 3; ++j) {
+      frame[i][j] = localIntegration.faceFrames[side][i][j];
+    }
+  }
+  computeFluxSolvers(material,
+                     side,
+                     faceType,
+                     frame[0],
+                     frame[1],
+                     frame[2],
+                     localIntegration.fluxScales[side],
+                     AplusT,
+                     AminusT);
+}
+#endif
+
+} // namespace seissol::kernels
+
+#endif // KERNELS_CELLMATRICES_H_
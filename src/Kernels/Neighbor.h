@@ -74,6 +74,7 @@
 #include "Initializer/typedefs.hpp"
 #include "Kernels/Interface.hpp"
 #include "Kernels/NeighborBase.h"
+#include "Kernels/NeighborGroups.h"
 
 namespace seissol {
   namespace kernels {
@@ -91,6 +92,21 @@ class seissol::kernels::Neighbor : public NeighborBase {
                                   real* i_timeIntegrated[4],
                                   real* faceNeighbors_prefetch[4]);
 
+    /**
+     * Computes the neighbor integral of all cells of a block, see NeighborGroups.
+     *
+     * @param timeIntegrated time integrated DOFs of the face neighbors, per cell of the layer.
+     * @param compressedFaceNeighbors single precision time integrated DOFs of the face neighbors,
+     *        per cell of the layer; used instead of timeIntegrated where not NULL.
+     *        NULL if the single precision buffers are disabled.
+     **/
+    void computeGroupedNeighborsIntegral(NeighborData::Loader& loader,
+                                         const NeighborGroups& groups,
+                                         unsigned block,
+                                         CellDRMapping const (*cellDrMapping)[4],
+                                         real* (*timeIntegrated)[4],
+                                         float* (*compressedFaceNeighbors)[4]);
+
     void computeBatchedNeighborsIntegral(ConditionalPointersToRealsTable &table);
 
     void flopsNeighborsIntegral(const FaceType i_faceTypes[4],
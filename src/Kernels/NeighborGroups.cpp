@@ -0,0 +1,116 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "NeighborGroups.h"
+
+#include <algorithm>
+#include <cassert>
+#include <tuple>
+#include <unordered_map>
+
+void seissol::kernels::NeighborGroups::build(const CellLocalInformation* cellInformation,
+                                             const CellDRMapping (*drMapping)[4],
+                                             unsigned numberOfCells,
+                                             unsigned numberOfThreads) {
+  // Smaller blocks for small layers, such that all threads get some work
+  const unsigned tasks = 4 * std::max(numberOfThreads, 1u);
+  const unsigned blockSize =
+      std::clamp((numberOfCells + tasks - 1) / tasks, 1u, MaxBlockSize);
+
+  m_blockOffsets.assign(1, 0);
+  m_groupOffsets.assign(1, 0);
+  m_groups.clear();
+  m_cells.clear();
+  m_cells.reserve(4 * static_cast<std::size_t>(numberOfCells));
+
+  using GroupMap = std::unordered_map<initializer::recording::ConditionalKey,
+                                      std::vector<unsigned>,
+                                      initializer::recording::ConditionalHash<
+                                          initializer::recording::ConditionalKey>>;
+  GroupMap groupMap;
+  std::vector<initializer::recording::ConditionalKey> keys;
+
+  for (unsigned blockBegin = 0; blockBegin < numberOfCells; blockBegin += blockSize) {
+    const unsigned blockEnd = std::min(blockBegin + blockSize, numberOfCells);
+
+    groupMap.clear();
+    for (unsigned cell = blockBegin; cell < blockEnd; ++cell) {
+      for (unsigned face = 0; face < 4; ++face) {
+        switch (cellInformation[cell].faceTypes[face]) {
+        case FaceType::regular:
+          // Fallthrough intended
+        case FaceType::periodic: {
+          assert(cellInformation[cell].faceRelations[face][0] < 4 &&
+                 cellInformation[cell].faceRelations[face][1] < 3);
+          const unsigned faceRelation = cellInformation[cell].faceRelations[face][1] +
+                                        3 * cellInformation[cell].faceRelations[face][0] +
+                                        12 * face;
+          groupMap[initializer::recording::ConditionalKey(
+                       *KernelNames::NeighborFlux,
+                       (FaceKinds::Regular || FaceKinds::Periodic),
+                       face,
+                       faceRelation)]
+              .push_back(cell);
+          break;
+        }
+        case FaceType::dynamicRupture: {
+          const unsigned faceRelation =
+              drMapping[cell][face].side + 4 * drMapping[cell][face].faceRelation;
+          groupMap[initializer::recording::ConditionalKey(
+                       *KernelNames::NeighborFlux, *FaceKinds::DynamicRupture, face, faceRelation)]
+              .push_back(cell);
+          break;
+        }
+        default:
+          break;
+        }
+      }
+    }
+
+    // Process the faces in the order of the cell-wise kernel
+    keys.clear();
+    for (const auto& entry : groupMap) {
+      keys.push_back(entry.first);
+    }
+    std::sort(keys.begin(), keys.end(), [](const auto& lhs, const auto& rhs) {
+      return std::tie(lhs.faceId, lhs.typeId, lhs.faceRelationId) <
+             std::tie(rhs.faceId, rhs.typeId, rhs.faceRelationId);
+    });
+
+    for (const auto& key : keys) {
+      const auto& groupCells = groupMap[key];
+      Group group{key, static_cast<unsigned>(m_cells.size()), 0};
+      m_cells.insert(m_cells.end(), groupCells.begin(), groupCells.end());
+      group.end = m_cells.size();
+      m_groups.push_back(group);
+    }
+
+    m_blockOffsets.push_back(blockEnd);
+    m_groupOffsets.push_back(m_groups.size());
+  }
+
+  // Scratch memory for the neighbors which provide derivatives
+  m_integrationSlots.assign(numberOfCells, NoSlot);
+  unsigned numberOfSlots = 0;
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      if (cellInformation[cell].faceTypes[face] != FaceType::outflow &&
+          cellInformation[cell].faceTypes[face] != FaceType::dynamicRupture &&
+          (cellInformation[cell].ltsSetup >> face) % 2 == 1) {
+        m_integrationSlots[cell] = numberOfSlots++;
+        break;
+      }
+    }
+  }
+
+  if (numberOfSlots > 0) {
+    const std::size_t size = 4 * static_cast<std::size_t>(numberOfSlots) * tensor::I::size();
+    m_integrationBuffer =
+        static_cast<real*>(m_allocator.allocateMemory(size * sizeof(real), ALIGNMENT));
+    std::fill_n(m_integrationBuffer, size, static_cast<real>(0));
+  }
+
+  m_timeIntegrated.assign(4 * static_cast<std::size_t>(numberOfCells), nullptr);
+
+  m_built = true;
+}
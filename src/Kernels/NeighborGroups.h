@@ -0,0 +1,99 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef KERNELS_NEIGHBORGROUPS_H_
+#define KERNELS_NEIGHBORGROUPS_H_
+
+#include <vector>
+
+#include "Initializer/BatchRecorders/DataTypes/ConditionalTable.hpp"
+#include "Initializer/MemoryAllocator.h"
+#include "Initializer/typedefs.hpp"
+#include "generated_code/tensor.h"
+
+namespace seissol::kernels {
+
+/**
+ * Groups the faces of the cells of a layer for the neighbor integration on the host.
+ *
+ * The layer is split into blocks of contiguous cells. Within a block, the regular and periodic
+ * faces are grouped by face and face relation, the dynamic rupture faces by face, side and
+ * face relation. The groups use the same keys as the batch tables of the device
+ * (see Initializer/BatchRecorders) and are sorted by the face first. Hence, processing the
+ * groups of a block in order adds the contributions of the faces of each cell in the same
+ * order as the cell-wise neighbor integration, while each group executes one kernel variant
+ * with the same flux matrices for many cells.
+ *
+ * The layer also holds the scratch memory for the time integrated DOFs of neighbors which
+ * provide derivatives (LTS).
+ */
+class NeighborGroups {
+  public:
+  struct Group {
+    initializer::recording::ConditionalKey key;
+    unsigned begin;
+    unsigned end;
+  };
+
+  //! Maximum number of cells in one block
+  static constexpr unsigned MaxBlockSize = 128;
+
+  /**
+   * @param numberOfThreads Number of threads the blocks are distributed to.
+   */
+  void build(const CellLocalInformation* cellInformation,
+             const CellDRMapping (*drMapping)[4],
+             unsigned numberOfCells,
+             unsigned numberOfThreads);
+
+  bool isBuilt() const { return m_built; }
+
+  unsigned numberOfBlocks() const { return m_blockOffsets.size() - 1; }
+
+  unsigned blockBegin(unsigned block) const { return m_blockOffsets[block]; }
+
+  unsigned blockEnd(unsigned block) const { return m_blockOffsets[block + 1]; }
+
+  const Group* groupsBegin(unsigned block) const { return &m_groups[m_groupOffsets[block]]; }
+
+  const Group* groupsEnd(unsigned block) const { return &m_groups[m_groupOffsets[block + 1]]; }
+
+  //! Cells of the layer, the groups refer to ranges of this array
+  const unsigned* cells() const { return m_cells.data(); }
+
+  /**
+   * Returns the scratch memory for the time integration of the neighbors of a cell.
+   * Returns nullptr if no neighbor of the cell provides derivatives.
+   */
+  real (*integrationBuffer(unsigned cell))[tensor::I::size()] {
+    if (m_integrationSlots[cell] == NoSlot) {
+      return nullptr;
+    }
+    return reinterpret_cast<real(*)[tensor::I::size()]>(
+        &m_integrationBuffer[4 * static_cast<std::size_t>(m_integrationSlots[cell]) *
+                             tensor::I::size()]);
+  }
+
+  //! Pointers to the time integrated DOFs of the neighbors, per cell
+  real* (*timeIntegrated())[4] { return reinterpret_cast<real*(*)[4]>(m_timeIntegrated.data()); }
+
+  private:
+  static constexpr unsigned NoSlot = ~0u;
+
+  bool m_built{false};
+
+  std::vector<unsigned> m_blockOffsets{0};
+  std::vector<unsigned> m_groupOffsets{0};
+  std::vector<Group> m_groups;
+  std::vector<unsigned> m_cells;
+
+  std::vector<unsigned> m_integrationSlots;
+  real* m_integrationBuffer{nullptr};
+  std::vector<real*> m_timeIntegrated;
+
+  memory::ManagedAllocator m_allocator;
+};
+
+} // namespace seissol::kernels
+
+#endif
@@ -44,6 +44,8 @@
 #include <cstring>
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 #include "generated_code/kernel.h"
 #include "generated_code/init.h"
 #include "common.hpp"
@@ -442,6 +444,119 @@ namespace seissol::kernels {
 #endif // ACL_DEVICE
   }
 
+  namespace {
+    /* Factors of the bound on the nodal stresses from the modal stresses:
+     * The first basis function is constant. Hence, the stress at node k splits into
+     * the cell-average part and the remainder r_k = sum_{l >= 1} v_{kl} Q_l, with
+     * |r_k| <= highModesFactor * sqrt( sum_{l >= 1} |Q_l|^2 ) (Cauchy-Schwarz),
+     * where |.| is the Frobenius norm of the stress tensor. */
+    struct YieldBoundFactors {
+      real constantModeValue;
+      real highModesFactor;
+    };
+
+    YieldBoundFactors computeYieldBoundFactors() {
+      real unitStress[tensor::QStress::size()] __attribute__((aligned(ALIGNMENT))) = {};
+      real QStressNodal[tensor::QStressNodal::size()] __attribute__((aligned(ALIGNMENT))) = {};
+      real v[tensor::v::size()] __attribute__((aligned(ALIGNMENT)));
+      std::copy_n(init::v::Values, tensor::v::size(), v);
+
+      auto unitStressView = init::QStress::view::create(unitStress);
+      auto QStressNodalView = init::QStressNodal::view::create(QStressNodal);
+      const unsigned numBasisFunctions = unitStressView.shape(0);
+      const unsigned numNodes = QStressNodalView.shape(0);
+
+      kernel::plConvertToNodalNoLoading m2nKrnl;
+      m2nKrnl.v = v;
+      m2nKrnl.QStress = unitStress;
+      m2nKrnl.QStressNodal = QStressNodal;
+
+      YieldBoundFactors factors{};
+      std::vector<real> sumOfSquares(numNodes, 0.0);
+      for (unsigned l = 0; l < numBasisFunctions; ++l) {
+        unitStressView(l, 0) = 1.0;
+        m2nKrnl.execute();
+        unitStressView(l, 0) = 0.0;
+
+        if (l == 0) {
+          factors.constantModeValue = QStressNodalView(0, 0);
+          for (unsigned k = 0; k < numNodes; ++k) {
+            assert(std::abs(QStressNodalView(k, 0) - factors.constantModeValue) <=
+                   1e3 * std::numeric_limits<real>::epsilon() * std::abs(factors.constantModeValue));
+          }
+        } else {
+          for (unsigned k = 0; k < numNodes; ++k) {
+            sumOfSquares[k] += QStressNodalView(k, 0) * QStressNodalView(k, 0);
+          }
+        }
+      }
+      factors.highModesFactor = std::sqrt(*std::max_element(sumOfSquares.begin(), sumOfSquares.end()));
+      return factors;
+    }
+  } // namespace
+
+  bool Plasticity::isElastic(PlasticityData const *plasticityData,
+                             real const degreesOfFreedom[tensor::Q::size()]) {
+    static const YieldBoundFactors factors = computeYieldBoundFactors();
+
+    auto QStressView = init::QStress::view::create(const_cast<real*>(degreesOfFreedom));
+    const unsigned numBasisFunctions = QStressView.shape(0);
+
+    // stress of the cell average
+    real averageStress[6];
+    for (unsigned p = 0; p < 6; ++p) {
+      averageStress[p] = factors.constantModeValue * QStressView(0, p) + plasticityData->initialLoading[p];
+    }
+    const real averageMean = (averageStress[0] + averageStress[1] + averageStress[2]) / 3.0;
+    real averageSecondInvariant = 0.0;
+    for (unsigned p = 0; p < 3; ++p) {
+      averageSecondInvariant += 0.5 * (averageStress[p] - averageMean) * (averageStress[p] - averageMean);
+    }
+    for (unsigned p = 3; p < 6; ++p) {
+      averageSecondInvariant += averageStress[p] * averageStress[p];
+    }
+
+    // Frobenius norm of the higher modes, shear components count twice
+    real normalSquares = 0.0;
+    real shearSquares = 0.0;
+    for (unsigned l = 1; l < numBasisFunctions; ++l) {
+      for (unsigned p = 0; p < 3; ++p) {
+        normalSquares += QStressView(l, p) * QStressView(l, p);
+      }
+      for (unsigned p = 3; p < 6; ++p) {
+        shearSquares += QStressView(l, p) * QStressView(l, p);
+      }
+    }
+    const real remainderBound = factors.highModesFactor * std::sqrt(normalSquares + 2.0 * shearSquares);
+
+    /* At every node, with the remainder r of the stress:
+     * tau <= sqrt(I_2(average)) + sqrt(I_2(r)) <= sqrt(I_2(average)) + |r| / sqrt(2),
+     * m >= m_average - |r| / sqrt(3), hence tau_c >= taulim(m_average) - |sin(phi)| |r| / sqrt(3). */
+    const real sinAngularFriction = plasticityData->sinAngularFriction;
+    const real tauBound = std::sqrt(averageSecondInvariant) + remainderBound * std::sqrt(0.5);
+    const real taulimBound = plasticityData->cohesionTimesCosAngularFriction
+                             - averageMean * sinAngularFriction
+                             - std::abs(sinAngularFriction) * remainderBound / std::sqrt(3.0);
+
+    // safety margin for the rounding errors of the nodal evaluation
+    constexpr real margin = 1e3 * std::numeric_limits<real>::epsilon();
+    const real scale = tauBound + std::abs(plasticityData->cohesionTimesCosAngularFriction)
+                       + std::abs(averageMean * sinAngularFriction);
+    return tauBound + margin * scale <= taulimBound;
+  }
+
+  void Plasticity::flopsElasticCheck(long long &o_NonZeroFlops,
+                                     long long &o_HardwareFlops) {
+    const unsigned numBasisFunctions = tensor::QStress::Shape[0];
+    // average stress, mean and second invariant
+    o_NonZeroFlops = 12 + 3 + 15;
+    // norm of the higher modes
+    o_NonZeroFlops += 2 * 6 * (numBasisFunctions - 1) + 3;
+    // bounds
+    o_NonZeroFlops += 12;
+    o_HardwareFlops = o_NonZeroFlops;
+  }
+
   void Plasticity::flopsPlasticity(long long &o_NonZeroFlopsCheck,
                                    long long &o_HardwareFlopsCheck,
                                    long long &o_NonZeroFlopsYield,
@@ -65,6 +65,13 @@ public:
                                      real                        degreesOfFreedom[tensor::Q::size()],
                                      real*                       pstrain);
 
+  /** Returns true if no node of the cell can yield, such that computePlasticity may be skipped.
+   *  The check bounds the nodal stresses by the cell average and the norm of the higher modes,
+   *  hence it is conservative: it may return false for cells which do not yield.
+   */
+  static bool isElastic( PlasticityData const* plasticityData,
+                         real const            degreesOfFreedom[tensor::Q::size()] );
+
   static unsigned computePlasticityBatched(double relaxTime,
                                            double timeStepWidth,
                                            double T_v,
@@ -76,6 +83,9 @@ public:
                                 long long&  o_hardwareFlopsCheck,
                                 long long&  o_nonZeroFlopsYield,
                                 long long&  o_hardwareFlopsYield );
+
+  static void flopsElasticCheck( long long& o_nonZeroFlops,
+                                 long long& o_hardwareFlops );
 };
 
 #endif
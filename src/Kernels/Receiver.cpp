@@ -40,6 +40,7 @@
 #include "Monitoring/FlopCounter.hpp"
 #include "Numerical_aux/BasisFunction.h"
 #include "Parallel/DataCollector.h"
+#include "Parallel/TaskLoop.hpp"
 #include "Receiver.h"
 #include "SeisSol.h"
 #include "generated_code/kernel.h"
@@ -75,98 +76,123 @@ void seissol::kernels::ReceiverCluster::addReceiver(  unsigned
 double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
                                                           double expansionPoint,
                                                           double timeStepWidth ) {
-  
-  alignas(ALIGNMENT) real timeEvaluated[tensor::Q::size()];
-  alignas(ALIGNMENT) real timeEvaluatedAtPoint[tensor::QAtPoint::size()];
-  alignas(ALIGNMENT) real timeEvaluatedDerivativesAtPoint[tensor::QDerivativeAtPoint::size()];
-#ifdef USE_STP
-  alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()];
-  kernel::evaluateDOFSAtPointSTP krnl;
-  krnl.QAtPoint = timeEvaluatedAtPoint;
-  krnl.spaceTimePredictor = stp;
-  kernel::evaluateDerivativeDOFSAtPointSTP derivativeKrnl;
-  derivativeKrnl.QDerivativeAtPoint = timeEvaluatedDerivativesAtPoint;
-  derivativeKrnl.spaceTimePredictor = stp;
-#else
-  alignas(ALIGNMENT) real timeDerivatives[yateto::computeFamilySize<tensor::dQ>()];
-  kernels::LocalTmp tmp(seissolInstance.getGravitationSetup().acceleration);
-
-  kernel::evaluateDOFSAtPoint krnl;
-  krnl.QAtPoint = timeEvaluatedAtPoint;
-  krnl.Q = timeEvaluated;
-  kernel::evaluateDerivativeDOFSAtPoint derivativeKrnl;
-  derivativeKrnl.QDerivativeAtPoint = timeEvaluatedDerivativesAtPoint;
-  derivativeKrnl.Q = timeEvaluated;
-#endif
-
+  if (m_receivers.empty()) {
+    return time;
+  }
 
-  auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
-  auto qDerivativeAtPoint = init::QDerivativeAtPoint::view::create(timeEvaluatedDerivativesAtPoint);
+  // All receivers are sampled at the same points in time
+  std::vector<double> sampleTimes;
+  double receiverTime = time;
+  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
+    while (receiverTime < expansionPoint + timeStepWidth) {
+      sampleTimes.push_back(receiverTime);
+      receiverTime += m_samplingInterval;
+    }
+  }
+  if (sampleTimes.empty()) {
+    return receiverTime;
+  }
 
 #ifdef ACL_DEVICE
   deviceCollector->gatherToHost(device::DeviceInstance::getInstance().api->getDefaultStream());
   device::DeviceInstance::getInstance().api->syncDefaultStreamWithHost();
 #endif
 
-  double receiverTime = time;
-  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
-    for (size_t i = 0; i < m_receivers.size(); ++i) {
-      auto& receiver = m_receivers[i];
-      krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
-      derivativeKrnl.basisFunctionDerivativesAtPoint = receiver.basisFunctionDerivatives.m_data.data();
+  const auto numberOfColumns = ncols();
+  const auto numberOfSamples = sampleTimes.size();
+
+  // One prediction per cell serves all receivers inside it
+  parallel::forEach(m_cellReceivers.size(), [&](std::size_t cell) {
+    const auto& receiverIds = m_cellReceivers[cell];
+
+    alignas(ALIGNMENT) real timeEvaluated[tensor::Q::size()];
+    alignas(ALIGNMENT) real timeEvaluatedAtPoint[tensor::QAtPoint::size()];
+    alignas(ALIGNMENT) real timeEvaluatedDerivativesAtPoint[tensor::QDerivativeAtPoint::size()];
+#ifdef USE_STP
+    alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()];
+    kernel::evaluateDOFSAtPointSTP krnl;
+    krnl.QAtPoint = timeEvaluatedAtPoint;
+    krnl.spaceTimePredictor = stp;
+    kernel::evaluateDerivativeDOFSAtPointSTP derivativeKrnl;
+    derivativeKrnl.QDerivativeAtPoint = timeEvaluatedDerivativesAtPoint;
+    derivativeKrnl.spaceTimePredictor = stp;
+#else
+    alignas(ALIGNMENT) real timeDerivatives[yateto::computeFamilySize<tensor::dQ>()];
+    kernels::LocalTmp tmp(seissolInstance.getGravitationSetup().acceleration);
+
+    kernel::evaluateDOFSAtPoint krnl;
+    krnl.QAtPoint = timeEvaluatedAtPoint;
+    krnl.Q = timeEvaluated;
+    kernel::evaluateDerivativeDOFSAtPoint derivativeKrnl;
+    derivativeKrnl.QDerivativeAtPoint = timeEvaluatedDerivativesAtPoint;
+    derivativeKrnl.Q = timeEvaluated;
+#endif
 
-      // Copy DOFs from device to host.
-      LocalData tmpReceiverData { receiver.data };
+    auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
+    auto qDerivativeAtPoint = init::QDerivativeAtPoint::view::create(timeEvaluatedDerivativesAtPoint);
+
+    // Copy DOFs from device to host.
+    LocalData tmpReceiverData { m_receivers[receiverIds[0]].data };
 #ifdef ACL_DEVICE
-      tmpReceiverData.dofs_ptr = reinterpret_cast<decltype(tmpReceiverData.dofs_ptr)>(deviceCollector->get(deviceIndices[i]));
+    tmpReceiverData.dofs_ptr = reinterpret_cast<decltype(tmpReceiverData.dofs_ptr)>(deviceCollector->get(deviceIndices[receiverIds[0]]));
 #endif
-      
 
 #ifdef USE_STP
-      m_timeKernel.executeSTP(timeStepWidth, tmpReceiverData, timeEvaluated, stp);
+    m_timeKernel.executeSTP(timeStepWidth, tmpReceiverData, timeEvaluated, stp);
 #else
-      m_timeKernel.computeAder( timeStepWidth,
-                                tmpReceiverData,
-                                tmp,
-                                timeEvaluated, // useless but the interface requires it
-                                timeDerivatives );
+    m_timeKernel.computeAder( timeStepWidth,
+                              tmpReceiverData,
+                              tmp,
+                              timeEvaluated, // useless but the interface requires it
+                              timeDerivatives );
 #endif
-      seissolInstance.flopCounter().incrementNonZeroFlopsOther(m_nonZeroFlops);
-      seissolInstance.flopCounter().incrementHardwareFlopsOther(m_hardwareFlops);
 
-      receiverTime = time;
-      while (receiverTime < expansionPoint + timeStepWidth) {
+    // The samples of this time step are appended to the (reserved) output of each receiver
+    for (auto receiverId : receiverIds) {
+      auto& output = m_receivers[receiverId].output;
+      output.resize(output.size() + numberOfSamples * numberOfColumns);
+    }
+
+    for (std::size_t sample = 0; sample < numberOfSamples; ++sample) {
 #ifdef USE_STP
-        //eval time basis
-        double tau = (time - expansionPoint) / timeStepWidth;
-        seissol::basisFunction::SampledTimeBasisFunctions<real> timeBasisFunctions(CONVERGENCE_ORDER, tau);
-        krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
-        derivativeKrnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
+      //eval time basis
+      double tau = (sampleTimes[sample] - expansionPoint) / timeStepWidth;
+      seissol::basisFunction::SampledTimeBasisFunctions<real> timeBasisFunctions(CONVERGENCE_ORDER, tau);
+      krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
+      derivativeKrnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
 #else
-        m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, timeDerivatives, timeEvaluated);
+      m_timeKernel.computeTaylorExpansion(sampleTimes[sample], expansionPoint, timeDerivatives, timeEvaluated);
 #endif
 
+      for (auto receiverId : receiverIds) {
+        auto& receiver = m_receivers[receiverId];
+        krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
         krnl.execute();
-        derivativeKrnl.execute();
+        if (m_computeRotation) {
+          derivativeKrnl.basisFunctionDerivativesAtPoint = receiver.basisFunctionDerivatives.m_data.data();
+          derivativeKrnl.execute();
+        }
 
-        receiver.output.push_back(receiverTime);
+        real* output = receiver.output.data() + receiver.output.size() -
+                       (numberOfSamples - sample) * numberOfColumns;
+        *output++ = sampleTimes[sample];
 #ifdef MULTIPLE_SIMULATIONS
         for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
           for (auto quantity : m_quantities) {
-           if (!std::isfinite(qAtPoint(sim, quantity))) {
-             logError()
-                 << "Detected Inf/NaN in receiver output at"
-                 << receiver.coordinates[0] << ","
-                 << receiver.coordinates[1] << ","
-                 << receiver.coordinates[2] << "."
-                 << "Aborting.";
-          }
-            receiver.output.push_back(qAtPoint(sim, quantity));
+            if (!std::isfinite(qAtPoint(sim, quantity))) {
+              logError()
+                  << "Detected Inf/NaN in receiver output at"
+                  << receiver.position[0] << ","
+                  << receiver.position[1] << ","
+                  << receiver.position[2] << "."
+                  << "Aborting.";
+            }
+            *output++ = qAtPoint(sim, quantity);
           }
           if (m_computeRotation) {
-            receiver.output.push_back(qDerivativeAtPoint(sim, 8, 1) - qDerivativeAtPoint(sim, 7, 2));
-            receiver.output.push_back(qDerivativeAtPoint(sim, 6, 2) - qDerivativeAtPoint(sim, 8, 0));
-            receiver.output.push_back(qDerivativeAtPoint(sim, 7, 0) - qDerivativeAtPoint(sim, 6, 1));
+            *output++ = qDerivativeAtPoint(sim, 8, 1) - qDerivativeAtPoint(sim, 7, 2);
+            *output++ = qDerivativeAtPoint(sim, 6, 2) - qDerivativeAtPoint(sim, 8, 0);
+            *output++ = qDerivativeAtPoint(sim, 7, 0) - qDerivativeAtPoint(sim, 6, 1);
           }
         }
 #else //MULTIPLE_SIMULATIONS
@@ -179,26 +205,28 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
                 << receiver.position[2] << "."
                 << "Aborting.";
           }
-          receiver.output.push_back(qAtPoint(quantity));
+          *output++ = qAtPoint(quantity);
         }
         if (m_computeRotation) {
-          receiver.output.push_back(qDerivativeAtPoint(8, 1) - qDerivativeAtPoint(7, 2));
-          receiver.output.push_back(qDerivativeAtPoint(6, 2) - qDerivativeAtPoint(8, 0));
-          receiver.output.push_back(qDerivativeAtPoint(7, 0) - qDerivativeAtPoint(6, 1));
+          *output++ = qDerivativeAtPoint(8, 1) - qDerivativeAtPoint(7, 2);
+          *output++ = qDerivativeAtPoint(6, 2) - qDerivativeAtPoint(8, 0);
+          *output++ = qDerivativeAtPoint(7, 0) - qDerivativeAtPoint(6, 1);
         }
 #endif //MULTITPLE_SIMULATIONS
-
-        receiverTime += m_samplingInterval;
       }
     }
-  }
+  });
+
+  seissolInstance.flopCounter().incrementNonZeroFlopsOther(m_cellReceivers.size() * m_nonZeroFlops);
+  seissolInstance.flopCounter().incrementHardwareFlopsOther(m_cellReceivers.size() * m_hardwareFlops);
+
   return receiverTime;
 }
 
 void seissol::kernels::ReceiverCluster::allocateData() {
-#ifdef ACL_DEVICE
-  // collect all data pointers to transfer. If we have multiple receivers on the same cell, we make sure to only transfer the related data once (hence, we use the `indexMap` here)
-  deviceIndices.resize(m_receivers.size());
+  // Group the receivers by cell. If we have multiple receivers on the same cell, the prediction
+  // is computed (and on GPUs, the data is transferred) only once.
+  m_cellReceivers.clear();
   std::vector<real*> dofs;
   std::unordered_map<real*, size_t> indexMap;
   for (size_t i = 0; i < m_receivers.size(); ++i) {
@@ -207,8 +235,14 @@ void seissol::kernels::ReceiverCluster::allocateData() {
       // point to the current array end
       indexMap[currentDofs] = dofs.size();
       dofs.push_back(currentDofs);
+      m_cellReceivers.emplace_back();
     }
-    deviceIndices[i] = indexMap.at(currentDofs);
+    m_cellReceivers[indexMap.at(currentDofs)].push_back(i);
+  }
+#ifdef ACL_DEVICE
+  deviceIndices.resize(m_receivers.size());
+  for (size_t i = 0; i < m_receivers.size(); ++i) {
+    deviceIndices[i] = indexMap.at(m_receivers[i].data.dofs());
   }
   deviceCollector = std::make_unique<seissol::parallel::DataCollector>(dofs, tensor::Q::size());
 #endif
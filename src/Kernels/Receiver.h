@@ -143,6 +143,8 @@ namespace seissol {
       std::unique_ptr<seissol::parallel::DataCollector> deviceCollector{nullptr};
       std::vector<size_t> deviceIndices;
       std::vector<Receiver> m_receivers;
+      //! indices of the receivers, grouped by cell
+      std::vector<std::vector<size_t>> m_cellReceivers;
       seissol::kernels::Time m_timeKernel;
       std::vector<unsigned> m_quantities;
       unsigned m_nonZeroFlops;
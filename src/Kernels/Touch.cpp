@@ -4,7 +4,9 @@
 
 #include "Touch.h"
 
+#include "Parallel/TaskLoop.hpp"
 #include "generated_code/tensor.h"
+#include <algorithm>
 #include <yateto.h>
 
 #ifdef ACL_DEVICE
@@ -14,10 +16,8 @@
 namespace seissol::kernels {
 
 void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned numberOfCells) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+  // Use the schedule of the compute loops for the first touch, see Layer::touchVariables
+  parallel::forEach(numberOfCells, [&](unsigned cell) {
     // touch buffers
     real* buffer = buffers[cell];
     if (buffer != NULL) {
@@ -34,9 +34,20 @@ void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned number
         derivative[dof] = (real)0;
       }
     }
-  }
+  });
 }
 
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+void touchCompressedBuffers(float** buffers, unsigned numberOfCells) {
+  parallel::forEach(numberOfCells, [&](unsigned cell) {
+    float* buffer = buffers[cell];
+    if (buffer != nullptr) {
+      std::fill_n(buffer, tensor::Q::size(), 0.0f);
+    }
+  });
+}
+#endif
+
 void fillWithStuff(real* buffer, unsigned nValues, [[maybe_unused]] bool onDevice) {
   // No real point for these numbers. Should be just something != 0 and != NaN and != Inf
   const auto stuff = [](unsigned n) { return static_cast<real>((214013 * n + 2531011) / 65536); };
@@ -9,6 +9,9 @@
 namespace seissol::kernels {
 
 void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned numberOfCells);
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+void touchCompressedBuffers(float** buffers, unsigned numberOfCells);
+#endif
 void fillWithStuff(real* buffer, unsigned nValues, bool onDevice);
 
 } // namespace seissol::kernels
@@ -24,6 +24,10 @@ double Module::potentialSyncPoint(double currentTime, double timeTolerance, bool
   return nextSyncPoint;
 }
 
+bool Module::isSyncPointDue(double time, double timeTolerance) const {
+  return std::abs(time - nextSyncPoint) < timeTolerance;
+}
+
 void Module::setSimulationStartTime(double time) {
   assert(isyncInterval > 0);
   lastSyncPoint = time;
@@ -77,6 +77,19 @@ class Module {
    */
   void setSimulationStartTime(double time);
 
+  /**
+   * @return True if the next synchronization point of this module is at the given time
+   */
+  bool isSyncPointDue(double time, double timeTolerance) const;
+
+  /**
+   * Whether all ranks have to be synchronized before the synchronization point of this
+   * module, e.g. because it evaluates a criterion to abort the simulation.
+   * Otherwise, ranks may continue with the time stepping while other ranks are still busy
+   * with their synchronization points.
+   */
+  virtual bool requiresGlobalSynchronization() const { return false; }
+
   //
   // Potential hooks
   //
@@ -118,6 +118,16 @@ void Modules::_setSimulationStartTime(double time) {
   }
 }
 
+bool Modules::_requiresGlobalSynchronization(double time, double timeTolerance) const {
+  for (const auto& [_, module] : hooks[static_cast<size_t>(ModuleHook::SynchronizationPoint)]) {
+    if (module->requiresGlobalSynchronization() && module->isSyncPointDue(time, timeTolerance)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 Modules& Modules::instance() {
   static Modules instance;
   return instance;
@@ -135,6 +145,10 @@ void Modules::setSimulationStartTime(double time) {
   return instance()._setSimulationStartTime(time);
 }
 
+bool Modules::requiresGlobalSynchronization(double time, double timeTolerance) {
+  return instance()._requiresGlobalSynchronization(time, timeTolerance);
+}
+
 // Create all template instances for call
 #define MODULES_CALL_INSTANCE(enum, func)                                                          \
   template <>                                                                                      \
@@ -140,6 +140,8 @@ class Modules {
    */
   void _setSimulationStartTime(double time);
 
+  bool _requiresGlobalSynchronization(double time, double timeTolerance) const;
+
   private:
   template <ModuleHook hook>
   static void call(Module* module);
@@ -177,6 +179,12 @@ class Modules {
    * Set the simulation start time
    */
   static void setSimulationStartTime(double time);
+
+  /**
+   * @return True if a module with a synchronization point at the given time requires all
+   *  ranks to be synchronized
+   */
+  static bool requiresGlobalSynchronization(double time, double timeTolerance);
 };
 
 template <>
@@ -42,6 +42,7 @@
 #ifndef FLOPCOUNTER_HPP
 #define FLOPCOUNTER_HPP
 
+#include <atomic>
 #include <fstream>
 
 // Floating point operations performed in the matrix kernels.
@@ -71,16 +72,17 @@ struct FlopCounter {
   long long previousTotalFlops = 0;
   double previousWallTime = 0;
   // global variables for summing-up SeisSol internal counters
-  long long nonZeroFlopsLocal = 0;
-  long long hardwareFlopsLocal = 0;
-  long long nonZeroFlopsNeighbor = 0;
-  long long hardwareFlopsNeighbor = 0;
-  long long nonZeroFlopsOther = 0;
-  long long hardwareFlopsOther = 0;
-  long long nonZeroFlopsDynamicRupture = 0;
-  long long hardwareFlopsDynamicRupture = 0;
-  long long nonZeroFlopsPlasticity = 0;
-  long long hardwareFlopsPlasticity = 0;
+  // (atomic, since clusters may be advanced concurrently by the tasked executor)
+  std::atomic<long long> nonZeroFlopsLocal = 0;
+  std::atomic<long long> hardwareFlopsLocal = 0;
+  std::atomic<long long> nonZeroFlopsNeighbor = 0;
+  std::atomic<long long> hardwareFlopsNeighbor = 0;
+  std::atomic<long long> nonZeroFlopsOther = 0;
+  std::atomic<long long> hardwareFlopsOther = 0;
+  std::atomic<long long> nonZeroFlopsDynamicRupture = 0;
+  std::atomic<long long> hardwareFlopsDynamicRupture = 0;
+  std::atomic<long long> nonZeroFlopsPlasticity = 0;
+  std::atomic<long long> hardwareFlopsPlasticity = 0;
 };
 } // namespace seissol::monitoring
 
@@ -44,6 +44,9 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #ifdef USE_NETCDF
 #include <netcdf.h>
 #ifdef USE_MPI
@@ -59,8 +62,24 @@ namespace seissol {
 
 void LoopStatistics::enableSampleOutput(bool enabled) { outputSamples = enabled; }
 
+namespace {
+unsigned currentThread() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+} // namespace
+
 LoopStatistics::Region::Region(const std::string& name, bool includeInSummary)
-    : name(name), includeInSummary(includeInSummary) {}
+    : name(name), includeInSummary(includeInSummary) {
+#ifdef _OPENMP
+  begin.resize(omp_get_max_threads());
+#else
+  begin.resize(1);
+#endif
+}
 
 void LoopStatistics::addRegion(const std::string& name, bool includeInSummary) {
   regions.push_back(Region(name, includeInSummary));
@@ -75,17 +94,19 @@ unsigned LoopStatistics::getRegion(const std::string& name) const {
 }
 
 void LoopStatistics::begin(unsigned region) {
-  clock_gettime(CLOCK_MONOTONIC, &regions[region].begin);
+  clock_gettime(CLOCK_MONOTONIC, &regions[region].begin[currentThread()]);
 }
 
 void LoopStatistics::end(unsigned region, unsigned numIterations, unsigned subRegion) {
   timespec endTime;
   clock_gettime(CLOCK_MONOTONIC, &endTime);
-  addSample(region, numIterations, subRegion, regions[region].begin, endTime);
+  addSample(region, numIterations, subRegion, regions[region].begin[currentThread()], endTime);
 }
 
 void LoopStatistics::addSample(
     unsigned region, unsigned numIterations, unsigned subRegion, timespec begin, timespec end) {
+  // With the tasked executor, several clusters may finish a region concurrently.
+  std::lock_guard lock(sampleMutex);
   if (outputSamples) {
     Sample sample;
     sample.begin = begin;
@@ -103,6 +124,13 @@ void LoopStatistics::addSample(
     vars.y += time;
     vars.y2 += time * time;
     ++vars.n;
+
+    auto& subRegionSums = regions[region].subRegionSums;
+    if (subRegion >= subRegionSums.size()) {
+      subRegionSums.resize(subRegion + 1);
+    }
+    subRegionSums[subRegion].iterations += numIterations;
+    subRegionSums[subRegion].time += time;
   }
 }
 
@@ -110,6 +138,7 @@ void LoopStatistics::reset() {
   for (auto& region : regions) {
     region.times.resize(0);
     region.variables = StatisticVariables();
+    region.subRegionSums.clear();
     // (region.begin is not reset)
   }
 }
@@ -236,6 +265,30 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
   }
 }
 
+std::vector<LoopStatistics::IterationSums> LoopStatistics::sumsPerSubRegion(
+    unsigned region, unsigned numberOfSubRegions, MPI_Comm comm) const {
+  // [2 * subRegion]: iterations, [2 * subRegion + 1]: time
+  std::vector<double> sums(2 * numberOfSubRegions, 0.0);
+  const auto& subRegionSums = regions[region].subRegionSums;
+  for (unsigned subRegion = 0; subRegion < std::min<std::size_t>(numberOfSubRegions,
+                                                                 subRegionSums.size());
+       ++subRegion) {
+    sums[2 * subRegion + 0] = subRegionSums[subRegion].iterations;
+    sums[2 * subRegion + 1] = subRegionSums[subRegion].time;
+  }
+
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, comm);
+#endif
+
+  std::vector<IterationSums> result(numberOfSubRegions);
+  for (unsigned subRegion = 0; subRegion < numberOfSubRegions; ++subRegion) {
+    result[subRegion].iterations = sums[2 * subRegion + 0];
+    result[subRegion].time = sums[2 * subRegion + 1];
+  }
+  return result;
+}
+
 #ifdef USE_NETCDF
 static void check_err(const int stat, const int line, const char* file) {
   if (stat != NC_NOERR) {
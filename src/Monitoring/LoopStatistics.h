@@ -46,6 +46,7 @@
 #include <cassert>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <time.h>
 #include <unordered_map>
 #include <vector>
@@ -53,6 +54,12 @@
 namespace seissol {
 class LoopStatistics {
   public:
+  //! Accumulated loop iterations and time (in seconds) of a region
+  struct IterationSums {
+    double iterations = 0;
+    double time = 0;
+  };
+
   void enableSampleOutput(bool enabled);
 
   void addRegion(const std::string& name, bool includeInSummary = true);
@@ -70,6 +77,13 @@ class LoopStatistics {
 
   void printSummary(MPI_Comm comm);
 
+  /**
+   * Sums the iterations and times of a region per sub-region over all ranks.
+   * Has to be called on all ranks of comm.
+   */
+  std::vector<IterationSums>
+      sumsPerSubRegion(unsigned region, unsigned numberOfSubRegions, MPI_Comm comm) const;
+
   void writeSamples(const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn);
 
   private:
@@ -93,14 +107,17 @@ class LoopStatistics {
     std::string name;
     std::vector<Sample> times;
     bool includeInSummary;
-    timespec begin;
+    // one begin time per OpenMP thread, as several clusters may be active at the same time
+    std::vector<timespec> begin;
     StatisticVariables variables;
+    std::vector<IterationSums> subRegionSums;
 
     Region(const std::string& name, bool includeInSummary);
   };
 
   std::vector<Region> regions;
   bool outputSamples = false;
+  std::mutex sampleMutex;
 };
 } // namespace seissol
 
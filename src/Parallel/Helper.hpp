@@ -2,6 +2,8 @@
 #define SEISSOL_PARALLEL_HELPER_HPP_
 
 #include "utils/env.h"
+#include "Kernels/precision.hpp"
+#include "Solver/time_stepping/HaloCodec.h"
 
 namespace seissol {
 template <typename T>
@@ -23,6 +25,10 @@ bool useCommThread(const T& mpiBasic) {
   return useThread && !mpiBasic.isSingleProcess();
 }
 
+inline unsigned commThreadSpinCount() {
+  return utils::Env::get<unsigned>("SEISSOL_COMMTHREAD_SPIN", 1000);
+}
+
 inline bool usePersistentMpi() { return utils::Env::get<bool>("SEISSOL_MPI_PERSISTENT", false); }
 
 template <typename T>
@@ -34,6 +40,52 @@ void printPersistentMpiInfo(const T& mpiBasic) {
   }
 }
 
+inline bool useFaceRestrictedMpi() {
+  return utils::Env::get<bool>("SEISSOL_MPI_FACE_EXCHANGE", false);
+}
+
+template <typename T>
+void printFaceRestrictedMpiInfo(const T& mpiBasic) {
+  if (useFaceRestrictedMpi()) {
+    logInfo(mpiBasic.rank()) << "Sending only the face data of the copy layers.";
+  } else {
+    logInfo(mpiBasic.rank()) << "Sending the full volume data of the copy layers.";
+  }
+}
+
+inline time_stepping::HaloCodecType haloCodecType() {
+  return time_stepping::haloCodecTypeFromString(
+      utils::Env::get<const char*>("SEISSOL_MPI_HALO_CODEC", "none"));
+}
+
+template <typename T>
+void printHaloCodecInfo(const T& mpiBasic) {
+  const auto type = haloCodecType();
+  if (type == time_stepping::HaloCodecType::Float && sizeof(real) == sizeof(float)) {
+    logInfo(mpiBasic.rank()) << "The float halo codec has no effect in single precision; "
+                                "sending the copy layers without a codec.";
+  } else if (type == time_stepping::HaloCodecType::None) {
+    logInfo(mpiBasic.rank()) << "Sending the copy layers without a codec.";
+  } else {
+    logInfo(mpiBasic.rank()) << "Encoding the copy layers with the"
+                             << time_stepping::haloCodecTypeToString(type).c_str()
+                             << "halo codec.";
+  }
+}
+
+inline bool useTaskedExecution() {
+  return utils::Env::get<bool>("SEISSOL_TASKED_EXECUTION", false);
+}
+
+template <typename T>
+void printTaskedExecutionInfo(const T& mpiBasic) {
+  if (useTaskedExecution()) {
+    logInfo(mpiBasic.rank()) << "Using tasks for advancing the time clusters concurrently.";
+  } else {
+    logInfo(mpiBasic.rank()) << "Using fork-join loops for advancing one time cluster at a time.";
+  }
+}
+
 } // namespace seissol
 
 #endif // SEISSOL_PARALLEL_HELPER_HPP_
@@ -0,0 +1,99 @@
+#include "Numa.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "TaskLoop.hpp"
+
+namespace seissol::parallel {
+
+int currentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
+std::vector<std::size_t> loopThreadsPerNumaNode() {
+  std::vector<std::size_t> threadsPerNode;
+  bool known = true;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(numberOfLoopThreads())
+#endif
+  {
+    const int node = currentNumaNode();
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+    {
+      if (node < 0) {
+        known = false;
+      } else {
+        threadsPerNode.resize(std::max(threadsPerNode.size(), static_cast<std::size_t>(node) + 1));
+        ++threadsPerNode[node];
+      }
+    }
+  }
+  if (!known) {
+    threadsPerNode.clear();
+  }
+  return threadsPerNode;
+}
+
+bool addBytesPerNumaNode(const void* begin,
+                         std::size_t size,
+                         std::vector<std::size_t>& bytesPerNode,
+                         std::size_t maxSamples) {
+#if defined(__linux__) && defined(SYS_move_pages)
+  if (size == 0 || maxSamples == 0) {
+    return true;
+  }
+  const auto pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto address = reinterpret_cast<std::uintptr_t>(begin);
+  const auto firstPage = address / pageSize * pageSize;
+  const auto lastPage = (address + size - 1) / pageSize * pageSize;
+  const std::size_t numberOfPages = (lastPage - firstPage) / pageSize + 1;
+  const std::size_t numberOfSamples = std::min(numberOfPages, maxSamples);
+
+  std::vector<void*> pages(numberOfSamples);
+  for (std::size_t sample = 0; sample < numberOfSamples; ++sample) {
+    const std::size_t page = sample * numberOfPages / numberOfSamples;
+    pages[sample] = reinterpret_cast<void*>(firstPage + page * pageSize);
+  }
+  // Without target nodes, move_pages only returns the node of each page (or a negative error code)
+  std::vector<int> status(numberOfSamples);
+  if (syscall(SYS_move_pages, 0, numberOfSamples, pages.data(), nullptr, status.data(), 0) != 0) {
+    return false;
+  }
+
+  std::vector<std::size_t> samplesPerNode;
+  for (const auto node : status) {
+    if (node >= 0) {
+      samplesPerNode.resize(std::max(samplesPerNode.size(), static_cast<std::size_t>(node) + 1));
+      ++samplesPerNode[node];
+    }
+  }
+  bytesPerNode.resize(std::max(bytesPerNode.size(), samplesPerNode.size()));
+  for (std::size_t node = 0; node < samplesPerNode.size(); ++node) {
+    bytesPerNode[node] += size / numberOfSamples * samplesPerNode[node];
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // namespace seissol::parallel
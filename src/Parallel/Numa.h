@@ -0,0 +1,32 @@
+#ifndef SEISSOL_PARALLEL_NUMA_H_
+#define SEISSOL_PARALLEL_NUMA_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace seissol::parallel {
+
+/**
+ * Returns the NUMA node of the CPU the calling thread runs on, or -1 if it is unknown.
+ */
+int currentNumaNode();
+
+/**
+ * Returns the number of threads which execute the iterations of a loop (see forEach) on each
+ * NUMA node. The result is empty if the NUMA nodes of the threads are unknown.
+ */
+std::vector<std::size_t> loopThreadsPerNumaNode();
+
+/**
+ * Estimates the number of bytes of [begin, begin + size) which reside on each NUMA node and adds
+ * them to bytesPerNode. At most maxSamples pages of the range are queried; pages which have not
+ * been touched yet are not counted. Returns false if the placement cannot be queried.
+ */
+bool addBytesPerNumaNode(const void* begin,
+                         std::size_t size,
+                         std::vector<std::size_t>& bytesPerNode,
+                         std::size_t maxSamples = 256);
+
+} // namespace seissol::parallel
+
+#endif // SEISSOL_PARALLEL_NUMA_H_
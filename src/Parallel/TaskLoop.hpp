@@ -0,0 +1,96 @@
+#ifndef SEISSOL_PARALLEL_TASKLOOP_HPP_
+#define SEISSOL_PARALLEL_TASKLOOP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace seissol::parallel {
+
+/**
+ * Number of threads which may execute the iterations of a loop.
+ */
+inline std::size_t numberOfLoopThreads() {
+#ifdef _OPENMP
+  return static_cast<std::size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Number of tasks a loop with count iterations is split into, if it is executed as taskloop.
+ * We use two tasks per thread to give the work-stealing runtime some room for load balancing.
+ */
+inline std::size_t numberOfLoopTasks(std::size_t count) {
+#ifdef _OPENMP
+  const auto maxTasks = 2 * static_cast<std::size_t>(omp_get_num_threads());
+#else
+  const std::size_t maxTasks = 1;
+#endif
+  return std::max(std::size_t(1), std::min(count, maxTasks));
+}
+
+/**
+ * Executes body(i) for all i in [0, count).
+ *
+ * Outside of a parallel region, this is the usual fork-join worksharing loop with a static
+ * schedule. If called from within a parallel region (i.e. from a task of the tasked time cluster
+ * executor), the loop is split into tasks instead, such that idle threads of the team can pick up
+ * the iterations while other actors are running concurrently.
+ * Note that the thread id of an iteration is well-defined in both cases, i.e. per-thread scratch
+ * memory may be used inside body as long as it is not kept across iterations.
+ */
+template <typename F>
+void forEach(std::size_t count, F&& body) {
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+#pragma omp taskloop num_tasks(numberOfLoopTasks(count))
+    for (std::size_t i = 0; i < count; ++i) {
+      body(i);
+    }
+  } else {
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < count; ++i) {
+      body(i);
+    }
+  }
+#else
+  for (std::size_t i = 0; i < count; ++i) {
+    body(i);
+  }
+#endif
+}
+
+/**
+ * Same as forEach, but sums up the return values of body.
+ */
+template <typename F>
+unsigned long forEachSum(std::size_t count, F&& body) {
+  unsigned long sum = 0;
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+#pragma omp taskloop num_tasks(numberOfLoopTasks(count)) reduction(+ : sum)
+    for (std::size_t i = 0; i < count; ++i) {
+      sum += body(i);
+    }
+  } else {
+#pragma omp parallel for schedule(static) reduction(+ : sum)
+    for (std::size_t i = 0; i < count; ++i) {
+      sum += body(i);
+    }
+  }
+#else
+  for (std::size_t i = 0; i < count; ++i) {
+    sum += body(i);
+  }
+#endif
+  return sum;
+}
+
+} // namespace seissol::parallel
+
+#endif // SEISSOL_PARALLEL_TASKLOOP_HPP_
@@ -20,6 +20,12 @@ class InitialField {
                         const std::vector<std::array<double, 3>>& points,
                         const CellMaterialData& materialData,
                         yateto::DenseTensorView<2, real, unsigned>& dofsQP) const = 0;
+
+  /**
+   * Returns the degree of the field as a polynomial in time, or -1 if it is no polynomial in time.
+   * Boundary data of fields with a degree smaller than CONVERGENCE_ORDER is expanded exactly.
+   */
+  virtual int polynomialDegreeInTime() const { return -1; }
 };
 
 class ZeroField : public InitialField {
@@ -30,6 +36,8 @@ class ZeroField : public InitialField {
                 yateto::DenseTensorView<2, real, unsigned>& dofsQP) const override {
     dofsQP.setZero();
   }
+
+  int polynomialDegreeInTime() const override { return 0; }
 };
 
 class PressureInjection : public InitialField {
@@ -42,6 +50,8 @@ class PressureInjection : public InitialField {
                 const CellMaterialData& materialData,
                 yateto::DenseTensorView<2, real, unsigned>& dofsQP) const override;
 
+  int polynomialDegreeInTime() const override { return 0; }
+
   private:
   seissol::initializer::parameters::InitializationParameters m_parameters;
 };
@@ -7,6 +7,7 @@
 #include "Parallel/MPI.h"
 #include "SeisSol.h"
 #include <array>
+#include <limits>
 
 namespace seissol::writer {
 
@@ -305,7 +306,51 @@ void EnergyOutput::computeDynamicRuptureEnergies() {
 #endif
 }
 
+void EnergyOutput::setupVolumeEnergies() {
+  const std::vector<Element>& elements = meshReader->getElements();
+  const std::vector<Vertex>& vertices = meshReader->getVertices();
+  const auto mask = seissol::initializer::LayerMask(Ghost);
+
+  unsigned numberOfCells = 0;
+  for (auto it = ltsTree->beginLeaf(mask); it != ltsTree->endLeaf(); ++it) {
+    numberOfCells += it->getNumberOfCells();
+  }
+
+  // Duplicated cells are only taken into account once
+  cellMeshIds.resize(numberOfCells);
+  cellVolumes.resize(numberOfCells);
+  for (unsigned ltsId = 0; ltsId < numberOfCells; ++ltsId) {
+    const auto meshId = ltsLut->meshId(mask, ltsId);
+    if (meshId < elements.size() && ltsLut->ltsId(mask, meshId) == ltsId) {
+      cellMeshIds[ltsId] = meshId;
+      cellVolumes[ltsId] = MeshTools::volume(elements[meshId], vertices);
+    } else {
+      cellMeshIds[ltsId] = std::numeric_limits<unsigned>::max();
+      cellVolumes[ltsId] = 0.0;
+    }
+  }
+
+  constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
+  constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
+  double quadraturePointsTet[numQuadraturePointsTet][3];
+  quadratureWeightsTet.resize(numQuadraturePointsTet);
+  seissol::quadrature::TetrahedronQuadrature(
+      quadraturePointsTet, quadratureWeightsTet.data(), quadPolyDegree);
+
+  constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
+  double quadraturePointsTri[numQuadraturePointsTri][2];
+  quadratureWeightsTri.resize(numQuadraturePointsTri);
+  seissol::quadrature::TriangleQuadrature(
+      quadraturePointsTri, quadratureWeightsTri.data(), quadPolyDegree);
+
+  isVolumeEnergySetUp = true;
+}
+
 void EnergyOutput::computeVolumeEnergies() {
+  if (!isVolumeEnergySetUp) {
+    setupVolumeEnergies();
+  }
+
   auto& totalGravitationalEnergyLocal = energiesStorage.gravitationalEnergy();
   auto& totalAcousticEnergyLocal = energiesStorage.acousticEnergy();
   auto& totalAcousticKineticEnergyLocal = energiesStorage.acousticKineticEnergy();
@@ -321,174 +366,190 @@ void EnergyOutput::computeVolumeEnergies() {
 
   const auto g = seissolInstance.getGravitationSetup().acceleration;
 
+  // We iterate over the cells in storage order; all leaves are processed in a single parallel
+  // region, such that the reduction only happens once at its end.
   // Note: Default(none) is not possible, clang requires data sharing attribute for g, gcc forbids
   // it
 #if defined(_OPENMP) && !NVHPC_AVOID_OMP
-#pragma omp parallel for schedule(static) reduction(+ : totalGravitationalEnergyLocal,             \
-                                                        totalAcousticEnergyLocal,                  \
-                                                        totalAcousticKineticEnergyLocal,           \
-                                                        totalElasticEnergyLocal,                   \
-                                                        totalElasticKineticEnergyLocal,            \
-                                                        totalMomentumX,                            \
-                                                        totalMomentumY,                            \
-                                                        totalMomentumZ,                            \
-                                                        totalPlasticMoment)                        \
-    shared(elements, vertices, lts, ltsLut, global)
+#pragma omp parallel reduction(+ : totalGravitationalEnergyLocal,                                  \
+                                   totalAcousticEnergyLocal,                                       \
+                                   totalAcousticKineticEnergyLocal,                                \
+                                   totalElasticEnergyLocal,                                        \
+                                   totalElasticKineticEnergyLocal,                                 \
+                                   totalMomentumX,                                                 \
+                                   totalMomentumY,                                                 \
+                                   totalMomentumZ,                                                 \
+                                   totalPlasticMoment)                                             \
+    shared(elements, vertices, lts, global)
 #endif
-  for (std::size_t elementId = 0; elementId < elements.size(); ++elementId) {
-    real volume = MeshTools::volume(elements[elementId], vertices);
-    CellMaterialData& material = ltsLut->lookup(lts->material, elementId);
+  {
+    unsigned offset = 0;
+    for (auto it = ltsTree->beginLeaf(seissol::initializer::LayerMask(Ghost));
+         it != ltsTree->endLeaf();
+         ++it) {
+      const auto* materials = it->var(lts->material);
 #if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
-    auto& cellInformation = ltsLut->lookup(lts->cellInformation, elementId);
-    auto& faceDisplacements = ltsLut->lookup(lts->faceDisplacements, elementId);
-
-    constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
-    constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
-
-    double quadraturePointsTet[numQuadraturePointsTet][3];
-    double quadratureWeightsTet[numQuadraturePointsTet];
-    seissol::quadrature::TetrahedronQuadrature(
-        quadraturePointsTet, quadratureWeightsTet, quadPolyDegree);
-
-    constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
-    double quadraturePointsTri[numQuadraturePointsTri][2];
-    double quadratureWeightsTri[numQuadraturePointsTri];
-    seissol::quadrature::TriangleQuadrature(
-        quadraturePointsTri, quadratureWeightsTri, quadPolyDegree);
-
-    // Needed to weight the integral.
-    const auto jacobiDet = 6 * volume;
-
-    alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
-    auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
-    // Evaluate numerical solution at quad. nodes
-    kernel::evalAtQP krnl;
-    krnl.evalAtQP = global->evalAtQPMatrix;
-    krnl.dofsQP = numericalSolutionData;
-    krnl.Q = ltsLut->lookup(lts->dofs, elementId);
-    krnl.execute();
+      const auto* dofs = it->var(lts->dofs);
+      const auto* cellInformations = it->var(lts->cellInformation);
+      const auto* faceDisplacementsLayer = it->var(lts->faceDisplacements);
+      const auto* boundaryMappingsLayer = it->var(lts->boundaryMapping);
+#endif
+      const auto* pstrain = isPlasticityEnabled ? it->var(lts->pstrain) : nullptr;
 
+#if defined(_OPENMP) && !NVHPC_AVOID_OMP
+#pragma omp for schedule(static) nowait
+#endif
+      for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
+        const auto ltsId = offset + cell;
+        const real volume = cellVolumes[ltsId];
+        if (cellMeshIds[ltsId] == std::numeric_limits<unsigned>::max()) {
+          continue;
+        }
+        const CellMaterialData& material = materials[cell];
+#if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
+        const auto& cellInformation = cellInformations[cell];
+        const auto& faceDisplacements = faceDisplacementsLayer[cell];
+
+        constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
+        constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
+        constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
+
+        // Needed to weight the integral.
+        const auto jacobiDet = 6 * volume;
+
+        alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
+        auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
+        // Evaluate numerical solution at quad. nodes
+        kernel::evalAtQP krnl;
+        krnl.evalAtQP = global->evalAtQPMatrix;
+        krnl.dofsQP = numericalSolutionData;
+        krnl.Q = dofs[cell];
+        krnl.execute();
 #ifdef MULTIPLE_SIMULATIONS
-    auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
+        auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
 #else
-    auto numSub = numericalSolution;
+        auto numSub = numericalSolution;
 #endif
-    for (size_t qp = 0; qp < numQuadraturePointsTet; ++qp) {
-      constexpr int uIdx = 6;
-      const auto curWeight = jacobiDet * quadratureWeightsTet[qp];
-      const auto rho = material.local.rho;
-
-      const auto u = numSub(qp, uIdx + 0);
-      const auto v = numSub(qp, uIdx + 1);
-      const auto w = numSub(qp, uIdx + 2);
-      const double curKineticEnergy = 0.5 * rho * (u * u + v * v + w * w);
-      const double curMomentumX = rho * u;
-      const double curMomentumY = rho * v;
-      const double curMomentumZ = rho * w;
-
-      if (std::abs(material.local.mu) < 10e-14) {
-        // Acoustic
-        constexpr int pIdx = 0;
-        const auto K = material.local.lambda;
-        const auto p = numSub(qp, pIdx);
-        const double curAcousticEnergy = (p * p) / (2 * K);
-        totalAcousticEnergyLocal += curWeight * curAcousticEnergy;
-        totalAcousticKineticEnergyLocal += curWeight * curKineticEnergy;
-      } else {
-        // Elastic
-        totalElasticKineticEnergyLocal += curWeight * curKineticEnergy;
-        auto getStressIndex = [](int i, int j) {
-          const static auto lookup =
-              std::array<std::array<int, 3>, 3>{{{0, 3, 5}, {3, 1, 4}, {5, 4, 2}}};
-          return lookup[i][j];
-        };
-        totalMomentumX += curWeight * curMomentumX;
-        totalMomentumY += curWeight * curMomentumY;
-        totalMomentumZ += curWeight * curMomentumZ;
-
-        auto getStress = [&](int i, int j) { return numSub(qp, getStressIndex(i, j)); };
-
-        const auto lambda = material.local.lambda;
-        const auto mu = material.local.mu;
-        const auto sumUniaxialStresses = getStress(0, 0) + getStress(1, 1) + getStress(2, 2);
-        auto computeStrain = [&](int i, int j) {
-          double strain = 0.0;
-          const auto factor = -1.0 * (lambda) / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
-          if (i == j) {
-            strain += factor * sumUniaxialStresses;
-          }
-          strain += 1.0 / (2.0 * mu) * getStress(i, j);
-          return strain;
-        };
-        double curElasticEnergy = 0.0;
-        for (int i = 0; i < 3; ++i) {
-          for (int j = 0; j < 3; ++j) {
-            curElasticEnergy += getStress(i, j) * computeStrain(i, j);
+        for (size_t qp = 0; qp < numQuadraturePointsTet; ++qp) {
+          constexpr int uIdx = 6;
+          const auto curWeight = jacobiDet * quadratureWeightsTet[qp];
+          const auto rho = material.local.rho;
+
+          const auto u = numSub(qp, uIdx + 0);
+          const auto v = numSub(qp, uIdx + 1);
+          const auto w = numSub(qp, uIdx + 2);
+          const double curKineticEnergy = 0.5 * rho * (u * u + v * v + w * w);
+          const double curMomentumX = rho * u;
+          const double curMomentumY = rho * v;
+          const double curMomentumZ = rho * w;
+
+          if (std::abs(material.local.mu) < 10e-14) {
+            // Acoustic
+            constexpr int pIdx = 0;
+            const auto K = material.local.lambda;
+            const auto p = numSub(qp, pIdx);
+            const double curAcousticEnergy = (p * p) / (2 * K);
+            totalAcousticEnergyLocal += curWeight * curAcousticEnergy;
+            totalAcousticKineticEnergyLocal += curWeight * curKineticEnergy;
+          } else {
+            // Elastic
+            totalElasticKineticEnergyLocal += curWeight * curKineticEnergy;
+            auto getStressIndex = [](int i, int j) {
+              const static auto lookup =
+                  std::array<std::array<int, 3>, 3>{{{0, 3, 5}, {3, 1, 4}, {5, 4, 2}}};
+              return lookup[i][j];
+            };
+            totalMomentumX += curWeight * curMomentumX;
+            totalMomentumY += curWeight * curMomentumY;
+            totalMomentumZ += curWeight * curMomentumZ;
+
+            auto getStress = [&](int i, int j) { return numSub(qp, getStressIndex(i, j)); };
+
+            const auto lambda = material.local.lambda;
+            const auto mu = material.local.mu;
+            const auto sumUniaxialStresses = getStress(0, 0) + getStress(1, 1) + getStress(2, 2);
+            auto computeStrain = [&](int i, int j) {
+              double strain = 0.0;
+              const auto factor = -1.0 * (lambda) / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
+              if (i == j) {
+                strain += factor * sumUniaxialStresses;
+              }
+              strain += 1.0 / (2.0 * mu) * getStress(i, j);
+              return strain;
+            };
+            double curElasticEnergy = 0.0;
+            for (int i = 0; i < 3; ++i) {
+              for (int j = 0; j < 3; ++j) {
+                curElasticEnergy += getStress(i, j) * computeStrain(i, j);
+              }
+            }
+            totalElasticEnergyLocal += curWeight * 0.5 * curElasticEnergy;
           }
         }
-        totalElasticEnergyLocal += curWeight * 0.5 * curElasticEnergy;
-      }
-    }
 
-    auto* boundaryMappings = ltsLut->lookup(lts->boundaryMapping, elementId);
-    // Compute gravitational energy
-    for (int face = 0; face < 4; ++face) {
-      if (cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity)
-        continue;
-
-      // Displacements are stored in face-aligned coordinate system.
-      // We need to rotate it to the global coordinate system.
-      auto& boundaryMapping = boundaryMappings[face];
-      auto Tinv = init::Tinv::view::create(boundaryMapping.TinvData);
-      alignas(ALIGNMENT)
-          real rotateDisplacementToFaceNormalData[init::displacementRotationMatrix::Size];
-
-      auto rotateDisplacementToFaceNormal =
-          init::displacementRotationMatrix::view::create(rotateDisplacementToFaceNormalData);
-      for (int i = 0; i < 3; ++i) {
-        for (int j = 0; j < 3; ++j) {
-          rotateDisplacementToFaceNormal(i, j) = Tinv(i + 6, j + 6);
-        }
-      }
+        const auto* boundaryMappings = boundaryMappingsLayer[cell];
+        // Compute gravitational energy
+        for (int face = 0; face < 4; ++face) {
+          if (cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity)
+            continue;
+
+          // Displacements are stored in face-aligned coordinate system.
+          // We need to rotate it to the global coordinate system.
+          auto& boundaryMapping = boundaryMappings[face];
+          auto Tinv = init::Tinv::view::create(boundaryMapping.TinvData);
+          alignas(ALIGNMENT)
+              real rotateDisplacementToFaceNormalData[init::displacementRotationMatrix::Size];
+
+          auto rotateDisplacementToFaceNormal =
+              init::displacementRotationMatrix::view::create(rotateDisplacementToFaceNormalData);
+          for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+              rotateDisplacementToFaceNormal(i, j) = Tinv(i + 6, j + 6);
+            }
+          }
 
-      alignas(ALIGNMENT) std::array<real, tensor::rotatedFaceDisplacementAtQuadratureNodes::Size>
-          displQuadData{};
-      const auto* curFaceDisplacementsData = faceDisplacements[face];
-      seissol::kernel::rotateFaceDisplacementsAndEvaluateAtQuadratureNodes evalKrnl;
-      evalKrnl.rotatedFaceDisplacement = curFaceDisplacementsData;
-      evalKrnl.V2nTo2JacobiQuad = init::V2nTo2JacobiQuad::Values;
-      evalKrnl.rotatedFaceDisplacementAtQuadratureNodes = displQuadData.data();
-      evalKrnl.displacementRotationMatrix = rotateDisplacementToFaceNormalData;
-      evalKrnl.execute();
-
-      // Perform quadrature
-      const auto surface = MeshTools::surface(elements[elementId], face, vertices);
-      const auto rho = material.local.rho;
-
-      static_assert(numQuadraturePointsTri ==
-                    init::rotatedFaceDisplacementAtQuadratureNodes::Shape[0]);
-      auto rotatedFaceDisplacement =
-          init::rotatedFaceDisplacementAtQuadratureNodes::view::create(displQuadData.data());
-      for (unsigned i = 0; i < rotatedFaceDisplacement.shape(0); ++i) {
-        // See for example (Saito, Tsunami generation and propagation, 2019) section 3.2.3 for
-        // derivation.
-        const auto displ = rotatedFaceDisplacement(i, 0);
-        const auto curEnergy = 0.5 * rho * g * displ * displ;
-        const auto curWeight = 2.0 * surface * quadratureWeightsTri[i];
-        totalGravitationalEnergyLocal += curWeight * curEnergy;
-      }
-    }
+          alignas(ALIGNMENT)
+              std::array<real, tensor::rotatedFaceDisplacementAtQuadratureNodes::Size>
+                  displQuadData{};
+          const auto* curFaceDisplacementsData = faceDisplacements[face];
+          seissol::kernel::rotateFaceDisplacementsAndEvaluateAtQuadratureNodes evalKrnl;
+          evalKrnl.rotatedFaceDisplacement = curFaceDisplacementsData;
+          evalKrnl.V2nTo2JacobiQuad = init::V2nTo2JacobiQuad::Values;
+          evalKrnl.rotatedFaceDisplacementAtQuadratureNodes = displQuadData.data();
+          evalKrnl.displacementRotationMatrix = rotateDisplacementToFaceNormalData;
+          evalKrnl.execute();
+
+          // Perform quadrature
+          const auto surface = MeshTools::surface(elements[cellMeshIds[ltsId]], face, vertices);
+          const auto rho = material.local.rho;
+
+          static_assert(numQuadraturePointsTri ==
+                        init::rotatedFaceDisplacementAtQuadratureNodes::Shape[0]);
+          auto rotatedFaceDisplacement =
+              init::rotatedFaceDisplacementAtQuadratureNodes::view::create(displQuadData.data());
+          for (unsigned i = 0; i < rotatedFaceDisplacement.shape(0); ++i) {
+            // See for example (Saito, Tsunami generation and propagation, 2019) section 3.2.3 for
+            // derivation.
+            const auto displ = rotatedFaceDisplacement(i, 0);
+            const auto curEnergy = 0.5 * rho * g * displ * displ;
+            const auto curWeight = 2.0 * surface * quadratureWeightsTri[i];
+            totalGravitationalEnergyLocal += curWeight * curEnergy;
+          }
+        }
 #endif
 
-    if (isPlasticityEnabled) {
-      // plastic moment
-      real* pstrainCell = ltsLut->lookup(lts->pstrain, elementId);
+        if (isPlasticityEnabled) {
+          // plastic moment
+          const real* pstrainCell = pstrain[cell];
 #ifdef USE_ANISOTROPIC
-      real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
+          real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
 #else
-      real mu = material.local.mu;
+          real mu = material.local.mu;
 #endif
-      totalPlasticMoment += mu * volume * pstrainCell[tensor::QStress::size()];
+          totalPlasticMoment += mu * volume * pstrainCell[tensor::QStress::size()];
+        }
+      }
+      offset += it->getNumberOfCells();
     }
   }
 }
@@ -5,6 +5,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "Geometry/MeshReader.h"
 #include "Initializer/DynamicRupture.h"
@@ -64,6 +65,10 @@ class EnergyOutput : public Module {
 
   void syncPoint(double time) override;
 
+  bool requiresGlobalSynchronization() const override {
+    return isCheckAbortCriteraSlipRateEnabled || isCheckAbortCriteraMomentRateEnabled;
+  }
+
   void simulationStart() override;
 
   EnergyOutput(seissol::SeisSol& seissolInstance) : seissolInstance(seissolInstance) {}
@@ -77,6 +82,8 @@ class EnergyOutput : public Module {
 
   void computeDynamicRuptureEnergies();
 
+  void setupVolumeEnergies();
+
   void computeVolumeEnergies();
 
   void computeEnergies();
@@ -117,6 +124,14 @@ class EnergyOutput : public Module {
   seissol::initializer::LTS* lts = nullptr;
   seissol::initializer::Lut* ltsLut = nullptr;
 
+  // Cell data for the volume energies, in the storage order of the (non-ghost) LTS tree.
+  // Duplicated cells have an invalid mesh id.
+  bool isVolumeEnergySetUp = false;
+  std::vector<unsigned> cellMeshIds;
+  std::vector<double> cellVolumes;
+  std::vector<double> quadratureWeightsTet;
+  std::vector<double> quadratureWeightsTri;
+
   EnergiesStorage energiesStorage{};
   real minTimeSinceSlipRateBelowThreshold;
   real minTimeSinceMomentRateBelowThreshold = 0.0;
@@ -0,0 +1,123 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "PickpointWriter.h"
+
+#include <cassert>
+#include <cstdint>
+
+#include <utils/logger.h>
+
+#include "DynamicRupture/Output/OutputManager.hpp"
+#include "Kernels/precision.hpp"
+#include "Modules/Modules.h"
+#include "Parallel/MPI.h"
+#include "Parallel/Pin.h"
+#include "SeisSol.h"
+
+void seissol::writer::PickpointWriter::setUp() {
+  setExecutor(m_executor);
+
+  if (isAffinityNecessary()) {
+    const auto freeCpus = seissolInstance.getPinning().getFreeCPUsMask();
+    logInfo(seissol::MPI::mpi.rank())
+        << "Pick point writer thread affinity:" << parallel::Pinning::maskToString(freeCpus);
+    if (parallel::Pinning::freeCPUsMaskEmpty(freeCpus)) {
+      logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+    }
+    setAffinityIfNecessary(freeCpus);
+  }
+}
+
+void seissol::writer::PickpointWriter::init(const std::string& fileName,
+                                            const std::vector<std::string>& columnNames,
+                                            const std::vector<ReceiverPointRecord>& points,
+                                            double interval,
+                                            std::size_t samplesPerInterval,
+                                            dr::output::OutputManager* faultOutputManager) {
+  logInfo(seissol::MPI::mpi.rank()) << "Initializing binary on-fault receiver output.";
+
+  // Initialize the asynchronous module
+  async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>::init();
+
+  m_faultOutputManager = faultOutputManager;
+  m_numberOfReceivers = points.size();
+  m_maxSamples = m_numberOfReceivers * columnNames.size() * samplesPerInterval;
+
+  std::string names;
+  for (const auto& name : columnNames) {
+    names += (names.empty() ? "" : ",") + name;
+  }
+
+  unsigned int bufferId = addSyncBuffer(fileName.c_str(), fileName.size() + 1, true);
+  assert(bufferId == ReceiverWriterExecutor::FILE_NAME);
+  NDBG_UNUSED(bufferId);
+  bufferId = addSyncBuffer(names.c_str(), names.size() + 1, true);
+  assert(bufferId == ReceiverWriterExecutor::NAMES);
+  bufferId = addSyncBuffer(points.data(), points.size() * sizeof(ReceiverPointRecord));
+  assert(bufferId == ReceiverWriterExecutor::POINTS);
+  bufferId = addBuffer(0L, m_numberOfReceivers * sizeof(std::uint64_t));
+  assert(bufferId == ReceiverWriterExecutor::SAMPLE_COUNTS);
+  bufferId = addBuffer(0L, m_maxSamples * sizeof(real));
+  assert(bufferId == ReceiverWriterExecutor::SAMPLES);
+
+  sendBuffer(ReceiverWriterExecutor::FILE_NAME);
+  sendBuffer(ReceiverWriterExecutor::NAMES);
+  sendBuffer(ReceiverWriterExecutor::POINTS);
+
+  ReceiverInitParam param;
+  param.ncols = columnNames.size();
+  callInit(param);
+
+  removeBuffer(ReceiverWriterExecutor::FILE_NAME);
+  removeBuffer(ReceiverWriterExecutor::NAMES);
+  removeBuffer(ReceiverWriterExecutor::POINTS);
+
+  m_enabled = true;
+
+  setSyncInterval(interval);
+  Modules::registerHook(*this, ModuleHook::SynchronizationPoint);
+}
+
+void seissol::writer::PickpointWriter::syncPoint(double currentTime) {
+  // Ranks without receivers take part as well, since the module is collective
+  if (!m_enabled) {
+    return;
+  }
+
+  m_stopwatch.start();
+
+  // The executor may still write the previous samples
+  wait();
+
+  using PickpointModule = async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>;
+  auto* sampleCounts =
+      PickpointModule::managedBuffer<std::uint64_t*>(ReceiverWriterExecutor::SAMPLE_COUNTS);
+  auto* samples = PickpointModule::managedBuffer<real*>(ReceiverWriterExecutor::SAMPLES);
+
+  const std::size_t numberOfValues =
+      m_faultOutputManager->collectPickpointSamples(sampleCounts, samples, m_maxSamples);
+
+  sendBuffer(ReceiverWriterExecutor::SAMPLE_COUNTS, m_numberOfReceivers * sizeof(std::uint64_t));
+  sendBuffer(ReceiverWriterExecutor::SAMPLES, numberOfValues * sizeof(real));
+
+  ReceiverParam param;
+  param.time = currentTime;
+  call(param);
+
+  m_stopwatch.pause();
+}
+
+void seissol::writer::PickpointWriter::close() {
+  if (m_enabled) {
+    wait();
+  }
+
+  finalize();
+
+  if (!m_enabled) {
+    return;
+  }
+
+  m_stopwatch.printTime("Time pick point writer frontend:");
+}
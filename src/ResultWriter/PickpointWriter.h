@@ -0,0 +1,86 @@
+// Copyright (c) 2024 SeisSol Group
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_RESULTWRITER_PICKPOINTWRITER_H_
+#define SEISSOL_RESULTWRITER_PICKPOINTWRITER_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <async/Module.h>
+
+#include "Modules/Module.h"
+#include "Monitoring/Stopwatch.h"
+#include "ReceiverWriterExecutor.h"
+
+namespace seissol {
+class SeisSol;
+namespace dr::output {
+class OutputManager;
+} // namespace dr::output
+} // namespace seissol
+
+namespace seissol::writer {
+
+/**
+ * Binary output of the on-fault receivers (pick points).
+ *
+ * The samples are collected from the fault output manager at the synchronization points of
+ * this module and written asynchronously to a single file, in the same format as the binary
+ * off-fault receiver output.
+ */
+class PickpointWriter : private async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>,
+                        public seissol::Module {
+  public:
+  PickpointWriter(seissol::SeisSol& seissolInstance) : seissolInstance(seissolInstance) {}
+
+  /**
+   * Has to be called on all ranks, also on ranks without pick points.
+   *
+   * @param columnNames Names of the values of one sample, including the time.
+   * @param interval Time between two writes.
+   * @param samplesPerInterval Maximum number of samples of one receiver between two writes.
+   */
+  void init(const std::string& fileName,
+            const std::vector<std::string>& columnNames,
+            const std::vector<ReceiverPointRecord>& points,
+            double interval,
+            std::size_t samplesPerInterval,
+            dr::output::OutputManager* faultOutputManager);
+
+  /**
+   * Called by ASYNC on all ranks
+   */
+  void setUp();
+
+  void tearDown() { m_executor.finalize(); }
+
+  void close();
+
+  //
+  // Hooks
+  //
+  void syncPoint(double currentTime) override;
+
+  private:
+  seissol::SeisSol& seissolInstance;
+
+  bool m_enabled{false};
+
+  //! number of local receivers
+  std::size_t m_numberOfReceivers{0};
+
+  //! capacity of the sample buffer (in reals)
+  std::size_t m_maxSamples{0};
+
+  dr::output::OutputManager* m_faultOutputManager{nullptr};
+
+  ReceiverWriterExecutor m_executor;
+
+  Stopwatch m_stopwatch;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_PICKPOINTWRITER_H_
@@ -40,6 +40,7 @@
 #include "ReceiverWriter.h"
 
 #include <cctype>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
@@ -49,7 +50,9 @@
 #include <sys/stat.h>
 
 #include "Parallel/MPI.h"
+#include "Parallel/Pin.h"
 #include "Modules/Modules.h"
+#include "SeisSol.h"
 #include "Initializer/Parameters/SeisSolParameters.h"
 
 Eigen::Vector3d seissol::writer::parseReceiverLine(const std::string& line) {
@@ -97,10 +100,7 @@ std::string seissol::writer::ReceiverWriter::fileName(unsigned pointId) const {
   return fns.str();
 }
 
-void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
-                                                   Eigen::Vector3d const& point   ) {
-  auto name = fileName(pointId);
-
+std::vector<std::string> seissol::writer::ReceiverWriter::columnNames() const {
   std::vector<std::string> names({"xx", "yy", "zz", "xy", "yz", "xz", "v1", "v2", "v3"});
 #ifdef USE_POROELASTIC
   std::array<std::string, 4> additionalNames({"p", "v1_f", "v2_f", "v3_f"});
@@ -111,6 +111,23 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
     names.insert(names.end(), rotationNames.begin(), rotationNames.end());
   }
 
+#ifdef MULTIPLE_SIMULATIONS
+  std::vector<std::string> simulationNames;
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (auto const& name : names) {
+      simulationNames.push_back(name + std::to_string(sim));
+    }
+  }
+  return simulationNames;
+#else
+  return names;
+#endif
+}
+
+void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
+                                                   Eigen::Vector3d const& point   ) {
+  auto name = fileName(pointId);
+
   /// \todo Find a nicer solution that is not so hard-coded.
   struct stat fileStat;
   // Write header if file does not exist
@@ -119,17 +136,9 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
     file.open(name);
     file << "TITLE = \"Temporal Signal for receiver number " << std::setfill('0') << std::setw(5) << (pointId+1) << "\"" << std::endl;
     file << "VARIABLES = \"Time\"";
-#ifdef MULTIPLE_SIMULATIONS
-    for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-      for (auto const& name : names) {
-        file << ",\"" << name << sim << "\"";
-      }
-    }
-#else
-    for (auto const& name : names) {
+    for (auto const& name : columnNames()) {
       file << ",\"" << name << "\"";
     }
-#endif
     file << std::endl;
     for (int d = 0; d < 3; ++d) {
       file << "# x" << (d+1) << "       " << std::scientific << std::setprecision(12) << point[d] << std::endl;
@@ -138,8 +147,128 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
   }
 }
 
-void seissol::writer::ReceiverWriter::syncPoint(double)
+void seissol::writer::ReceiverWriter::setUp() {
+  setExecutor(m_executor);
+  if (isAffinityNecessary()) {
+    const auto freeCpus = seissolInstance.getPinning().getFreeCPUsMask();
+    logInfo(seissol::MPI::mpi.rank()) << "Receiver writer thread affinity:" <<
+      parallel::Pinning::maskToString(freeCpus);
+    if (parallel::Pinning::freeCPUsMaskEmpty(freeCpus)) {
+      logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+    }
+  }
+}
+
+void seissol::writer::ReceiverWriter::close() {
+  if (m_binaryEnabled) {
+    wait();
+  }
+
+  finalize();
+}
+
+void seissol::writer::ReceiverWriter::initBinaryOutput() {
+  // Initialize the asynchronous module
+  async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>::init();
+
+  std::vector<ReceiverPointRecord> points;
+  std::size_t ncols = 0;
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      ncols = cluster.ncols();
+      for (auto& receiver : cluster) {
+        points.push_back({receiver.pointId,
+                          {receiver.position[0], receiver.position[1], receiver.position[2]}});
+      }
+    }
+  }
+  m_numberOfReceivers = points.size();
+  // One sample more than reserved by the receiver clusters, as the sync points need not be
+  // multiples of the sampling interval
+  m_maxSamples = m_numberOfReceivers * ncols *
+                 static_cast<std::size_t>(syncInterval() / m_samplingInterval + 2);
+
+  std::string names = "Time";
+  for (const auto& name : columnNames()) {
+    names += "," + name;
+  }
+
+  const std::string fileName = m_fileNamePrefix + "-receivers.bin";
+
+  unsigned int bufferId = addSyncBuffer(fileName.c_str(), fileName.size() + 1, true);
+  assert(bufferId == ReceiverWriterExecutor::FILE_NAME); NDBG_UNUSED(bufferId);
+  bufferId = addSyncBuffer(names.c_str(), names.size() + 1, true);
+  assert(bufferId == ReceiverWriterExecutor::NAMES);
+  bufferId = addSyncBuffer(points.data(), points.size() * sizeof(ReceiverPointRecord));
+  assert(bufferId == ReceiverWriterExecutor::POINTS);
+  bufferId = addBuffer(0L, m_numberOfReceivers * sizeof(std::uint64_t));
+  assert(bufferId == ReceiverWriterExecutor::SAMPLE_COUNTS);
+  bufferId = addBuffer(0L, m_maxSamples * sizeof(real));
+  assert(bufferId == ReceiverWriterExecutor::SAMPLES);
+
+  sendBuffer(ReceiverWriterExecutor::FILE_NAME);
+  sendBuffer(ReceiverWriterExecutor::NAMES);
+  sendBuffer(ReceiverWriterExecutor::POINTS);
+
+  ReceiverInitParam param;
+  param.ncols = ncols;
+  callInit(param);
+
+  removeBuffer(ReceiverWriterExecutor::FILE_NAME);
+  removeBuffer(ReceiverWriterExecutor::NAMES);
+  removeBuffer(ReceiverWriterExecutor::POINTS);
+
+  m_binaryEnabled = true;
+}
+
+void seissol::writer::ReceiverWriter::writeBinary(double time) {
+  // The executor may still write the previous samples
+  wait();
+
+  using ReceiverModule = async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>;
+  auto* sampleCounts =
+      ReceiverModule::managedBuffer<std::uint64_t*>(ReceiverWriterExecutor::SAMPLE_COUNTS);
+  auto* samples = ReceiverModule::managedBuffer<real*>(ReceiverWriterExecutor::SAMPLES);
+
+  std::size_t numberOfReceivers = 0;
+  std::size_t numberOfValues = 0;
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      auto ncols = cluster.ncols();
+      for (auto& receiver : cluster) {
+        assert(receiver.output.size() % ncols == 0);
+        if (numberOfValues + receiver.output.size() > m_maxSamples) {
+          logError() << "Receiver samples exceed the output buffer of" << m_maxSamples << "values.";
+        }
+        std::memcpy(samples + numberOfValues, receiver.output.data(), receiver.output.size() * sizeof(real));
+        sampleCounts[numberOfReceivers++] = receiver.output.size() / ncols;
+        numberOfValues += receiver.output.size();
+        receiver.output.clear();
+      }
+    }
+  }
+  assert(numberOfReceivers == m_numberOfReceivers);
+
+  sendBuffer(ReceiverWriterExecutor::SAMPLE_COUNTS, numberOfReceivers * sizeof(std::uint64_t));
+  sendBuffer(ReceiverWriterExecutor::SAMPLES, numberOfValues * sizeof(real));
+
+  ReceiverParam param;
+  param.time = time;
+  call(param);
+}
+
+void seissol::writer::ReceiverWriter::syncPoint(double time)
 {
+  if (m_binaryEnabled) {
+    // All ranks initialized the asynchronous module, hence all ranks have to call it,
+    // even without receivers (the I/O ranks wait for every rank in the ASYNC MPI mode)
+    m_stopwatch.start();
+    writeBinary(time);
+    auto elapsed = m_stopwatch.stop();
+    logInfo(seissol::MPI::mpi.rank()) << "Copied receivers to the output buffers in" << elapsed << "seconds.";
+    return;
+  }
+
   if (m_receiverClusters.empty()) {
     return;
   }
@@ -178,6 +307,7 @@ void seissol::writer::ReceiverWriter::init(const std::string& fileNamePrefix, do
   m_receiverFileName = parameters.fileName;
   m_samplingInterval = parameters.samplingInterval;
   m_computeRotation = parameters.computeRotation;
+  m_format = parameters.format;
   setSyncInterval(std::min(endTime, parameters.interval));
   Modules::registerHook(*this, ModuleHook::SimulationStart);
   Modules::registerHook(*this, ModuleHook::SynchronizationPoint);
@@ -230,10 +360,17 @@ void seissol::writer::ReceiverWriter::addPoints(seissol::geometry::MeshReader co
         clusters.emplace_back(global, quantities, m_samplingInterval, syncInterval(), m_computeRotation, seissolInstance);
       }
 
-      writeHeader(point, points[point]);
+      if (m_format == seissol::initializer::parameters::ReceiverOutputFormat::Ascii) {
+        writeHeader(point, points[point]);
+      }
       m_receiverClusters[layer][cluster].addReceiver(meshId, point, points[point], mesh, ltsLut, lts);
     }
   }
+
+  if (m_format == seissol::initializer::parameters::ReceiverOutputFormat::Binary) {
+    logInfo(rank) << "Initializing binary receiver output.";
+    initBinaryOutput();
+  }
 }
 
 void seissol::writer::ReceiverWriter::simulationStart() {
@@ -44,12 +44,14 @@
 #include <string_view>
 
 #include <Eigen/Dense>
+#include <async/Module.h>
 #include "Geometry/MeshReader.h"
 #include "Initializer/tree/Lut.hpp"
 #include "Initializer/LTS.h"
 #include "Kernels/Receiver.h"
 #include "Modules/Module.h"
 #include "Monitoring/Stopwatch.h"
+#include "ReceiverWriterExecutor.h"
 
 struct LocalIntegrationData;
 struct GlobalData;
@@ -57,6 +59,7 @@ namespace seissol {
   class SeisSol;
   namespace initializer::parameters {
     struct ReceiverOutputParameters;
+    enum class ReceiverOutputFormat;
   }
 }
 
@@ -64,7 +67,8 @@ namespace seissol::writer {
     Eigen::Vector3d parseReceiverLine(const std::string& line);
     std::vector<Eigen::Vector3d> parseReceiverFile(const std::string& receiverFileName);
 
-    class ReceiverWriter : public seissol::Module {
+    class ReceiverWriter : private async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>,
+                           public seissol::Module {
     private:
       seissol::SeisSol& seissolInstance;
 
@@ -79,6 +83,17 @@ namespace seissol::writer {
           const seissol::initializer::LTS& lts,
           const GlobalData* global);
 
+      /**
+       * Called by ASYNC on all ranks
+       */
+      void setUp();
+
+      void tearDown() {
+        m_executor.finalize();
+      }
+
+      void close();
+
       kernels::ReceiverCluster* receiverCluster(unsigned clusterId, LayerType layer) {
         assert(layer != Ghost);
         assert(m_receiverClusters.find(layer) != m_receiverClusters.end());
@@ -97,12 +112,23 @@ namespace seissol::writer {
 
     private:
       [[nodiscard]] std::string fileName(unsigned pointId) const;
+      [[nodiscard]] std::vector<std::string> columnNames() const;
       void writeHeader(unsigned pointId, Eigen::Vector3d const& point);
+      void initBinaryOutput();
+      void writeBinary(double time);
 
       std::string m_receiverFileName;
       std::string m_fileNamePrefix;
       double      m_samplingInterval;
       bool        m_computeRotation;
+      seissol::initializer::parameters::ReceiverOutputFormat m_format;
+      //! true if the binary output has been initialized
+      bool        m_binaryEnabled = false;
+      //! number of local receivers
+      std::size_t m_numberOfReceivers = 0;
+      //! capacity of the sample buffer (in reals)
+      std::size_t m_maxSamples = 0;
+      ReceiverWriterExecutor m_executor;
       // Map needed because LayerType enum casts weirdly to int.
       std::unordered_map<LayerType, std::vector<kernels::ReceiverCluster>> m_receiverClusters;
       Stopwatch   m_stopwatch;
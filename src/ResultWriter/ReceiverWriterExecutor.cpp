@@ -0,0 +1,216 @@
+#include "ReceiverWriterExecutor.h"
+
+#include <array>
+#include <cassert>
+#include <climits>
+#include <cstring>
+#include <sys/stat.h>
+
+#include <utils/logger.h>
+
+#include "Kernels/precision.hpp"
+
+namespace seissol::writer {
+
+namespace {
+//! magic, time, number of records, payload size
+constexpr std::uint64_t BlockHeaderSize = 8 + sizeof(double) + 2 * sizeof(std::uint64_t);
+
+template <typename T>
+void append(std::vector<char>& buffer, const T& value) {
+  const auto* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+} // namespace
+
+void ReceiverWriterExecutor::execInit(const async::ExecInfo& info,
+                                      const ReceiverInitParam& param) {
+  const std::uint64_t numberOfReceivers = info.bufferSize(POINTS) / sizeof(ReceiverPointRecord);
+
+#ifdef USE_MPI
+  MPI_Comm_split(
+      seissol::MPI::mpi.comm(), (numberOfReceivers > 0 ? 0 : MPI_UNDEFINED), 0, &m_comm);
+#endif // USE_MPI
+
+  if (numberOfReceivers == 0) {
+    return;
+  }
+  m_enabled = true;
+  m_ncols = param.ncols;
+
+#ifdef USE_MPI
+  MPI_Comm_rank(m_comm, &m_rank);
+#endif // USE_MPI
+
+  const auto* points = static_cast<const ReceiverPointRecord*>(info.buffer(POINTS));
+  m_pointIds.resize(numberOfReceivers);
+  for (std::uint64_t i = 0; i < numberOfReceivers; ++i) {
+    m_pointIds[i] = points[i].pointId;
+  }
+
+  const std::string fileName(static_cast<const char*>(info.buffer(FILE_NAME)));
+  const std::string names(static_cast<const char*>(info.buffer(NAMES)));
+
+  // Keep appending to the file of a previous run, as done for the ASCII receivers
+  int exists = 0;
+  if (m_rank == 0) {
+    struct stat fileStat;
+    exists = stat(fileName.c_str(), &fileStat) == 0 ? 1 : 0;
+  }
+
+  std::uint64_t receiversBefore = 0;
+  std::uint64_t totalReceivers = numberOfReceivers;
+#ifdef USE_MPI
+  MPI_Bcast(&exists, 1, MPI_INT, 0, m_comm);
+  MPI_Exscan(&numberOfReceivers, &receiversBefore, 1, MPI_UINT64_T, MPI_SUM, m_comm);
+  if (m_rank == 0) {
+    receiversBefore = 0;
+  }
+  MPI_Allreduce(&numberOfReceivers, &totalReceivers, 1, MPI_UINT64_T, MPI_SUM, m_comm);
+
+  MPI_File_open(
+      m_comm, fileName.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &m_file);
+  if (m_file == MPI_FILE_NULL) {
+    logError() << "Could not open receiver file" << fileName;
+  }
+  if (exists != 0) {
+    MPI_Offset size = 0;
+    MPI_File_get_size(m_file, &size);
+    m_fileOffset = size;
+  }
+#else
+  if (exists == 0) {
+    const std::ofstream emptyFile(fileName, std::ios::binary);
+  }
+  m_file.open(fileName, std::ios::in | std::ios::out | std::ios::binary);
+  if (!m_file) {
+    logError() << "Could not open receiver file" << fileName;
+  }
+  if (exists != 0) {
+    m_file.seekp(0, std::ios::end);
+    m_fileOffset = m_file.tellp();
+  }
+#endif // USE_MPI
+
+  if (exists == 0) {
+    std::vector<char> header(FileMagic, FileMagic + sizeof(FileMagic));
+    append(header, totalReceivers);
+    append(header, m_ncols);
+    append(header, static_cast<std::uint64_t>(sizeof(real)));
+    append(header, static_cast<std::uint64_t>(names.size()));
+    header.insert(header.end(), names.begin(), names.end());
+
+    if (m_rank == 0) {
+      writeAt(0, header.data(), header.size(), false);
+    }
+    writeAt(header.size() + receiversBefore * sizeof(ReceiverPointRecord),
+            points,
+            numberOfReceivers * sizeof(ReceiverPointRecord),
+            true);
+    m_fileOffset = header.size() + totalReceivers * sizeof(ReceiverPointRecord);
+  }
+
+  logInfo(m_rank) << "Initializing binary receiver output. Done.";
+}
+
+void ReceiverWriterExecutor::exec(const async::ExecInfo& info, const ReceiverParam& param) {
+  if (!m_enabled) {
+    return;
+  }
+
+  m_stopwatch.start();
+
+  const auto* sampleCounts = static_cast<const std::uint64_t*>(info.buffer(SAMPLE_COUNTS));
+  const auto* samples = static_cast<const char*>(info.buffer(SAMPLES));
+  const auto numberOfRecords = info.bufferSize(SAMPLE_COUNTS) / sizeof(std::uint64_t);
+  assert(numberOfRecords == m_pointIds.size());
+
+  m_records.clear();
+  std::size_t sampleOffset = 0;
+  for (std::size_t r = 0; r < numberOfRecords; ++r) {
+    const std::size_t bytes = sampleCounts[r] * m_ncols * sizeof(real);
+    append(m_records, m_pointIds[r]);
+    append(m_records, sampleCounts[r]);
+    m_records.insert(m_records.end(), samples + sampleOffset, samples + sampleOffset + bytes);
+    sampleOffset += bytes;
+  }
+
+  // [0]: number of records, [1]: payload size
+  std::array<std::uint64_t, 2> local{numberOfRecords, m_records.size()};
+  std::array<std::uint64_t, 2> before{0, 0};
+  std::array<std::uint64_t, 2> total = local;
+#ifdef USE_MPI
+  MPI_Exscan(local.data(), before.data(), 2, MPI_UINT64_T, MPI_SUM, m_comm);
+  if (m_rank == 0) {
+    before = {0, 0};
+  }
+  MPI_Allreduce(local.data(), total.data(), 2, MPI_UINT64_T, MPI_SUM, m_comm);
+#endif // USE_MPI
+
+  if (m_rank == 0) {
+    std::vector<char> header(BlockMagic, BlockMagic + sizeof(BlockMagic));
+    append(header, param.time);
+    append(header, total[0]);
+    append(header, total[1]);
+    assert(header.size() == BlockHeaderSize);
+    writeAt(m_fileOffset, header.data(), header.size(), false);
+  }
+  writeAt(m_fileOffset + BlockHeaderSize + before[1], m_records.data(), m_records.size(), true);
+  m_fileOffset += BlockHeaderSize + total[1];
+
+#ifndef USE_MPI
+  m_file.flush();
+#endif // USE_MPI
+
+  m_stopwatch.pause();
+}
+
+void ReceiverWriterExecutor::finalize() {
+  if (m_enabled) {
+    m_stopwatch.printTime("Time receiver writer backend:"
+#ifdef USE_MPI
+                          ,
+                          m_comm
+#endif // USE_MPI
+    );
+  }
+
+#ifdef USE_MPI
+  if (m_file != MPI_FILE_NULL) {
+    MPI_File_close(&m_file);
+  }
+  if (m_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&m_comm);
+    m_comm = MPI_COMM_NULL;
+  }
+#else
+  if (m_file.is_open()) {
+    m_file.close();
+  }
+#endif // USE_MPI
+
+  m_enabled = false;
+}
+
+void ReceiverWriterExecutor::writeAt(std::uint64_t offset,
+                                     const void* data,
+                                     std::size_t size,
+                                     bool collective) {
+#ifdef USE_MPI
+  if (size > INT_MAX) {
+    logError() << "Receiver output of" << size << "bytes per rank is too large.";
+  }
+  MPI_Status status;
+  if (collective) {
+    MPI_File_write_at_all(
+        m_file, offset, data, static_cast<int>(size), MPI_BYTE, &status);
+  } else {
+    MPI_File_write_at(m_file, offset, data, static_cast<int>(size), MPI_BYTE, &status);
+  }
+#else
+  m_file.seekp(offset);
+  m_file.write(static_cast<const char*>(data), size);
+#endif // USE_MPI
+}
+
+} // namespace seissol::writer
@@ -0,0 +1,94 @@
+#ifndef SEISSOL_RESULTWRITER_RECEIVERWRITEREXECUTOR_H_
+#define SEISSOL_RESULTWRITER_RECEIVERWRITEREXECUTOR_H_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "async/ExecInfo.h"
+
+#include "Monitoring/Stopwatch.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::writer {
+
+struct ReceiverInitParam {
+  //! number of values per sample (including the time)
+  std::uint64_t ncols;
+};
+
+struct ReceiverParam {
+  double time;
+};
+
+/**
+ * Entry of the receiver table in the binary receiver file.
+ */
+struct ReceiverPointRecord {
+  std::uint64_t pointId;
+  double position[3];
+};
+
+/**
+ * Writes the receivers of all ranks to a single binary file.
+ * The file layout is described in the documentation of the receiver output.
+ * Used for the off-fault receivers and the on-fault receivers (pick points).
+ */
+class ReceiverWriterExecutor {
+  public:
+  enum BufferIds {
+    FILE_NAME = 0,
+    NAMES = 1,
+    POINTS = 2,
+    SAMPLE_COUNTS = 3,
+    SAMPLES = 4,
+  };
+
+  static constexpr char FileMagic[8] = {'S', 'S', 'R', 'E', 'C', 'V', '0', '1'};
+  static constexpr char BlockMagic[8] = {'S', 'S', 'R', 'B', 'L', 'O', 'C', 'K'};
+
+  /**
+   * Creates (or, on restart, reopens) the receiver file and writes the header and receiver table.
+   */
+  void execInit(const async::ExecInfo& info, const ReceiverInitParam& param);
+
+  /**
+   * Appends the samples of one synchronization interval.
+   */
+  void exec(const async::ExecInfo& info, const ReceiverParam& param);
+
+  void finalize();
+
+  private:
+  void writeAt(std::uint64_t offset, const void* data, std::size_t size, bool collective);
+
+#ifdef USE_MPI
+  /** The MPI communicator for the writer */
+  MPI_Comm m_comm{MPI_COMM_NULL};
+
+  MPI_File m_file{MPI_FILE_NULL};
+#else
+  std::fstream m_file;
+#endif // USE_MPI
+
+  bool m_enabled{false};
+  int m_rank{0};
+  std::uint64_t m_ncols{0};
+
+  //! end of the file
+  std::uint64_t m_fileOffset{0};
+
+  //! point ids of the local receivers, in the order of the sample buffers
+  std::vector<std::uint64_t> m_pointIds;
+
+  //! serialized records of the local receivers
+  std::vector<char> m_records;
+
+  /** Backend stopwatch */
+  Stopwatch m_stopwatch;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_RECEIVERWRITEREXECUTOR_H_
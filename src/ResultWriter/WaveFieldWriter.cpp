@@ -40,6 +40,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <vector>
 
 #include "SeisSol.h"
 #include "WaveFieldWriter.h"
@@ -448,6 +449,13 @@ void seissol::writer::WaveFieldWriter::write(double time) {
 
   logInfo(rank) << "Writing wave field at time" << utils::nospace << time << '.';
 
+  // Collect the output buffers, such that all variables are sub-sampled in one pass
+  const unsigned int numWaveVariables =
+      m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES;
+  std::vector<unsigned int> variables;
+  std::vector<real*> buffers;
+  std::vector<unsigned int> pstrainVariables;
+  std::vector<real*> pstrainBuffers;
   unsigned int nextId = m_variableBufferIds[0];
   for (unsigned int i = 0; i < m_numVariables; i++) {
     if (!m_outputFlags[i])
@@ -456,25 +464,31 @@ void seissol::writer::WaveFieldWriter::write(double time) {
     real* managedBuffer =
         async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::managedBuffer<
             real*>(nextId);
-    if (i < m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES) {
-      m_variableSubsampler->get(m_dofs, m_map, i, managedBuffer);
+    if (i < numWaveVariables) {
+      variables.push_back(i);
+      buffers.push_back(managedBuffer);
     } else {
-      m_variableSubsamplerPStrain->get(
-          m_pstrain,
-          m_map,
-          i - (m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES),
-          managedBuffer);
+      pstrainVariables.push_back(i - numWaveVariables);
+      pstrainBuffers.push_back(managedBuffer);
     }
-    for (unsigned int j = 0; j < m_numCells; j++) {
-      if (!std::isfinite(managedBuffer[j])) {
-        logError() << "Detected Inf/NaN in volume output. Aborting.";
-      }
-    }
-    sendBuffer(nextId, m_numCells * sizeof(real));
 
     nextId++;
   }
 
+  bool finite = m_variableSubsampler->get(m_dofs, m_map, variables, buffers.data());
+  if (!pstrainVariables.empty()) {
+    finite =
+        m_variableSubsamplerPStrain->get(m_pstrain, m_map, pstrainVariables, pstrainBuffers.data()) &&
+        finite;
+  }
+  if (!finite) {
+    logError() << "Detected Inf/NaN in volume output. Aborting.";
+  }
+
+  for (unsigned int id = m_variableBufferIds[0]; id < nextId; id++) {
+    sendBuffer(id, m_numCells * sizeof(real));
+  }
+
   // nextId is required in a manner similar to above for writing integrated variables
   nextId = 0;
 
@@ -91,6 +91,8 @@ bool seissol::SeisSol::init(int argc, char* argv[]) {
   MPI::mpi.setDataTransferModeFromEnv();
 
   printPersistentMpiInfo(MPI::mpi);
+  printFaceRestrictedMpiInfo(MPI::mpi);
+  printHaloCodecInfo(MPI::mpi);
 #endif
 #ifdef _OPENMP
   pinning.checkEnvVariables();
@@ -101,6 +103,7 @@ bool seissol::SeisSol::init(int argc, char* argv[]) {
                 << parallel::Pinning::maskToString(pinning.getNodeMask());
 
   seissol::printCommThreadInfo(MPI::mpi);
+  seissol::printTaskedExecutionInfo(MPI::mpi);
   if (seissol::useCommThread(MPI::mpi)) {
     auto freeCpus = pinning.getFreeCPUsMask();
     logInfo(rank) << "Communication thread affinity        :"
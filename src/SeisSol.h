@@ -59,6 +59,7 @@
 #include "ResultWriter/EnergyOutput.h"
 #include "ResultWriter/FaultWriter.h"
 #include "ResultWriter/FreeSurfaceWriter.h"
+#include "ResultWriter/PickpointWriter.h"
 #include "ResultWriter/PostProcessor.h"
 #include "ResultWriter/WaveFieldWriter.h"
 #include "Solver/FreeSurfaceIntegrator.h"
@@ -133,6 +134,11 @@ class SeisSol {
    */
   writer::ReceiverWriter& receiverWriter() { return m_receiverWriter; }
 
+  /**
+   * Get the on-fault receiver (pick point) writer module
+   */
+  writer::PickpointWriter& pickpointWriter() { return m_pickpointWriter; }
+
   /**
    * Get the energy writer module
    */
@@ -265,6 +271,9 @@ class SeisSol {
   //! Receiver writer module
   writer::ReceiverWriter m_receiverWriter;
 
+  //! On-fault receiver (pick point) writer module
+  writer::PickpointWriter m_pickpointWriter;
+
   //! Energy writer module
   writer::EnergyOutput m_energyOutput;
 
@@ -285,7 +294,7 @@ class SeisSol {
         m_memoryManager(std::make_unique<initializer::MemoryManager>(*this)), m_timeManager(*this),
         m_checkPointManager(*this), m_freeSurfaceWriter(*this), m_analysisWriter(*this),
         m_waveFieldWriter(*this), m_faultWriter(*this), m_receiverWriter(*this),
-        m_energyOutput(*this), timeMirrorManagers(*this, *this) {}
+        m_pickpointWriter(*this), m_energyOutput(*this), timeMirrorManagers(*this, *this) {}
 };
 
 } // namespace seissol
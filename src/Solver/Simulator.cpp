@@ -39,6 +39,7 @@
  * Entry point of the simulation.
  **/
 
+#include <cmath>
 #include <limits>
 
 #include "Simulator.h"
@@ -87,12 +88,18 @@ void seissol::Simulator::abort() {
 	m_abort = true;
 }
 
+bool seissol::Simulator::requiresGlobalBarrier( double time, double timeTolerance ) const {
+  const bool checkPointDue =
+      std::abs(time - (m_checkPointTime + m_checkPointInterval)) < timeTolerance;
+  return checkPointDue || Modules::requiresGlobalSynchronization(time, timeTolerance);
+}
+
 
 void seissol::Simulator::simulate(seissol::SeisSol& seissolInstance) {
   SCOREP_USER_REGION( "simulate", SCOREP_USER_REGION_TYPE_FUNCTION )
 
   auto* faultOutputManager = seissolInstance.timeManager().getFaultOutputManager();
-  faultOutputManager->writePickpointOutput(0.0, 0.0);
+  faultOutputManager->writePickpointOutput(m_currentTime, 0.0);
 
   Stopwatch simulationStopwatch;
   simulationStopwatch.start();
@@ -126,6 +133,14 @@ void seissol::Simulator::simulate(seissol::SeisSol& seissolInstance) {
 
   double lastSplit = 0;
 
+  // The phase reports are collective operations. Hence, they are only printed at synchronization
+  // points which synchronize all ranks anyway, and at least for every percent of the simulated time.
+  const double reportInterval = (m_finalTime - m_currentTime) / 100;
+  double lastReportTime = m_currentTime;
+
+  // Synchronize all ranks once after the initialization
+  bool globalSynchronization = true;
+
   ioStopwatch.pause();
 
   Stopwatch::print("Time spent for initial IO:", ioStopwatch.split(), seissol::MPI::mpi.comm());
@@ -141,7 +156,7 @@ void seissol::Simulator::simulate(seissol::SeisSol& seissolInstance) {
 
     // update the DOFs
     computeStopwatch.start();
-    seissolInstance.timeManager().advanceInTime( upcomingTime );
+    seissolInstance.timeManager().advanceInTime( upcomingTime, globalSynchronization );
     computeStopwatch.pause();
 
     ioStopwatch.start();
@@ -149,6 +164,14 @@ void seissol::Simulator::simulate(seissol::SeisSol& seissolInstance) {
     // update current time
     m_currentTime = upcomingTime;
 
+    // All ranks only have to wait for each other after this synchronization point if a checkpoint
+    // or an abort criterion is due; otherwise, ranks which are done with their synchronization
+    // point continue with the time stepping. Evaluated before the hooks move on to their next
+    // synchronization point.
+    const bool checkPointDue =
+        std::abs(m_currentTime - (m_checkPointTime + m_checkPointInterval)) < l_timeTolerance;
+    globalSynchronization = requiresGlobalBarrier(m_currentTime, l_timeTolerance);
+
     // Set new upcoming time (might by overwritten by any of the modules)
     upcomingTime = m_finalTime;
 
@@ -156,7 +179,7 @@ void seissol::Simulator::simulate(seissol::SeisSol& seissolInstance) {
     upcomingTime = std::min(upcomingTime, Modules::callSyncHook(m_currentTime, l_timeTolerance));
 
     // write checkpoint if required
-    if( std::abs( m_currentTime - ( m_checkPointTime + m_checkPointInterval ) ) < l_timeTolerance ) {
+    if (checkPointDue) {
       const unsigned int faultTimeStep = seissolInstance.faultWriter().timestep();
       seissolInstance.checkPointManager().write(m_currentTime, faultTimeStep);
       m_checkPointTime += m_checkPointInterval;
@@ -165,12 +188,15 @@ void seissol::Simulator::simulate(seissol::SeisSol& seissolInstance) {
 
     ioStopwatch.pause();
 
-    double currentSplit = simulationStopwatch.split();
-    Stopwatch::print("Time spent this phase (total):", currentSplit - lastSplit, seissol::MPI::mpi.comm());
-    Stopwatch::print("Time spent this phase (compute):", computeStopwatch.split(), seissol::MPI::mpi.comm());
-    Stopwatch::print("Time spent this phase (IO):", ioStopwatch.split(), seissol::MPI::mpi.comm());
-    seissolInstance.flopCounter().printPerformanceUpdate(currentSplit);
-    lastSplit = currentSplit;
+    if (globalSynchronization || m_currentTime > lastReportTime + reportInterval - l_timeTolerance) {
+      double currentSplit = simulationStopwatch.split();
+      Stopwatch::print("Time spent this phase (total):", currentSplit - lastSplit, seissol::MPI::mpi.comm());
+      Stopwatch::print("Time spent this phase (compute):", computeStopwatch.split(), seissol::MPI::mpi.comm());
+      Stopwatch::print("Time spent this phase (IO):", ioStopwatch.split(), seissol::MPI::mpi.comm());
+      seissolInstance.flopCounter().printPerformanceUpdate(currentSplit);
+      lastSplit = currentSplit;
+      lastReportTime = m_currentTime;
+    }
   }
 
   Modules::callSyncHook(m_currentTime, l_timeTolerance, true);
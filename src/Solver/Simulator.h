@@ -125,6 +125,17 @@ class seissol::Simulator {
      */
     void abort();
 
+    /**
+     * Returns true if all ranks have to wait for each other after the synchronization point at
+     * the given time, i.e. if a checkpoint or a module requiring global synchronization is due.
+     * Has to be evaluated before the synchronization hooks move on to their next
+     * synchronization point.
+     *
+     * @param time time of the synchronization point.
+     * @param timeTolerance tolerance for comparing times.
+     */
+    bool requiresGlobalBarrier( double time, double timeTolerance ) const;
+
     /**
      * Simulates until finished.
      **/
@@ -4,12 +4,16 @@
 
 namespace seissol::time_stepping {
 bool AbstractGhostTimeCluster::testQueue(MPI_Request* requests,
-                                         std::list<unsigned int>& regions) {
+                                         std::list<unsigned int>& regions,
+                                         const std::function<void(unsigned int)>& onCompletion) {
   for (auto region = regions.begin(); region != regions.end();) {
     MPI_Request *request = &requests[*region];
     int testSuccess = 0;
     MPI_Test(request, &testSuccess, MPI_STATUS_IGNORE);
     if (testSuccess) {
+      if (onCompletion) {
+        onCompletion(*region);
+      }
       region = regions.erase(region);
     } else {
       ++region;
@@ -18,6 +22,68 @@ bool AbstractGhostTimeCluster::testQueue(MPI_Request* requests,
   return regions.empty();
 }
 
+void AbstractGhostTimeCluster::sendRegion(unsigned int region, const real* data, unsigned int count) {
+  if (haloCodec) {
+    auto& encoded = encodedCopyRegions[region];
+    encoded.resize(haloCodec->maxEncodedSize(count));
+    const auto encodedSize = haloCodec->encode(data, count, encoded.data());
+    MPI_Isend(encoded.data(),
+              static_cast<int>(encodedSize),
+              MPI_BYTE,
+              meshStructure->neighboringClusters[region][0],
+              timeData + meshStructure->sendIdentifiers[region],
+              seissol::MPI::mpi.comm(),
+              meshStructure->sendRequests + region);
+  } else {
+    MPI_Isend(data,
+              static_cast<int>(count),
+              MPI_C_REAL,
+              meshStructure->neighboringClusters[region][0],
+              timeData + meshStructure->sendIdentifiers[region],
+              seissol::MPI::mpi.comm(),
+              meshStructure->sendRequests + region);
+  }
+}
+
+void AbstractGhostTimeCluster::receiveRegion(unsigned int region, real* data, unsigned int count) {
+  if (haloCodec) {
+    auto& encoded = encodedGhostRegions[region];
+    encoded.resize(haloCodec->maxEncodedSize(count));
+    MPI_Irecv(encoded.data(),
+              static_cast<int>(encoded.size()),
+              MPI_BYTE,
+              meshStructure->neighboringClusters[region][0],
+              timeData + meshStructure->receiveIdentifiers[region],
+              seissol::MPI::mpi.comm(),
+              meshStructure->receiveRequests + region);
+  } else {
+    MPI_Irecv(data,
+              static_cast<int>(count),
+              MPI_C_REAL,
+              meshStructure->neighboringClusters[region][0],
+              timeData + meshStructure->receiveIdentifiers[region],
+              seissol::MPI::mpi.comm(),
+              meshStructure->receiveRequests + region);
+  }
+}
+
+void AbstractGhostTimeCluster::decodeRegion(unsigned int region, real* data, unsigned int count) {
+  if (haloCodec) {
+    haloCodec->decode(encodedGhostRegions[region].data(), count, data);
+  }
+}
+
+void AbstractGhostTimeCluster::setHaloCodec(HaloCodecType type) {
+  if (type == HaloCodecType::None ||
+      (type == HaloCodecType::Float && sizeof(real) == sizeof(float))) {
+    haloCodec = nullptr;
+    return;
+  }
+  haloCodec = std::make_unique<HaloCodec>(type);
+  encodedCopyRegions.resize(meshStructure->numberOfRegions);
+  encodedGhostRegions.resize(meshStructure->numberOfRegions);
+}
+
 bool AbstractGhostTimeCluster::testForCopyLayerSends() {
   SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
   return testQueue(meshStructure->sendRequests, sendQueue);
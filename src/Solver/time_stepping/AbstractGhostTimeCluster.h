@@ -1,8 +1,12 @@
 #pragma once
 
+#include <functional>
 #include <list>
+#include <memory>
+#include <vector>
 #include "Initializer/typedefs.hpp"
 #include "AbstractTimeCluster.h"
+#include "HaloCodec.h"
 
 namespace seissol::time_stepping {
 class AbstractGhostTimeCluster : public AbstractTimeCluster {
@@ -15,10 +19,34 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
 
   double lastSendTime = -1.0;
 
+  //! codec of the transferred regions; nullptr if the regions are sent as they are
+  std::unique_ptr<HaloCodec> haloCodec;
+  std::vector<std::vector<char>> encodedCopyRegions;
+  std::vector<std::vector<char>> encodedGhostRegions;
+
   virtual void sendCopyLayer() = 0;
   virtual void receiveGhostLayer() = 0;
 
-  bool testQueue(MPI_Request* requests, std::list<unsigned int>& regions);
+  /**
+   * Posts a non-blocking send of count reals to the neighbor of the region.
+   * The data is encoded first if a halo codec is set.
+   */
+  void sendRegion(unsigned int region, const real* data, unsigned int count);
+
+  /**
+   * Posts a non-blocking receive of count reals from the neighbor of the region.
+   * If a halo codec is set, the encoded data is received into a staging buffer and
+   * needs to be decoded with decodeRegion once the receive has completed.
+   */
+  void receiveRegion(unsigned int region, real* data, unsigned int count);
+  void decodeRegion(unsigned int region, real* data, unsigned int count);
+
+  /**
+   * Removes the regions with completed requests from the queue and calls onCompletion for them.
+   */
+  bool testQueue(MPI_Request* requests,
+                 std::list<unsigned int>& regions,
+                 const std::function<void(unsigned int)>& onCompletion = {});
   bool testForCopyLayerSends();
   virtual bool testForGhostLayerReceives() = 0;
 
@@ -41,5 +69,10 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
 
   void reset() override;
   ActResult act() override;
+
+  /**
+   * Encodes all regions with the given codec; needs to be set before the first transfer.
+   */
+  void setHaloCodec(HaloCodecType type);
 };
 } // namespace seissol::time_stepping
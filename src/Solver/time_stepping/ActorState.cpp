@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cassert>
 #include <cmath>
 #include <memory>
 #include <algorithm>
@@ -35,24 +36,54 @@ std::string actorStateToString(ActorState state) {
 }
 
 
+MessageQueue::MessageQueue() : head(new Segment()), tail(head) {}
+
+MessageQueue::~MessageQueue() {
+  while (head != nullptr) {
+    Segment* next = head->next.load(std::memory_order_relaxed);
+    delete head;
+    head = next;
+  }
+}
+
 void MessageQueue::push(const Message& message) {
-  std::lock_guard lock{mutex};
-  queue.push(message);
+  if (writeIndex == SegmentSize) {
+    auto* segment = new Segment();
+    tail->next.store(segment, std::memory_order_release);
+    tail = segment;
+    writeIndex = 0;
+  }
+  tail->messages[writeIndex] = message;
+  ++writeIndex;
+  // publishes the message to the consumer
+  tail->written.store(writeIndex, std::memory_order_release);
+  // only the producer writes the counter, hence no read-modify-write is needed
+  numberOfPushed.store(numberOfPushed.load(std::memory_order_relaxed) + 1, std::memory_order_release);
 }
 
 Message MessageQueue::pop() {
-  std::lock_guard lock{mutex};
-  const Message message = queue.front();
-  queue.pop();
-  return message;
+  assert(hasMessages());
+  if (readIndex == SegmentSize) {
+    // the producer has moved on to the next segment and does not touch this one anymore
+    Segment* next = head->next.load(std::memory_order_acquire);
+    delete head;
+    head = next;
+    readIndex = 0;
+  }
+  ++numberOfPopped;
+  return head->messages[readIndex++];
 }
 
 bool MessageQueue::hasMessages() const {
-  return !queue.empty();
+  if (readIndex < SegmentSize) {
+    return readIndex < head->written.load(std::memory_order_acquire);
+  }
+  const Segment* next = head->next.load(std::memory_order_acquire);
+  return next != nullptr && next->written.load(std::memory_order_acquire) > 0;
 }
 
 size_t MessageQueue::size() const {
-  return queue.size();
+  return numberOfPushed.load(std::memory_order_acquire) - numberOfPopped;
 }
 
 double ClusterTimes::nextCorrectionTime(double syncTime) const {
@@ -1,9 +1,9 @@
 #ifndef SEISSOL_ACTORSTATE_H
 #define SEISSOL_ACTORSTATE_H
 
+#include <array>
+#include <atomic>
 #include <memory>
-#include <mutex>
-#include <queue>
 #include <variant>
 
 namespace seissol::time_stepping {
@@ -24,14 +24,43 @@ template<class T> struct always_false : std::false_type {};
 
 inline std::ostream& operator<<(std::ostream& stream, const Message& message);
 
+/**
+ * Lock-free single-producer/single-consumer queue for the messages between two actors.
+ *
+ * Each queue connects exactly one sending and one receiving actor, and an actor is only
+ * advanced by one thread at a time; hence, push is only called by the producer and
+ * pop, hasMessages, and size only by the consumer.
+ * The messages are stored in a linked list of fixed-size segments, s.t. the producer never
+ * has to wait for the consumer.
+ */
 class MessageQueue {
  private:
-  std::queue<Message> queue;
-  std::mutex mutex;
+  static constexpr std::size_t SegmentSize = 64;
+  static constexpr std::size_t CacheLineSize = 64;
+
+  struct Segment {
+    std::array<Message, SegmentSize> messages;
+    //! number of messages which are written to this segment, set by the producer
+    std::atomic<std::size_t> written{0};
+    std::atomic<Segment*> next{nullptr};
+  };
+
+  // consumer side
+  alignas(CacheLineSize) Segment* head;
+  std::size_t readIndex = 0;
+  std::size_t numberOfPopped = 0;
+
+  // producer side
+  alignas(CacheLineSize) Segment* tail;
+  std::size_t writeIndex = 0;
+  std::atomic<std::size_t> numberOfPushed{0};
 
  public:
-  MessageQueue() = default;
-  ~MessageQueue() = default;
+  MessageQueue();
+  ~MessageQueue();
+
+  MessageQueue(const MessageQueue&) = delete;
+  MessageQueue& operator=(const MessageQueue&) = delete;
 
   void push(Message const& message);
 
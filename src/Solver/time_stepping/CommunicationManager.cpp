@@ -23,9 +23,14 @@ std::vector<std::unique_ptr<seissol::time_stepping::AbstractGhostTimeCluster>>*
 }
 
 bool seissol::time_stepping::AbstractCommunicationManager::poll() {
+  bool progressed = false;
+  return poll(progressed);
+}
+
+bool seissol::time_stepping::AbstractCommunicationManager::poll(bool& progressed) {
   bool finished = true;
   for (auto& ghostCluster : ghostClusters) {
-    ghostCluster->act();
+    progressed = ghostCluster->act().isStateChanged || progressed;
     finished = finished && ghostCluster->synced();
   }
   return finished;
@@ -50,12 +55,14 @@ void seissol::time_stepping::SerialCommunicationManager::progression() {
 
 seissol::time_stepping::ThreadedCommunicationManager::ThreadedCommunicationManager(
     seissol::time_stepping::AbstractCommunicationManager::ghostClusters_t ghostClusters,
-    const seissol::parallel::Pinning* pinning)
+    const seissol::parallel::Pinning* pinning,
+    unsigned spinCount)
     : AbstractCommunicationManager(std::move(ghostClusters)),
       thread(),
       shouldReset(false),
       isFinished(false),
-      pinning(pinning) {
+      pinning(pinning),
+      spinCount(spinCount) {
 }
 
 void seissol::time_stepping::ThreadedCommunicationManager::progression() {
@@ -67,10 +74,11 @@ bool seissol::time_stepping::ThreadedCommunicationManager::checkIfFinished() con
 }
 
 void seissol::time_stepping::ThreadedCommunicationManager::reset(double newSyncTime) {
-  // Send signal to comm. thread to finish and wait.
+  // Send signal to comm. thread to stop polling and wait until it is idle.
   shouldReset.store(true);
-  if (thread.joinable()) {
-    thread.join();
+  {
+    std::unique_lock lock(mutex);
+    condition.wait(lock, [this]() { return !isRunning; });
   }
 
   // Reset flags and reset ghost clusters
@@ -78,28 +86,69 @@ void seissol::time_stepping::ThreadedCommunicationManager::reset(double newSyncT
   isFinished.store(false);
   AbstractCommunicationManager::reset(newSyncTime);
 
-  // Start a new communication thread.
-  // Note: Easier than keeping one alive, and not that expensive.
-  thread = std::thread([this](){
+  // Hand the ghost clusters over to the communication thread.
+  {
+    std::lock_guard lock(mutex);
+    ++generation;
+    isRunning = true;
+  }
+  condition.notify_all();
+
+  if (!thread.joinable()) {
+    thread = std::thread([this]() { run(); });
+  }
+}
+
+void seissol::time_stepping::ThreadedCommunicationManager::run() {
 #ifdef ACL_DEVICE
-    device::DeviceInstance& device = device::DeviceInstance::getInstance();
-    device.api->setDevice(0);
+  device::DeviceInstance& device = device::DeviceInstance::getInstance();
+  device.api->setDevice(0);
 #endif // ACL_DEVICE
-    // Pin this thread to the last core
-    // We compute the mask outside the thread because otherwise
-    // it confuses profilers and debuggers!
-    pinning->pinToFreeCPUs();
-    while(!shouldReset.load() && !isFinished.load()) {
-      isFinished.store(this->poll());
+  // Pin this thread to the last core
+  // We compute the mask outside the thread because otherwise
+  // it confuses profilers and debuggers!
+  pinning->pinToFreeCPUs();
+
+  SpinYieldBackoff backoff(spinCount);
+  unsigned long seenGeneration = 0;
+  while (true) {
+    {
+      // Sleep between the sync intervals
+      std::unique_lock lock(mutex);
+      condition.wait(lock, [&]() { return shouldStop || generation != seenGeneration; });
+      if (shouldStop) {
+        break;
+      }
+      seenGeneration = generation;
     }
-  });
+
+    backoff.reset();
+    while (!shouldReset.load() && !isFinished.load()) {
+      bool progressed = false;
+      isFinished.store(this->poll(progressed));
+      if (progressed) {
+        backoff.reset();
+      } else {
+        backoff.idle();
+      }
+    }
+
+    {
+      std::lock_guard lock(mutex);
+      isRunning = false;
+    }
+    condition.notify_all();
+  }
 }
 
 seissol::time_stepping::ThreadedCommunicationManager::~ThreadedCommunicationManager() {
+  {
+    std::lock_guard lock(mutex);
+    shouldStop = true;
+  }
+  shouldReset.store(true);
+  condition.notify_all();
   if (thread.joinable()) {
     thread.join();
   }
 }
-
-
-
@@ -2,7 +2,9 @@
 #define SEISSOL_COMMUNICATIONMANAGER_H
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include "Parallel/Pin.h"
@@ -10,6 +12,28 @@
 
 
 namespace seissol::time_stepping {
+/**
+ * Busy-waits for a given number of idle iterations, and yields the core afterwards.
+ */
+class SpinYieldBackoff {
+public:
+  explicit SpinYieldBackoff(unsigned spinCount) : spinCount(spinCount) {}
+
+  void idle() {
+    if (idleIterations < spinCount) {
+      ++idleIterations;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  void reset() { idleIterations = 0; }
+
+private:
+  unsigned spinCount;
+  unsigned idleIterations = 0;
+};
+
 class AbstractCommunicationManager {
 public:
   using ghostClusters_t = std::vector<std::unique_ptr<AbstractGhostTimeCluster>>;
@@ -24,6 +48,8 @@ public:
 protected:
   explicit AbstractCommunicationManager(ghostClusters_t ghostClusters);
   bool poll();
+  //! progressed is set to true if any ghost cluster changed its state
+  bool poll(bool& progressed);
   ghostClusters_t ghostClusters;
 
 };
@@ -38,7 +64,8 @@ public:
 class ThreadedCommunicationManager : public AbstractCommunicationManager {
 public:
   ThreadedCommunicationManager(ghostClusters_t ghostClusters,
-                               const parallel::Pinning* pinning);
+                               const parallel::Pinning* pinning,
+                               unsigned spinCount);
   void progression() override;
   [[nodiscard]] bool checkIfFinished() const override;
   void reset(double newSyncTime) override;
@@ -46,10 +73,21 @@ public:
   ~ThreadedCommunicationManager() override;
 
 private:
+  void run();
+
+  //! The communication thread is started at the first reset and lives until destruction
   std::thread thread;
   std::atomic<bool> shouldReset;
   std::atomic<bool> isFinished;
   const parallel::Pinning* pinning;
+  unsigned spinCount;
+
+  // Hand-over of the ghost clusters between the sync intervals
+  std::mutex mutex;
+  std::condition_variable condition;
+  unsigned long generation = 0;
+  bool isRunning = false;
+  bool shouldStop = false;
 };
 
 } // end namespace seissol::time_stepping
@@ -13,14 +13,9 @@ void DirectGhostTimeCluster::sendCopyLayer() {
         MPI_Start(meshStructure->sendRequests + region);
       }
       else {
-        MPI_Isend(meshStructure->copyRegions[region],
-                    static_cast<int>(meshStructure->copyRegionSizes[region]),
-                    MPI_C_REAL,
-                    meshStructure->neighboringClusters[region][0],
-                    timeData + meshStructure->sendIdentifiers[region],
-                    seissol::MPI::mpi.comm(),
-                    meshStructure->sendRequests + region
-                  );
+        sendRegion(region,
+                   meshStructure->copyRegions[region],
+                   meshStructure->copyRegionSizes[region]);
       }
       sendQueue.push_back(region);
     }
@@ -36,13 +31,9 @@ void DirectGhostTimeCluster::receiveGhostLayer() {
         MPI_Start(meshStructure->receiveRequests + region);
       }
       else {
-        MPI_Irecv(meshStructure->ghostRegions[region],
-                  static_cast<int>(meshStructure->ghostRegionSizes[region]),
-                  MPI_C_REAL,
-                  meshStructure->neighboringClusters[region][0],
-                  timeData + meshStructure->receiveIdentifiers[region],
-                  seissol::MPI::mpi.comm(),
-                  meshStructure->receiveRequests + region);
+        receiveRegion(region,
+                      meshStructure->ghostRegions[region],
+                      meshStructure->ghostRegionSizes[region]);
       }
       receiveQueue.push_back(region);
     }
@@ -51,6 +42,11 @@ void DirectGhostTimeCluster::receiveGhostLayer() {
 
 bool DirectGhostTimeCluster::testForGhostLayerReceives() {
   SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
+  if (haloCodec) {
+    return testQueue(meshStructure->receiveRequests, receiveQueue, [this](unsigned int region) {
+      decodeRegion(region, meshStructure->ghostRegions[region], meshStructure->ghostRegionSizes[region]);
+    });
+  }
   return testQueue(meshStructure->receiveRequests, receiveQueue);
 }
 
@@ -0,0 +1,175 @@
+#include "Parallel/MPI.h"
+#include "Solver/time_stepping/FaceGhostTimeCluster.h"
+#include "Initializer/MemoryAllocator.h"
+#include "generated_code/init.h"
+
+#include <algorithm>
+
+
+namespace seissol::time_stepping {
+void FaceGhostTimeCluster::packCopyRegion(unsigned int region) {
+  real* packed = packedCopyRegions[region];
+  for (const auto& cell : haloFaceLayout->copyRegions[region]) {
+    if (cell.face < 0) {
+      std::copy_n(cell.data, cell.packedSize(), packed);
+    } else if (cell.derivatives) {
+      kernel::projectDerivativesToFace krnl = projectDerivativesKrnlPrototype;
+      for (unsigned der = 0; der < CONVERGENCE_ORDER; ++der) {
+        krnl.dQ(der) = cell.data + derivativesOffsets[der];
+        krnl.facedQ(der) = packed + faceDerivativesOffsets[der];
+      }
+      krnl.execute(cell.face);
+    } else {
+      kernel::projectBufferToFace krnl = projectBufferKrnlPrototype;
+      krnl.I = cell.data;
+      krnl.faceI = packed;
+      krnl.execute(cell.face);
+    }
+    packed += cell.packedSize();
+  }
+}
+
+void FaceGhostTimeCluster::unpackGhostRegion(unsigned int region) {
+  const real* packed = packedGhostRegions[region];
+  for (const auto& cell : haloFaceLayout->ghostRegions[region]) {
+    if (cell.face < 0) {
+      std::copy_n(packed, cell.packedSize(), cell.data);
+    } else if (cell.derivatives) {
+      kernel::liftDerivativesFromFace krnl = liftDerivativesKrnlPrototype;
+      for (unsigned der = 0; der < CONVERGENCE_ORDER; ++der) {
+        krnl.dQ(der) = cell.data + derivativesOffsets[der];
+        krnl.facedQ(der) = packed + faceDerivativesOffsets[der];
+      }
+      krnl.execute(cell.face);
+    } else {
+      kernel::liftBufferFromFace krnl = liftBufferKrnlPrototype;
+      krnl.I = cell.data;
+      krnl.faceI = packed;
+      krnl.execute(cell.face);
+    }
+    packed += cell.packedSize();
+  }
+}
+
+void FaceGhostTimeCluster::sendCopyLayer() {
+  SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
+  assert(ct.correctionTime > lastSendTime);
+  lastSendTime = ct.correctionTime;
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+      packCopyRegion(region);
+      if (persistent) {
+        MPI_Start(meshStructure->sendRequests + region);
+      }
+      else {
+        sendRegion(region, packedCopyRegions[region], haloFaceLayout->copyRegionSizes[region]);
+      }
+      sendQueue.push_back(region);
+    }
+  }
+}
+
+void FaceGhostTimeCluster::receiveGhostLayer() {
+  SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
+  assert(ct.predictionTime >= lastSendTime);
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId) ) {
+      if (persistent) {
+        MPI_Start(meshStructure->receiveRequests + region);
+      }
+      else {
+        receiveRegion(region, packedGhostRegions[region], haloFaceLayout->ghostRegionSizes[region]);
+      }
+      receiveQueue.push_back(region);
+    }
+  }
+}
+
+bool FaceGhostTimeCluster::testForGhostLayerReceives() {
+  SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
+  return testQueue(meshStructure->receiveRequests, receiveQueue, [this](unsigned int region) {
+    decodeRegion(region, packedGhostRegions[region], haloFaceLayout->ghostRegionSizes[region]);
+    unpackGhostRegion(region);
+  });
+}
+
+FaceGhostTimeCluster::FaceGhostTimeCluster(double maxTimeStepSize,
+                                           int timeStepRate,
+                                           int globalTimeClusterId,
+                                           int otherGlobalTimeClusterId,
+                                           const MeshStructure* meshStructure,
+                                           const initializer::HaloFaceLayout* haloFaceLayout,
+                                           bool persistent)
+    : AbstractGhostTimeCluster(maxTimeStepSize,
+                               timeStepRate,
+                               globalTimeClusterId,
+                               otherGlobalTimeClusterId,
+                               meshStructure),
+      haloFaceLayout(haloFaceLayout), persistent(persistent) {
+  derivativesOffsets[0] = 0;
+  faceDerivativesOffsets[0] = 0;
+  for (unsigned der = 1; der < CONVERGENCE_ORDER; ++der) {
+    derivativesOffsets[der] = derivativesOffsets[der - 1] + tensor::dQ::size(der - 1);
+    faceDerivativesOffsets[der] = faceDerivativesOffsets[der - 1] + tensor::facedQ::size(der - 1);
+  }
+
+  for (unsigned face = 0; face < 4; ++face) {
+    projectBufferKrnlPrototype.haloFaceProjection(face, 0) =
+        init::haloFaceProjection::Values[tensor::haloFaceProjection::index(face, 0)];
+    liftBufferKrnlPrototype.haloFaceLift(face, 0) =
+        init::haloFaceLift::Values[tensor::haloFaceLift::index(face, 0)];
+    for (unsigned der = 0; der < CONVERGENCE_ORDER; ++der) {
+      projectDerivativesKrnlPrototype.haloFaceProjection(face, der) =
+          init::haloFaceProjection::Values[tensor::haloFaceProjection::index(face, der)];
+      liftDerivativesKrnlPrototype.haloFaceLift(face, der) =
+          init::haloFaceLift::Values[tensor::haloFaceLift::index(face, der)];
+    }
+  }
+
+  packedCopyRegions.resize(meshStructure->numberOfRegions, nullptr);
+  packedGhostRegions.resize(meshStructure->numberOfRegions, nullptr);
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+      packedCopyRegions[region] = static_cast<real*>(
+          seissol::memory::allocate(haloFaceLayout->copyRegionSizes[region] * sizeof(real), ALIGNMENT));
+      packedGhostRegions[region] = static_cast<real*>(
+          seissol::memory::allocate(haloFaceLayout->ghostRegionSizes[region] * sizeof(real), ALIGNMENT));
+
+      if (persistent) {
+        MPI_Send_init(packedCopyRegions[region],
+                      static_cast<int>(haloFaceLayout->copyRegionSizes[region]),
+                      MPI_C_REAL,
+                      meshStructure->neighboringClusters[region][0],
+                      timeData + meshStructure->sendIdentifiers[region],
+                      seissol::MPI::mpi.comm(),
+                      meshStructure->sendRequests + region);
+        MPI_Recv_init(packedGhostRegions[region],
+                      static_cast<int>(haloFaceLayout->ghostRegionSizes[region]),
+                      MPI_C_REAL,
+                      meshStructure->neighboringClusters[region][0],
+                      timeData + meshStructure->receiveIdentifiers[region],
+                      seissol::MPI::mpi.comm(),
+                      meshStructure->receiveRequests + region);
+      }
+    }
+  }
+}
+
+FaceGhostTimeCluster::~FaceGhostTimeCluster() {
+  for (unsigned int region = 0; region < packedCopyRegions.size(); ++region) {
+    seissol::memory::free(packedCopyRegions[region]);
+    seissol::memory::free(packedGhostRegions[region]);
+  }
+}
+
+void FaceGhostTimeCluster::finalize() {
+  if (persistent) {
+    for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+      if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+        MPI_Request_free(meshStructure->sendRequests + region);
+        MPI_Request_free(meshStructure->receiveRequests + region);
+      }
+    }
+  }
+}
+} // namespace seissol::time_stepping
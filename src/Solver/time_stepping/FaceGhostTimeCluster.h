@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <list>
+#include <vector>
+#include "Initializer/typedefs.hpp"
+#include "Initializer/HaloFaceLayout.h"
+#include "Solver/time_stepping/AbstractGhostTimeCluster.h"
+#include "generated_code/kernel.h"
+
+
+namespace seissol::time_stepping {
+/**
+ * Ghost time cluster which only communicates the traces of the copy cells on the faces shared
+ * with the other rank (cf. initializer::HaloFaceLayout).
+ * The copy regions are projected onto the faces before sending, and the received ghost regions
+ * are lifted back to volume data which has the same trace on the shared face.
+ */
+class FaceGhostTimeCluster : public AbstractGhostTimeCluster {
+protected:
+  virtual void sendCopyLayer();
+  virtual void receiveGhostLayer();
+  virtual bool testForGhostLayerReceives();
+
+public:
+  FaceGhostTimeCluster(double maxTimeStepSize,
+                       int timeStepRate,
+                       int globalTimeClusterId,
+                       int otherGlobalTimeClusterId,
+                       const MeshStructure* meshStructure,
+                       const initializer::HaloFaceLayout* haloFaceLayout,
+                       bool persistent);
+  ~FaceGhostTimeCluster();
+
+  FaceGhostTimeCluster(const FaceGhostTimeCluster&) = delete;
+  FaceGhostTimeCluster& operator=(const FaceGhostTimeCluster&) = delete;
+
+  void finalize() override;
+
+private:
+  void packCopyRegion(unsigned int region);
+  void unpackGhostRegion(unsigned int region);
+
+  const initializer::HaloFaceLayout* haloFaceLayout;
+  bool persistent;
+
+  std::vector<real*> packedCopyRegions;
+  std::vector<real*> packedGhostRegions;
+
+  std::array<unsigned, CONVERGENCE_ORDER> derivativesOffsets{};
+  std::array<unsigned, CONVERGENCE_ORDER> faceDerivativesOffsets{};
+
+  kernel::projectBufferToFace projectBufferKrnlPrototype;
+  kernel::liftBufferFromFace liftBufferKrnlPrototype;
+  kernel::projectDerivativesToFace projectDerivativesKrnlPrototype;
+  kernel::liftDerivativesFromFace liftDerivativesKrnlPrototype;
+};
+} // namespace seissol::time_stepping
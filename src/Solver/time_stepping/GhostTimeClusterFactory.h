@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Solver/time_stepping/DirectGhostTimeCluster.h"
+#include "Solver/time_stepping/FaceGhostTimeCluster.h"
 #ifdef ACL_DEVICE
 #include "Solver/time_stepping/GhostTimeClusterWithCopy.h"
 #endif // ACL_DEVICE
@@ -16,7 +17,9 @@ struct GhostTimeClusterFactory {
                                                        int otherGlobalTimeClusterId,
                                                        const MeshStructure* meshStructure,
                                                        MPI::DataTransferMode mode,
-                                                       bool persistent) {
+                                                       bool persistent,
+                                                       const initializer::HaloFaceLayout* haloFaceLayout = nullptr,
+                                                       HaloCodecType haloCodec = HaloCodecType::None) {
     switch (mode) {
 #ifdef ACL_DEVICE
     case MPI::DataTransferMode::CopyInCopyOutHost: {
@@ -30,12 +33,27 @@ struct GhostTimeClusterFactory {
     }
 #endif // ACL_DEVICE
     case MPI::DataTransferMode::Direct: {
-      return std::make_unique<DirectGhostTimeCluster>(maxTimeStepSize,
-                                                      timeStepRate,
-                                                      globalTimeClusterId,
-                                                      otherGlobalTimeClusterId,
-                                                      meshStructure,
-                                                      persistent);
+      // the size of an encoded region varies, hence persistent requests cannot be used with a codec
+      const bool persistentDirect = persistent && haloCodec == HaloCodecType::None;
+      std::unique_ptr<AbstractGhostTimeCluster> ghostCluster;
+      if (haloFaceLayout != nullptr) {
+        ghostCluster = std::make_unique<FaceGhostTimeCluster>(maxTimeStepSize,
+                                                              timeStepRate,
+                                                              globalTimeClusterId,
+                                                              otherGlobalTimeClusterId,
+                                                              meshStructure,
+                                                              haloFaceLayout,
+                                                              persistentDirect);
+      } else {
+        ghostCluster = std::make_unique<DirectGhostTimeCluster>(maxTimeStepSize,
+                                                                timeStepRate,
+                                                                globalTimeClusterId,
+                                                                otherGlobalTimeClusterId,
+                                                                meshStructure,
+                                                                persistentDirect);
+      }
+      ghostCluster->setHaloCodec(haloCodec);
+      return ghostCluster;
     }
     default: {
       return nullptr;
@@ -0,0 +1,348 @@
+#include "Solver/time_stepping/HaloCodec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <utils/logger.h>
+#include <utils/stringutils.h>
+
+namespace seissol::time_stepping {
+
+namespace {
+//! header of a losslessly encoded region: compression mode and size of the payload
+struct LosslessHeader {
+  std::uint64_t compressed;
+  std::uint64_t payloadSize;
+};
+
+//! scratch memory for the shuffled data
+std::vector<char>& shuffleBuffer(std::size_t size) {
+  thread_local std::vector<char> buffer;
+  if (buffer.size() < size) {
+    buffer.resize(size);
+  }
+  return buffer;
+}
+} // namespace
+
+std::atomic<unsigned long long> HaloCodec::rawBytes{0};
+std::atomic<unsigned long long> HaloCodec::encodedBytes{0};
+
+HaloCodecType haloCodecTypeFromString(const std::string& name) {
+  auto lowerName = name;
+  utils::StringUtils::toLower(lowerName);
+  if (lowerName == "float") {
+    return HaloCodecType::Float;
+  }
+  if (lowerName == "lossless") {
+    return HaloCodecType::Lossless;
+  }
+  if (lowerName != "none") {
+    logWarning() << "Unknown halo codec" << name << "; sending the copy layers uncompressed.";
+  }
+  return HaloCodecType::None;
+}
+
+std::string haloCodecTypeToString(HaloCodecType type) {
+  switch (type) {
+  case HaloCodecType::Float:
+    return "float";
+  case HaloCodecType::Lossless:
+    return "lossless";
+  default:
+    return "none";
+  }
+}
+
+std::size_t HaloCodec::maxEncodedSize(std::size_t count) const {
+  switch (type) {
+  case HaloCodecType::Float:
+    return count * sizeof(float);
+  case HaloCodecType::Lossless:
+    return sizeof(LosslessHeader) + count * sizeof(real);
+  default:
+    return count * sizeof(real);
+  }
+}
+
+std::size_t HaloCodec::encode(const real* data, std::size_t count, char* encoded) const {
+  std::size_t size = 0;
+  switch (type) {
+  case HaloCodecType::Float: {
+    auto* floats = reinterpret_cast<float*>(encoded);
+    for (std::size_t i = 0; i < count; ++i) {
+      floats[i] = static_cast<float>(data[i]);
+    }
+    size = count * sizeof(float);
+    break;
+  }
+  case HaloCodecType::Lossless: {
+    const std::size_t rawSize = count * sizeof(real);
+    auto& shuffled = shuffleBuffer(rawSize);
+    halo_codec::shuffle(reinterpret_cast<const char*>(data), count, sizeof(real), shuffled.data());
+
+    LosslessHeader header{1, 0};
+    header.payloadSize = halo_codec::compress(
+        shuffled.data(), rawSize, encoded + sizeof(LosslessHeader), rawSize);
+    if (header.payloadSize == 0) {
+      // incompressible data is stored as it is
+      header.compressed = 0;
+      header.payloadSize = rawSize;
+      std::memcpy(encoded + sizeof(LosslessHeader), data, rawSize);
+    }
+    std::memcpy(encoded, &header, sizeof(LosslessHeader));
+    size = sizeof(LosslessHeader) + header.payloadSize;
+    break;
+  }
+  default: {
+    size = count * sizeof(real);
+    std::memcpy(encoded, data, size);
+    break;
+  }
+  }
+
+  rawBytes += count * sizeof(real);
+  encodedBytes += size;
+  return size;
+}
+
+void HaloCodec::decode(const char* encoded, std::size_t count, real* data) const {
+  switch (type) {
+  case HaloCodecType::Float: {
+    const auto* floats = reinterpret_cast<const float*>(encoded);
+    for (std::size_t i = 0; i < count; ++i) {
+      data[i] = static_cast<real>(floats[i]);
+    }
+    break;
+  }
+  case HaloCodecType::Lossless: {
+    const std::size_t rawSize = count * sizeof(real);
+    LosslessHeader header{};
+    std::memcpy(&header, encoded, sizeof(LosslessHeader));
+    if (header.compressed == 0) {
+      std::memcpy(data, encoded + sizeof(LosslessHeader), rawSize);
+    } else {
+      auto& shuffled = shuffleBuffer(rawSize);
+      if (!halo_codec::decompress(
+              encoded + sizeof(LosslessHeader), header.payloadSize, shuffled.data(), rawSize)) {
+        logError() << "Received a corrupt compressed ghost region.";
+      }
+      halo_codec::unshuffle(shuffled.data(), count, sizeof(real), reinterpret_cast<char*>(data));
+    }
+    break;
+  }
+  default: {
+    std::memcpy(data, encoded, count * sizeof(real));
+    break;
+  }
+  }
+}
+
+void HaloCodec::printStatistics(MPI_Comm comm) {
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  std::array<unsigned long long, 2> bytes{rawBytes.load(), encodedBytes.load()};
+  std::array<unsigned long long, 2> totalBytes{};
+  MPI_Reduce(bytes.data(), totalBytes.data(), 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, 0, comm);
+  if (totalBytes[1] > 0) {
+    logInfo(rank) << "Halo codec: encoded" << totalBytes[0] << "bytes of copy layer data to"
+                  << totalBytes[1] << "bytes; compression ratio"
+                  << static_cast<double>(totalBytes[0]) / static_cast<double>(totalBytes[1]);
+  }
+}
+
+namespace halo_codec {
+
+void shuffle(const char* in, std::size_t count, std::size_t elementSize, char* out) {
+  for (std::size_t i = 0; i < count; ++i) {
+    for (std::size_t b = 0; b < elementSize; ++b) {
+      out[b * count + i] = in[i * elementSize + b];
+    }
+  }
+}
+
+void unshuffle(const char* in, std::size_t count, std::size_t elementSize, char* out) {
+  for (std::size_t i = 0; i < count; ++i) {
+    for (std::size_t b = 0; b < elementSize; ++b) {
+      out[i * elementSize + b] = in[b * count + i];
+    }
+  }
+}
+
+namespace {
+constexpr std::size_t MinMatch = 4;
+constexpr std::size_t MaxOffset = 65535;
+constexpr unsigned HashLog = 14;
+
+std::uint32_t read32(const unsigned char* p) {
+  std::uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+std::uint32_t hash(std::uint32_t sequence) { return (sequence * 2654435761U) >> (32 - HashLog); }
+
+class Writer {
+  public:
+  Writer(unsigned char* out, std::size_t capacity) : out(out), capacity(capacity) {}
+
+  bool put(unsigned char byte) {
+    if (position >= capacity) {
+      return false;
+    }
+    out[position++] = byte;
+    return true;
+  }
+
+  bool put(const unsigned char* bytes, std::size_t count) {
+    if (position + count > capacity) {
+      return false;
+    }
+    std::memcpy(out + position, bytes, count);
+    position += count;
+    return true;
+  }
+
+  //! the part of a length which does not fit into the 4 bits of the token
+  bool putLength(std::size_t length) {
+    for (; length >= 255; length -= 255) {
+      if (!put(255)) {
+        return false;
+      }
+    }
+    return put(static_cast<unsigned char>(length));
+  }
+
+  bool putSequence(const unsigned char* literals,
+                   std::size_t literalLength,
+                   std::size_t offset,
+                   std::size_t matchLength) {
+    const bool hasMatch = matchLength >= MinMatch;
+    const std::size_t literalToken = std::min<std::size_t>(literalLength, 15);
+    const std::size_t matchToken = hasMatch ? std::min<std::size_t>(matchLength - MinMatch, 15) : 0;
+    bool ok = put(static_cast<unsigned char>((literalToken << 4) | matchToken));
+    if (literalToken == 15) {
+      ok = ok && putLength(literalLength - 15);
+    }
+    ok = ok && put(literals, literalLength);
+    if (hasMatch) {
+      ok = ok && put(static_cast<unsigned char>(offset & 0xff)) &&
+           put(static_cast<unsigned char>(offset >> 8));
+      if (matchToken == 15) {
+        ok = ok && putLength(matchLength - MinMatch - 15);
+      }
+    }
+    return ok;
+  }
+
+  std::size_t size() const { return position; }
+
+  private:
+  unsigned char* out;
+  std::size_t capacity;
+  std::size_t position{0};
+};
+
+bool readLength(const unsigned char* in, std::size_t size, std::size_t& position, std::size_t& length) {
+  unsigned char byte = 255;
+  while (byte == 255) {
+    if (position >= size) {
+      return false;
+    }
+    byte = in[position++];
+    length += byte;
+  }
+  return true;
+}
+} // namespace
+
+std::size_t compress(const char* inChars, std::size_t size, char* outChars, std::size_t capacity) {
+  const auto* in = reinterpret_cast<const unsigned char*>(inChars);
+  Writer writer(reinterpret_cast<unsigned char*>(outChars), capacity);
+
+  thread_local std::vector<std::size_t> table;
+  table.assign(std::size_t(1) << HashLog, size);
+
+  std::size_t anchor = 0;
+  std::size_t position = 0;
+  while (position + MinMatch <= size) {
+    const auto sequence = read32(in + position);
+    const auto h = hash(sequence);
+    const auto candidate = table[h];
+    table[h] = position;
+
+    if (candidate < position && position - candidate <= MaxOffset &&
+        read32(in + candidate) == sequence) {
+      std::size_t matchLength = MinMatch;
+      while (position + matchLength < size && in[candidate + matchLength] == in[position + matchLength]) {
+        ++matchLength;
+      }
+      if (!writer.putSequence(in + anchor, position - anchor, position - candidate, matchLength)) {
+        return 0;
+      }
+      position += matchLength;
+      anchor = position;
+    } else {
+      ++position;
+    }
+  }
+
+  // the last sequence consists of literals only
+  if (!writer.putSequence(in + anchor, size - anchor, 0, 0)) {
+    return 0;
+  }
+  return writer.size();
+}
+
+bool decompress(const char* inChars, std::size_t compressedSize, char* outChars, std::size_t size) {
+  const auto* in = reinterpret_cast<const unsigned char*>(inChars);
+  auto* out = reinterpret_cast<unsigned char*>(outChars);
+
+  std::size_t inPosition = 0;
+  std::size_t outPosition = 0;
+  while (inPosition < compressedSize) {
+    const unsigned char token = in[inPosition++];
+
+    std::size_t literalLength = token >> 4;
+    if (literalLength == 15 && !readLength(in, compressedSize, inPosition, literalLength)) {
+      return false;
+    }
+    if (inPosition + literalLength > compressedSize || outPosition + literalLength > size) {
+      return false;
+    }
+    std::memcpy(out + outPosition, in + inPosition, literalLength);
+    inPosition += literalLength;
+    outPosition += literalLength;
+
+    if (inPosition == compressedSize) {
+      // last sequence
+      break;
+    }
+
+    if (inPosition + 2 > compressedSize) {
+      return false;
+    }
+    const std::size_t offset = in[inPosition] | (static_cast<std::size_t>(in[inPosition + 1]) << 8);
+    inPosition += 2;
+    std::size_t matchLength = token & 0xf;
+    if (matchLength == 15 && !readLength(in, compressedSize, inPosition, matchLength)) {
+      return false;
+    }
+    matchLength += MinMatch;
+    if (offset == 0 || offset > outPosition || outPosition + matchLength > size) {
+      return false;
+    }
+    // the match may overlap with the output, hence copy byte-wise
+    for (std::size_t i = 0; i < matchLength; ++i, ++outPosition) {
+      out[outPosition] = out[outPosition - offset];
+    }
+  }
+  return outPosition == size;
+}
+
+} // namespace halo_codec
+
+} // namespace seissol::time_stepping
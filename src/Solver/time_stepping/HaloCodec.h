@@ -0,0 +1,91 @@
+#ifndef SEISSOL_SOLVER_TIME_STEPPING_HALOCODEC_H_
+#define SEISSOL_SOLVER_TIME_STEPPING_HALOCODEC_H_
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+#include <mpi.h>
+
+#include "Kernels/precision.hpp"
+
+namespace seissol::time_stepping {
+
+enum class HaloCodecType {
+  //! the copy regions are sent as they are
+  None,
+  //! double precision data is sent as single precision
+  Float,
+  //! byte-shuffle followed by a lossless LZ-style compression
+  Lossless
+};
+
+HaloCodecType haloCodecTypeFromString(const std::string& name);
+std::string haloCodecTypeToString(HaloCodecType type);
+
+/**
+ * Encodes the copy regions before they are sent and decodes the received ghost regions.
+ * All functions are thread-safe.
+ */
+class HaloCodec {
+  public:
+  explicit HaloCodec(HaloCodecType type) : type(type) {}
+
+  HaloCodecType getType() const { return type; }
+
+  /**
+   * Upper bound of the encoded size (in bytes) of count reals.
+   */
+  std::size_t maxEncodedSize(std::size_t count) const;
+
+  /**
+   * Encodes count reals from data to encoded, which needs to hold maxEncodedSize(count) bytes.
+   *
+   * @return number of bytes written to encoded.
+   */
+  std::size_t encode(const real* data, std::size_t count, char* encoded) const;
+
+  /**
+   * Decodes count reals from encoded (as written by encode) to data.
+   */
+  void decode(const char* encoded, std::size_t count, real* data) const;
+
+  /**
+   * Prints the compression ratio achieved by all codecs of all ranks.
+   */
+  static void printStatistics(MPI_Comm comm);
+
+  private:
+  HaloCodecType type;
+
+  static std::atomic<unsigned long long> rawBytes;
+  static std::atomic<unsigned long long> encodedBytes;
+};
+
+namespace halo_codec {
+/**
+ * Groups the i-th bytes of all elements, i.e. the output consists of elementSize planes of count
+ * bytes each. Neighboring values in the copy layers mostly share their sign and exponent bytes,
+ * which results in long runs after the shuffle.
+ */
+void shuffle(const char* in, std::size_t count, std::size_t elementSize, char* out);
+void unshuffle(const char* in, std::size_t count, std::size_t elementSize, char* out);
+
+/**
+ * LZ77-style compression with a block format similar to LZ4.
+ *
+ * @return number of bytes written to out, or 0 if the result does not fit into capacity bytes.
+ */
+std::size_t compress(const char* in, std::size_t size, char* out, std::size_t capacity);
+
+/**
+ * Decompresses compressedSize bytes from in to out, which needs to hold size bytes.
+ *
+ * @return false if the data is corrupt.
+ */
+bool decompress(const char* in, std::size_t compressedSize, char* out, std::size_t size);
+} // namespace halo_codec
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_SOLVER_TIME_STEPPING_HALOCODEC_H_
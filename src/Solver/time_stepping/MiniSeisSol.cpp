@@ -43,6 +43,9 @@
 #include "Kernels/Time.h"
 #include "Kernels/Local.h"
 #include "Kernels/Touch.h"
+#ifdef USE_COMPACT_INTEGRATION_DATA
+#include "Initializer/tree/LTSSync.hpp"
+#endif
 #include "Monitoring/Stopwatch.h"
 #include "utils/env.h"
 #include "SeisSol.h"
@@ -203,6 +206,28 @@ void seissol::fakeData(initializer::LTS& lts,
   kernels::fillWithStuff(reinterpret_cast<real*>(localIntegration), sizeof(LocalIntegrationData)/sizeof(real) * layer.getNumberOfCells(), false);
   kernels::fillWithStuff(reinterpret_cast<real*>(neighboringIntegration), sizeof(NeighboringIntegrationData)/sizeof(real) * layer.getNumberOfCells(), false);
 
+#ifdef USE_COMPACT_INTEGRATION_DATA
+  // the star matrices and flux solvers are computed from the material and the face frames,
+  // which thus need to be physically meaningful
+  CellMaterialData* material = layer.var(lts.material);
+  double materialValues[] = {2700.0, 3.2e10, 3.2e10};
+  const seissol::model::ElasticMaterial elasticMaterial(materialValues, 3);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    initializer::initAssign(material[cell].local, elasticMaterial);
+    for (unsigned side = 0; side < 4; ++side) {
+      initializer::initAssign(material[cell].neighbor[side], elasticMaterial);
+      for (unsigned i = 0; i < 3; ++i) {
+        for (unsigned j = 0; j < 3; ++j) {
+          localIntegration[cell].faceFrames[side][i][j] = (i == j) ? 1.0 : 0.0;
+        }
+      }
+    }
+  }
+#endif
+
 #ifdef USE_POROELASTIC
 #ifdef _OPENMP
   #pragma omp parallel for schedule(static)
@@ -83,9 +83,12 @@
 #include "Kernels/Receiver.h"
 #include "Monitoring/FlopCounter.hpp"
 #include "Monitoring/instrumentation.hpp"
+#include "Parallel/TaskLoop.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <mutex>
 
 #include "generated_code/kernel.h"
 
@@ -146,6 +149,9 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
   m_localKernel.setGlobalData(i_globalData);
   m_localKernel.setInitConds(&seissolInstance.getMemoryManager().getInitialConditions());
   m_localKernel.setGravitationalAcceleration(seissolInstance.getGravitationSetup().acceleration);
+  m_localKernel.setAnalyticalBoundaryExpansion(
+      seissolInstance.getSeisSolParameters().initialization.analyticalBoundaryRefreshInterval,
+      seissolInstance.getSeisSolParameters().timeStepping.endTime);
   m_neighborKernel.setGlobalData(i_globalData);
   m_dynamicRuptureKernel.setGlobalData(i_globalData);
 
@@ -222,10 +228,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   {
   LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
   }
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
-#endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+  parallel::forEach(layerData.getNumberOfCells(), [&](unsigned face) {
     unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
     m_dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
                                                   m_globalDataOnHost,
@@ -237,7 +240,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
                                                   qInterpolatedMinus[face],
                                                   timeDerivativePlus[prefetchFace],
                                                   timeDerivativeMinus[prefetchFace]);
-  }
+  });
   SCOREP_USER_REGION_END(myRegionHandle)
 #pragma omp parallel 
   {
@@ -334,24 +337,26 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
 
   m_loopStatistics->begin(m_regionComputeLocalIntegration);
 
-  // local integration buffer
-  real l_integrationBuffer[tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
-
-  // pointer for the call of the ADER-function
-  real* l_bufferPointer;
-
   real** buffers = i_layerData.var(m_lts->buffers);
   real** derivatives = i_layerData.var(m_lts->derivatives);
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+  float** compressedBuffers = i_layerData.var(m_lts->compressedBuffers);
+#endif
   CellMaterialData* materialData = i_layerData.var(m_lts->material);
+  CellBoundaryMapping (*boundaryMapping)[4] = i_layerData.var(m_lts->boundaryMapping);
 
   kernels::LocalData::Loader loader;
   loader.load(*m_lts, i_layerData);
-  kernels::LocalTmp tmp(seissolInstance.getGravitationSetup().acceleration);
+  const auto gravitationalAcceleration = seissolInstance.getGravitationSetup().acceleration;
 
-#ifdef _OPENMP
-  #pragma omp parallel for private(l_bufferPointer, l_integrationBuffer), firstprivate(tmp) schedule(static)
-#endif
-  for (unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++) {
+  parallel::forEach(i_layerData.getNumberOfCells(), [&](unsigned int l_cell) {
+    // local integration buffer
+    alignas(ALIGNMENT) real l_integrationBuffer[tensor::I::size()];
+
+    // pointer for the call of the ADER-function
+    real* l_bufferPointer;
+
+    kernels::LocalTmp tmp(gravitationalAcceleration);
     auto data = loader.entry(l_cell);
 
     // We need to check, whether we can overwrite the buffer or if it is
@@ -360,8 +365,15 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
     // local buffer and accumulate the results later in the shared buffer.
     const bool buffersProvided = (data.cellInformation().ltsSetup >> 8) % 2 == 1; // buffers are provided
     const bool resetMyBuffers = buffersProvided && ( (data.cellInformation().ltsSetup >> 10) %2 == 0 || resetBuffers ); // they should be reset
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    // Single precision buffers are computed in the local buffer and stored at the end
+    float* compressedBuffer = compressedBuffers[l_cell];
+    const bool useSharedBuffer = resetMyBuffers && compressedBuffer == nullptr;
+#else
+    const bool useSharedBuffer = resetMyBuffers;
+#endif
 
-    if (resetMyBuffers) {
+    if (useSharedBuffer) {
       // assert presence of the buffer
       assert(buffers[l_cell] != nullptr);
 
@@ -379,7 +391,6 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
                              true);
 
     // Compute local integrals (including some boundary conditions)
-    CellBoundaryMapping (*boundaryMapping)[4] = i_layerData.var(m_lts->boundaryMapping);
     m_localKernel.computeIntegral(l_bufferPointer,
                                   data,
                                   tmp,
@@ -407,14 +418,25 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
     // TODO: Integrate this step into the kernel
     // We've used a temporary buffer -> need to accumulate update in
     // shared buffer.
-    if (!resetMyBuffers && buffersProvided) {
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+    if (compressedBuffer != nullptr) {
+      if (resetMyBuffers) {
+        std::copy_n(l_integrationBuffer, tensor::I::size(), compressedBuffer);
+      } else {
+        for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
+          compressedBuffer[l_dof] = static_cast<float>(compressedBuffer[l_dof] + l_integrationBuffer[l_dof]);
+        }
+      }
+    } else
+#endif
+    if (!useSharedBuffer && buffersProvided) {
       assert(buffers[l_cell] != nullptr);
 
       for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
         buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
       }
     }
-  }
+  });
 
   m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_profilingId);
 }
@@ -699,9 +721,15 @@ void seissol::time_stepping::TimeCluster::computeFlops() {
           m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)],
           m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)]
           );
+  seissol::kernels::Plasticity::flopsElasticCheck(
+          m_flops_nonZero[static_cast<int>(ComputePart::PlasticityElasticCheck)],
+          m_flops_hardware[static_cast<int>(ComputePart::PlasticityElasticCheck)]
+          );
 }
 
 namespace seissol::time_stepping {
+std::mutex TimeCluster::dynamicRuptureMutex;
+
 ActResult TimeCluster::act() {
   actorStateStatistics->enter(state);
   const auto result = AbstractTimeCluster::act();
@@ -767,6 +795,9 @@ void TimeCluster::correct() {
   // Otherwise, this is an interior layer actor, and we need only the FL_Int.
   // We need to avoid computing it twice.
   if (dynamicRuptureScheduler->hasDynamicRuptureFaces()) {
+    // The friction solver is shared by all clusters. Hence, with the tasked executor,
+    // only one cluster at a time may work on the fault.
+    std::lock_guard dynamicRuptureLock(dynamicRuptureMutex);
     if (dynamicRuptureScheduler->mayComputeInterior(ct.stepsSinceStart)) {
       computeDynamicRupture(*dynRupInteriorData);
       seissolInstance.flopCounter().incrementNonZeroFlopsDynamicRupture(m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
@@ -790,11 +821,13 @@ void TimeCluster::correct() {
 
   // First cluster calls fault receiver output
   // Call fault output only if both interior and copy parts of DR were computed
-  // TODO: Change from iteration based to time based
-  if (dynamicRuptureScheduler->isFirstClusterWithDynamicRuptureFaces()
-      && dynamicRuptureScheduler->mayComputeFaultOutput(ct.stepsSinceStart)) {
-    faultOutputManager->writePickpointOutput(ct.correctionTime + timeStepSize(), timeStepSize());
-    dynamicRuptureScheduler->setLastFaultOutput(ct.stepsSinceStart);
+  // The output manager samples either every n-th call or in simulated time (printtimeinterval_sec)
+  if (dynamicRuptureScheduler->isFirstClusterWithDynamicRuptureFaces()) {
+    std::lock_guard dynamicRuptureLock(dynamicRuptureMutex);
+    if (dynamicRuptureScheduler->mayComputeFaultOutput(ct.stepsSinceStart)) {
+      faultOutputManager->writePickpointOutput(ct.correctionTime + timeStepSize(), timeStepSize());
+      dynamicRuptureScheduler->setLastFaultOutput(ct.stepsSinceStart);
+    }
   }
 
   // TODO(Lukas) Adjust with time step rate? Relevant is maximum cluster is not on this node
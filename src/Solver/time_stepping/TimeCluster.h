@@ -95,9 +95,14 @@
 #include "Initializer/DynamicRupture.h"
 #include "DynamicRupture/FrictionLaws/FrictionSolver.h"
 #include "DynamicRupture/Output/OutputManager.hpp"
+#include "Parallel/TaskLoop.hpp"
 
 #include "AbstractTimeCluster.h"
 
+#include <mutex>
+#include <numeric>
+#include <vector>
+
 #ifdef ACL_DEVICE
 #include <device.h>
 #include "Solver/Pipeline/DrPipeline.h"
@@ -144,6 +149,12 @@ private:
 
     //! neighbor kernel
     kernels::Neighbor m_neighborKernel;
+
+    //! Grouping of the faces for the neighbor integration on the host
+    kernels::NeighborGroups m_neighborGroups;
+
+    //! Number of cells per block of the neighbor groups which took the nodal plasticity check
+    std::vector<unsigned> m_plasticityCandidates;
     
     kernels::DynamicRupture m_dynamicRuptureKernel;
 
@@ -171,12 +182,16 @@ private:
 
     std::unique_ptr<kernels::PointSourceCluster> m_sourceCluster;
 
+    //! guards the friction solver and the fault output, which are shared by all clusters
+    static std::mutex dynamicRuptureMutex;
+
     enum class ComputePart {
       Local = 0,
       Neighbor,
       DRNeighbor,
       DRFrictionLawInterior,
       DRFrictionLawCopy,
+      PlasticityElasticCheck,
       PlasticityCheck,
       PlasticityYield,
       NUM_COMPUTE_PARTS
@@ -265,79 +280,99 @@ private:
       CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
       PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
       auto* pstrain = i_layerData.var(m_lts->pstrain);
-      unsigned numberOTetsWithPlasticYielding = 0;
+#ifdef USE_SINGLE_PRECISION_BUFFERS
+      float* (*compressedFaceNeighbors)[4] = i_layerData.var(m_lts->compressedFaceNeighbors);
+#else
+      float* (*compressedFaceNeighbors)[4] = nullptr;
+#endif
 
       kernels::NeighborData::Loader loader;
       loader.load(*m_lts, i_layerData);
 
-      real *l_timeIntegrated[4];
-      real *l_faceNeighbors_prefetch[4];
+      if (!m_neighborGroups.isBuilt()) {
+        m_neighborGroups.build(cellInformation, drMapping, i_layerData.getNumberOfCells(), parallel::numberOfLoopThreads());
+        m_plasticityCandidates.assign(m_neighborGroups.numberOfBlocks(), 0);
+      }
+      real* (*timeIntegrated)[4] = m_neighborGroups.timeIntegrated();
+
+      if constexpr (usePlasticity) {
+        updateRelaxTime();
+      }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping, subTimeStart) reduction(+:numberOTetsWithPlasticYielding)
-#endif
-      for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
-        auto data = loader.entry(l_cell);
-        seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
-                                                       data.cellInformation().ltsSetup,
-                                                       data.cellInformation().faceTypes,
-                                                       subTimeStart,
-                                                       timeStepSize(),
-                                                       faceNeighbors[l_cell],
-#ifdef _OPENMP
-                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
-#else
-            *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalData->integrationBufferLTS),
-#endif
-                                                       l_timeIntegrated);
-
-        l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][1] :
-                                      drMapping[l_cell][1].godunov;
-        l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][2] :
-                                      drMapping[l_cell][2].godunov;
-        l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][3] :
-                                      drMapping[l_cell][3].godunov;
-
-        // fourth face's prefetches
-        if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
-          l_faceNeighbors_prefetch[3] = (cellInformation[l_cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
-                                        faceNeighbors[l_cell+1][0] :
-                                        drMapping[l_cell+1][0].godunov;
-        } else {
-          l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
+      // Blocks of cells are processed by one thread; the faces of a block are grouped by face relation
+      const auto numberOTetsWithPlasticYielding = parallel::forEachSum(m_neighborGroups.numberOfBlocks(), [&](unsigned int block) {
+        const unsigned blockBegin = m_neighborGroups.blockBegin(block);
+        const unsigned blockEnd = m_neighborGroups.blockEnd(block);
+
+        for (unsigned l_cell = blockBegin; l_cell < blockEnd; ++l_cell) {
+          // Cells without neighbors providing derivatives do not use the buffer
+          real (*integrationBuffer)[tensor::I::size()] = m_neighborGroups.integrationBuffer(l_cell);
+          if (integrationBuffer == nullptr) {
+            integrationBuffer = reinterpret_cast<real (*)[tensor::I::size()]>(m_globalDataOnHost->integrationBufferLTS);
+          }
+          seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
+                                                         cellInformation[l_cell].ltsSetup,
+                                                         cellInformation[l_cell].faceTypes,
+                                                         subTimeStart,
+                                                         timeStepSize(),
+                                                         faceNeighbors[l_cell],
+                                                         integrationBuffer,
+                                                         timeIntegrated[l_cell]);
         }
 
-        m_neighborKernel.computeNeighborsIntegral( data,
-                                                   drMapping[l_cell],
-                                                   l_timeIntegrated, l_faceNeighbors_prefetch
-        );
+        m_neighborKernel.computeGroupedNeighborsIntegral( loader,
+                                                          m_neighborGroups,
+                                                          block,
+                                                          drMapping,
+                                                          timeIntegrated,
+                                                          compressedFaceNeighbors );
 
+        unsigned yielded = 0;
         if constexpr (usePlasticity) {
-          updateRelaxTime();
-          numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
-                                                                                             timeStepSize(),
-                                                                                             m_tv,
-                                                                                             m_globalDataOnHost,
-                                                                                             &plasticity[l_cell],
-                                                                                             data.dofs(),
-                                                                                             pstrain[l_cell] );
+          // Only the cells which may yield take the nodal path; they are corrected as a batch
+          unsigned candidates[kernels::NeighborGroups::MaxBlockSize];
+          unsigned numberOfCandidates = 0;
+          for (unsigned l_cell = blockBegin; l_cell < blockEnd; ++l_cell) {
+            if (!seissol::kernels::Plasticity::isElastic(&plasticity[l_cell], loader.entry(l_cell).dofs())) {
+              candidates[numberOfCandidates++] = l_cell;
+            }
+          }
+          for (unsigned candidate = 0; candidate < numberOfCandidates; ++candidate) {
+            const unsigned l_cell = candidates[candidate];
+            yielded += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
+                                                                        timeStepSize(),
+                                                                        m_tv,
+                                                                        m_globalDataOnHost,
+                                                                        &plasticity[l_cell],
+                                                                        loader.entry(l_cell).dofs(),
+                                                                        pstrain[l_cell] );
+          }
+          m_plasticityCandidates[block] = numberOfCandidates;
         }
 #ifdef INTEGRATE_QUANTITIES
-        seissolInstance.postProcessor().integrateQuantities( m_timeStepWidth,
-                                                              i_layerData,
-                                                              l_cell,
-                                                              dofs[l_cell] );
+        for (unsigned l_cell = blockBegin; l_cell < blockEnd; ++l_cell) {
+          seissolInstance.postProcessor().integrateQuantities( m_timeStepWidth,
+                                                                i_layerData,
+                                                                l_cell,
+                                                                dofs[l_cell] );
+        }
 #endif // INTEGRATE_QUANTITIES
+        return yielded;
+      });
+
+      long long numberOfTetsCheckedForYielding = 0;
+      if constexpr (usePlasticity) {
+        numberOfTetsCheckedForYielding = std::accumulate(m_plasticityCandidates.begin(), m_plasticityCandidates.end(), 0LL);
       }
+      const long long numberOfTetsWithPlasticity = usePlasticity ? i_layerData.getNumberOfCells() : 0;
 
       const long long nonZeroFlopsPlasticity =
-          i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
+          numberOfTetsWithPlasticity * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityElasticCheck)] +
+          numberOfTetsCheckedForYielding * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
           numberOTetsWithPlasticYielding * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
       const long long hardwareFlopsPlasticity =
-          i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
+          numberOfTetsWithPlasticity * m_flops_hardware[static_cast<int>(ComputePart::PlasticityElasticCheck)] +
+          numberOfTetsCheckedForYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
           numberOTetsWithPlasticYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
 
       m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_profilingId);
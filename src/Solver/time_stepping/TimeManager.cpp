@@ -45,14 +45,23 @@
 #include "CommunicationManager.h"
 #include "Initializer/preProcessorMacros.hpp"
 #include "Initializer/time_stepping/common.hpp"
+#include "Initializer/time_stepping/LtsWeights/CostModel.h"
 #include "SeisSol.h"
 #include "ResultWriter/ClusteringWriter.h"
 #include "Parallel/Helper.hpp"
 
+#include <atomic>
+
 seissol::time_stepping::TimeManager::TimeManager(seissol::SeisSol& seissolInstance):
   m_logUpdates(std::numeric_limits<unsigned int>::max()), seissolInstance(seissolInstance),
    actorStateStatisticsManager(m_loopStatistics)
 {
+#ifdef ACL_DEVICE
+  taskedExecution = false;
+#else
+  taskedExecution = useTaskedExecution();
+#endif
+
   m_loopStatistics.addRegion("computeLocalIntegration");
   m_loopStatistics.addRegion("computeNeighboringIntegration");
   m_loopStatistics.addRegion("computeDynamicRupture");
@@ -178,6 +187,7 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
     // Create ghost time clusters for MPI
     const auto preferredDataTransferMode = MPI::mpi.getPreferredDataTransferMode();
     const auto persistent = usePersistentMpi();
+    const auto haloCodec = haloCodecType();
     const int globalClusterId = static_cast<int>(m_timeStepping.clusterIds[localClusterId]);
     for (unsigned int otherGlobalClusterId = 0; otherGlobalClusterId < m_timeStepping.numberOfGlobalClusters; ++otherGlobalClusterId) {
       const bool hasNeighborRegions = std::any_of(meshStructure->neighboringClusters,
@@ -201,7 +211,9 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
                                                          otherGlobalClusterId,
                                                          meshStructure,
                                                          preferredDataTransferMode,
-                                                         persistent);
+                                                         persistent,
+                                                         memoryManager.getHaloFaceLayout(localClusterId),
+                                                         haloCodec);
         ghostClusters.push_back(std::move(ghostCluster));
 
         // Connect with previous copy layer.
@@ -231,7 +243,8 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
 
   if (seissol::useCommThread(MPI::mpi)) {
     communicationManager = std::make_unique<ThreadedCommunicationManager>(std::move(ghostClusters),
-                                                                          &seissolInstance.getPinning()
+                                                                          &seissolInstance.getPinning(),
+                                                                          commThreadSpinCount()
                                                                           );
   } else {
     communicationManager = std::make_unique<SerialCommunicationManager>(std::move(ghostClusters));
@@ -259,7 +272,7 @@ seissol::dr::output::OutputManager* seissol::time_stepping::TimeManager::getFaul
   return m_faultOutputManager;
 }
 
-void seissol::time_stepping::TimeManager::advanceInTime(const double &synchronizationTime) {
+void seissol::time_stepping::TimeManager::advanceInTime(const double &synchronizationTime, bool globalBarrier) {
   SCOREP_USER_REGION( "advanceInTime", SCOREP_USER_REGION_TYPE_FUNCTION )
 
   // We should always move forward in time
@@ -274,7 +287,9 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
 
   communicationManager->reset(synchronizationTime);
 
-  seissol::MPI::mpi.barrier(seissol::MPI::mpi.comm());
+  if (globalBarrier) {
+    seissol::MPI::mpi.barrier(seissol::MPI::mpi.comm());
+  }
 #ifdef ACL_DEVICE
   device::DeviceInstance &device = device::DeviceInstance::getInstance();
   device.api->putProfilingMark("advanceInTime", device::ProfilingColors::Blue);
@@ -288,6 +303,17 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     assert(cluster->getState() == ActorState::Corrected);
   }
 
+  if (taskedExecution) {
+    advanceClustersTasked();
+  } else {
+    advanceClustersSerial();
+  }
+#ifdef ACL_DEVICE
+  device.api->popLastProfilingMark();
+#endif
+}
+
+void seissol::time_stepping::TimeManager::advanceClustersSerial() {
   bool finished = false; // Is true, once all clusters reached next sync point
   while (!finished) {
     finished = true;
@@ -332,16 +358,90 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     });
     finished &= communicationManager->checkIfFinished();
   }
-#ifdef ACL_DEVICE
-  device.api->popLastProfilingMark();
+}
+
+void seissol::time_stepping::TimeManager::advanceClustersTasked() {
+  SCOREP_USER_REGION( "advanceClustersTasked", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+  // A cluster is in flight while a task is executing one of its actions.
+  // Only the owner of a cluster (i.e. either the scheduler, or the task in flight)
+  // may touch its state and process its messages; the flag transfers the ownership.
+  std::vector<std::atomic<bool>> inFlight(clusters.size());
+  for (auto& flag : inFlight) {
+    flag.store(false, std::memory_order_relaxed);
+  }
+
+  // The message protocol between the actors serves as dependency graph: an actor
+  // may only predict/correct once its neighbors have advanced far enough. Hence, all
+  // actors with a legal action are independent and can be run concurrently.
+#ifdef _OPENMP
+#pragma omp parallel
+#pragma omp single
+#endif
+  {
+    bool finished = false;
+    while (!finished) {
+      communicationManager->progression();
+
+      bool spawned = false;
+      bool running = false;
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+        if (inFlight[i].load(std::memory_order_acquire)) {
+          running = true;
+          continue;
+        }
+        auto* cluster = clusters[i].get();
+        if (cluster->getNextLegalAction() == ActorAction::Nothing) {
+          continue;
+        }
+        inFlight[i].store(true, std::memory_order_relaxed);
+        spawned = true;
+        // Copy layers are on the critical path for the communication.
+        const int priority = cluster->getPriority() == ActorPriority::High ? 1 : 0;
+#ifdef _OPENMP
+#pragma omp task default(shared) firstprivate(cluster, i) priority(priority)
 #endif
+        {
+          cluster->act();
+          inFlight[i].store(false, std::memory_order_release);
+        }
+      }
+
+      if (!spawned && running) {
+        // Nothing to schedule right now. New actions only become legal once a running action
+        // (or a ghost cluster) sent its messages; hence, help with the running actions until they
+        // are done instead of spinning. Without running actions, we only wait for the ghost
+        // clusters and keep polling them as in the serial mode.
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+      }
+
+      finished = communicationManager->checkIfFinished();
+      for (std::size_t i = 0; i < clusters.size() && finished; ++i) {
+        finished = !inFlight[i].load(std::memory_order_acquire) && clusters[i]->synced();
+      }
+    }
+  }
 }
 
 void seissol::time_stepping::TimeManager::printComputationTime(
     const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn) {
   actorStateStatisticsManager.finish();
   m_loopStatistics.printSummary(MPI::mpi.comm());
+  HaloCodec::printStatistics(MPI::mpi.comm());
   m_loopStatistics.writeSamples(outputPrefix, isLoopStatisticsNetcdfOutputOn);
+
+  if (seissolInstance.getSeisSolParameters().output.costModelOutput) {
+    const auto costModel = initializer::time_stepping::CostModel::fromLoopStatistics(
+        m_loopStatistics, m_timeStepping.numberOfGlobalClusters, MPI::mpi.comm());
+    const auto fileName = outputPrefix + "-costModel.yaml";
+    const auto rank = MPI::mpi.rank();
+    if (rank == 0) {
+      costModel.write(fileName);
+    }
+    logInfo(rank) << "Wrote the measured costs for the LTS weights to" << fileName;
+  }
 }
 
 double seissol::time_stepping::TimeManager::getTimeTolerance() {
@@ -122,6 +122,19 @@ class seissol::time_stepping::TimeManager {
     //! dynamic rupture output
     dr::output::OutputManager* m_faultOutputManager{};
 
+    //! true if the actions of the clusters are run as concurrent tasks
+    bool taskedExecution{false};
+
+    /**
+     * Advances the clusters one action at a time, each action being a fork-join parallel loop.
+     **/
+    void advanceClustersSerial();
+
+    /**
+     * Advances the clusters by running all legal actions as concurrent tasks.
+     **/
+    void advanceClustersTasked();
+
   public:
     /**
      * Construct a new time manager.
@@ -151,8 +164,14 @@ class seissol::time_stepping::TimeManager {
 
     /**
      * Advance in time until all clusters reach the next synchronization time.
+     * No cluster steps past the synchronization time, even if it is only an output time.
+     *
+     * @param globalBarrier synchronize all ranks before the time stepping starts, i.e. after the
+     *        synchronization point at the current time. Without the barrier, ranks which finished
+     *        their synchronization point early start with the next interval, and the communication
+     *        with the other ranks is matched once they catch up.
      **/
-    void advanceInTime( const double &synchronizationTime );
+    void advanceInTime( const double &synchronizationTime, bool globalBarrier = true );
 
     /**
      * Gets the time tolerance of the time manager (1E-5 of the CFL time step width).
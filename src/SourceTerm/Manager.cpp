@@ -74,6 +74,7 @@
 
 #include "FSRMReader.h"
 #include "Manager.h"
+#include "NRFDistribution.h"
 #include "NRFReader.h"
 #include "Numerical_aux/Transformation.h"
 #include "Parallel/MPI.h"
@@ -434,38 +435,29 @@ auto seissol::sourceterm::Manager::loadSourcesFromNRF(const char* fileName,
   logInfo(rank) << "<--------------------------------------------------------->";
 
   logInfo(rank) << "Reading" << fileName;
-  NRF nrf;
-  readNRF(fileName, nrf);
-
-  auto contained = std::vector<short>(nrf.size());
-  auto meshIds = std::vector<unsigned>(nrf.size());
-
-  logInfo(rank) << "Finding meshIds for point sources...";
-  initializer::findMeshIds(nrf.centres.data(), mesh, nrf.size(), contained.data(), meshIds.data());
-
-#ifdef USE_MPI
-  logInfo(rank) << "Cleaning possible double occurring point sources for MPI...";
-  initializer::cleanDoubles(contained.data(), nrf.size());
-#endif
-
-  auto originalIndex = std::vector<unsigned>(nrf.size());
-  unsigned numSources = 0;
-  for (unsigned source = 0; source < nrf.size(); ++source) {
-    originalIndex[numSources] = source;
-    meshIds[numSources] = meshIds[source];
-    numSources += contained[source];
-  }
+  // Every rank reads a contiguous slice of the subfaults, which are then sent to the ranks
+  // containing them
+  NRF nrfSlice;
+  readNRF(fileName, nrfSlice, rank, seissol::MPI::mpi.size());
+  unsigned long numSubfaults = nrfSlice.size();
+
+  logInfo(rank) << "Distributing point sources to the ranks containing them...";
+  auto meshIds = std::vector<unsigned>();
+  NRF nrf = distributeNRF(nrfSlice, mesh, meshIds);
+  nrfSlice = NRF();
+  unsigned long numSources = nrf.size();
 
   // Checking that all sources are within the domain
-  int globalnumSources = numSources;
+  unsigned long globalNumbers[2] = {numSubfaults, numSources};
 #ifdef USE_MPI
-  MPI_Reduce(&numSources, &globalnumSources, 1, MPI_INT, MPI_SUM, 0, seissol::MPI::mpi.comm());
+  MPI_Allreduce(
+      MPI_IN_PLACE, globalNumbers, 2, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
 #endif
 
   if (rank == 0) {
-    int numSourceOutside = nrf.size() - globalnumSources;
+    const auto numSourceOutside = globalNumbers[0] - globalNumbers[1];
     if (numSourceOutside > 0) {
-      logError() << nrf.size() - globalnumSources << " point sources are outside the domain.";
+      logError() << numSourceOutside << " point sources are outside the domain.";
     }
   }
 
@@ -499,22 +491,20 @@ auto seissol::sourceterm::Manager::loadSourcesFromNRF(const char* fileName,
         std::size_t sampleSize = 0;
         for (unsigned clusterSource = 0; clusterSource < numberOfSources; ++clusterSource) {
           unsigned sourceIndex = clusterMappings[cluster].sources[clusterSource];
-          unsigned nrfIndex = originalIndex[sourceIndex];
-          sampleSize += nrf.sroffsets[nrfIndex + 1][i] - nrf.sroffsets[nrfIndex][i];
+          sampleSize += nrf.sroffsets[sourceIndex + 1][i] - nrf.sroffsets[sourceIndex][i];
         }
         sources.sample[i].reserve(sampleSize);
       }
 
       for (unsigned clusterSource = 0; clusterSource < numberOfSources; ++clusterSource) {
         unsigned sourceIndex = clusterMappings[cluster].sources[clusterSource];
-        unsigned nrfIndex = originalIndex[sourceIndex];
         transformNRFSourceToInternalSource(
-            nrf.centres[nrfIndex],
+            nrf.centres[sourceIndex],
             meshIds[sourceIndex],
             mesh,
-            nrf.subfaults[nrfIndex],
-            nrf.sroffsets[nrfIndex],
-            nrf.sroffsets[nrfIndex + 1],
+            nrf.subfaults[sourceIndex],
+            nrf.sroffsets[sourceIndex],
+            nrf.sroffsets[sourceIndex + 1],
             nrf.sliprates,
             &ltsLut->lookup(lts->material, meshIds[sourceIndex]).local,
             sources,
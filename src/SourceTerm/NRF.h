@@ -76,7 +76,7 @@ struct NRF {
   std::vector<Subfault> subfaults;
   std::vector<Offsets> sroffsets;
   std::array<std::vector<double>, 3u> sliprates;
-  inline std::size_t size() { return centres.size(); }
+  inline std::size_t size() const { return centres.size(); }
 };
 } // namespace seissol::sourceterm
 
@@ -0,0 +1,235 @@
+#include "NRFDistribution.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "Initializer/PointMapper.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::sourceterm {
+
+namespace {
+constexpr auto NotContained = std::numeric_limits<unsigned>::max();
+
+#ifdef USE_MPI
+/**
+ * Sends send[rank] to every rank; returns the received elements ordered by the source rank and
+ * stores the number of elements received from each rank in receiveCounts.
+ */
+template <typename T>
+std::vector<T> exchange(const std::vector<std::vector<T>>& send, std::vector<int>& receiveCounts) {
+  const auto comm = seissol::MPI::mpi.comm();
+  const auto size = seissol::MPI::mpi.size();
+
+  std::vector<int> sendCounts(size);
+  std::vector<int> sendDispls(size + 1, 0);
+  for (int rank = 0; rank < size; ++rank) {
+    sendCounts[rank] = send[rank].size();
+    sendDispls[rank + 1] = sendDispls[rank] + sendCounts[rank];
+  }
+  receiveCounts.resize(size);
+  MPI_Alltoall(sendCounts.data(), 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, comm);
+  std::vector<int> receiveDispls(size + 1, 0);
+  for (int rank = 0; rank < size; ++rank) {
+    receiveDispls[rank + 1] = receiveDispls[rank] + receiveCounts[rank];
+  }
+
+  std::vector<T> sendBuffer;
+  sendBuffer.reserve(sendDispls[size]);
+  for (const auto& part : send) {
+    sendBuffer.insert(sendBuffer.end(), part.begin(), part.end());
+  }
+  std::vector<T> receiveBuffer(receiveDispls[size]);
+
+  MPI_Datatype type;
+  MPI_Type_contiguous(sizeof(T), MPI_BYTE, &type);
+  MPI_Type_commit(&type);
+  MPI_Alltoallv(sendBuffer.data(),
+                sendCounts.data(),
+                sendDispls.data(),
+                type,
+                receiveBuffer.data(),
+                receiveCounts.data(),
+                receiveDispls.data(),
+                type,
+                comm);
+  MPI_Type_free(&type);
+
+  return receiveBuffer;
+}
+
+std::vector<std::array<double, 6>> boundingBoxes(const seissol::geometry::MeshReader& mesh) {
+  std::array<double, 6> box = {std::numeric_limits<double>::max(),
+                               std::numeric_limits<double>::max(),
+                               std::numeric_limits<double>::max(),
+                               std::numeric_limits<double>::lowest(),
+                               std::numeric_limits<double>::lowest(),
+                               std::numeric_limits<double>::lowest()};
+  const auto& vertices = mesh.getVertices();
+  for (const auto& element : mesh.getElements()) {
+    for (const auto vertex : element.vertices) {
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        box[dim] = std::min(box[dim], vertices[vertex].coords[dim]);
+        box[3 + dim] = std::max(box[3 + dim], vertices[vertex].coords[dim]);
+      }
+    }
+  }
+  // Points on the boundary of the box need to be found as well
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    const double tolerance = 1e-8 * std::max(box[3 + dim] - box[dim], 1.0);
+    box[dim] -= tolerance;
+    box[3 + dim] += tolerance;
+  }
+
+  std::vector<std::array<double, 6>> boxes(seissol::MPI::mpi.size());
+  MPI_Allgather(box.data(),
+                6,
+                MPI_DOUBLE,
+                boxes.data(),
+                6,
+                MPI_DOUBLE,
+                seissol::MPI::mpi.comm());
+  return boxes;
+}
+#endif // USE_MPI
+} // namespace
+
+NRF distributeNRF(const NRF& slice,
+                  const seissol::geometry::MeshReader& mesh,
+                  std::vector<unsigned>& meshIds) {
+#ifdef USE_MPI
+  const auto size = seissol::MPI::mpi.size();
+
+  // 1. Send the centres to all candidate ranks
+  const auto boxes = boundingBoxes(mesh);
+  std::vector<std::vector<Eigen::Vector3d>> candidateCentres(size);
+  std::vector<std::vector<unsigned>> candidateSubfaults(size);
+  for (unsigned subfault = 0; subfault < slice.size(); ++subfault) {
+    const auto& centre = slice.centres[subfault];
+    for (int rank = 0; rank < size; ++rank) {
+      const auto& box = boxes[rank];
+      if (centre(0) >= box[0] && centre(1) >= box[1] && centre(2) >= box[2] &&
+          centre(0) <= box[3] && centre(1) <= box[4] && centre(2) <= box[5]) {
+        candidateCentres[rank].push_back(centre);
+        candidateSubfaults[rank].push_back(subfault);
+      }
+    }
+  }
+  std::vector<int> receivedCentresCounts;
+  const auto receivedCentres = exchange(candidateCentres, receivedCentresCounts);
+  candidateCentres = {};
+
+  // 2. Locate them in the local mesh and answer with the mesh ids
+  std::vector<short> contained(receivedCentres.size());
+  std::vector<unsigned> locatedMeshIds(receivedCentres.size());
+  initializer::findMeshIds(receivedCentres.data(),
+                           mesh,
+                           receivedCentres.size(),
+                           contained.data(),
+                           locatedMeshIds.data());
+  std::vector<std::vector<unsigned>> answers(size);
+  std::size_t received = 0;
+  for (int rank = 0; rank < size; ++rank) {
+    for (int i = 0; i < receivedCentresCounts[rank]; ++i, ++received) {
+      answers[rank].push_back(contained[received] == 1 ? locatedMeshIds[received] : NotContained);
+    }
+  }
+  std::vector<int> answerCounts;
+  const auto answered = exchange(answers, answerCounts);
+  answers = {};
+
+  // 3. The lowest rank containing a subfault owns it
+  std::vector<int> owner(slice.size(), size);
+  std::vector<unsigned> ownerMeshId(slice.size(), NotContained);
+  std::size_t answer = 0;
+  for (int rank = 0; rank < size; ++rank) {
+    for (const auto subfault : candidateSubfaults[rank]) {
+      if (answered[answer] != NotContained && rank < owner[subfault]) {
+        owner[subfault] = rank;
+        ownerMeshId[subfault] = answered[answer];
+      }
+      ++answer;
+    }
+  }
+
+  // 4. Send the subfaults with their slip rates to their owners
+  std::vector<std::vector<Eigen::Vector3d>> sendCentres(size);
+  std::vector<std::vector<Subfault>> sendSubfaults(size);
+  std::vector<std::vector<unsigned>> sendMeshIds(size);
+  std::vector<std::vector<Offsets>> sendLengths(size);
+  std::array<std::vector<std::vector<double>>, 3> sendSliprates;
+  for (auto& sliprates : sendSliprates) {
+    sliprates.resize(size);
+  }
+  for (unsigned subfault = 0; subfault < slice.size(); ++subfault) {
+    const auto rank = owner[subfault];
+    if (rank == size) {
+      continue;
+    }
+    sendCentres[rank].push_back(slice.centres[subfault]);
+    sendSubfaults[rank].push_back(slice.subfaults[subfault]);
+    sendMeshIds[rank].push_back(ownerMeshId[subfault]);
+    Offsets lengths;
+    for (unsigned i = 0; i < 3; ++i) {
+      const auto begin = slice.sroffsets[subfault][i];
+      const auto end = slice.sroffsets[subfault + 1][i];
+      lengths[i] = end - begin;
+      sendSliprates[i][rank].insert(sendSliprates[i][rank].end(),
+                                    slice.sliprates[i].begin() + begin,
+                                    slice.sliprates[i].begin() + end);
+    }
+    sendLengths[rank].push_back(lengths);
+  }
+
+  std::vector<int> counts;
+  NRF nrf;
+  nrf.centres = exchange(sendCentres, counts);
+  nrf.subfaults = exchange(sendSubfaults, counts);
+  meshIds = exchange(sendMeshIds, counts);
+  const auto lengths = exchange(sendLengths, counts);
+  for (unsigned i = 0; i < 3; ++i) {
+    nrf.sliprates[i] = exchange(sendSliprates[i], counts);
+  }
+
+  nrf.sroffsets.resize(lengths.size() + 1);
+  nrf.sroffsets[0] = {0, 0, 0};
+  for (std::size_t subfault = 0; subfault < lengths.size(); ++subfault) {
+    for (unsigned i = 0; i < 3; ++i) {
+      nrf.sroffsets[subfault + 1][i] = nrf.sroffsets[subfault][i] + lengths[subfault][i];
+    }
+  }
+  return nrf;
+#else
+  // Without MPI, the slice is the whole source
+  std::vector<short> contained(slice.size());
+  std::vector<unsigned> locatedMeshIds(slice.size());
+  initializer::findMeshIds(
+      slice.centres.data(), mesh, slice.size(), contained.data(), locatedMeshIds.data());
+
+  NRF nrf;
+  nrf.sroffsets.push_back({0, 0, 0});
+  meshIds.clear();
+  for (unsigned subfault = 0; subfault < slice.size(); ++subfault) {
+    if (contained[subfault] == 0) {
+      continue;
+    }
+    nrf.centres.push_back(slice.centres[subfault]);
+    nrf.subfaults.push_back(slice.subfaults[subfault]);
+    meshIds.push_back(locatedMeshIds[subfault]);
+    Offsets offsets = nrf.sroffsets.back();
+    for (unsigned i = 0; i < 3; ++i) {
+      const auto begin = slice.sroffsets[subfault][i];
+      const auto end = slice.sroffsets[subfault + 1][i];
+      nrf.sliprates[i].insert(nrf.sliprates[i].end(),
+                              slice.sliprates[i].begin() + begin,
+                              slice.sliprates[i].begin() + end);
+      offsets[i] += end - begin;
+    }
+    nrf.sroffsets.push_back(offsets);
+  }
+  return nrf;
+#endif // USE_MPI
+}
+
+} // namespace seissol::sourceterm
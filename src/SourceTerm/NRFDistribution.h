@@ -0,0 +1,29 @@
+#ifndef SEISSOL_SOURCETERM_NRFDISTRIBUTION_H
+#define SEISSOL_SOURCETERM_NRFDISTRIBUTION_H
+
+#include <vector>
+
+#include "Geometry/MeshReader.h"
+#include "NRF.h"
+
+namespace seissol::sourceterm {
+
+/**
+ * Sends the subfaults of a slice of an NRF source (see readNRF) to the ranks whose part of the mesh
+ * contains their centres and returns the subfaults of this rank, ordered by their index in the
+ * file. A subfault on the boundary between partitions is assigned to the lowest of these ranks;
+ * subfaults outside of the domain are dropped.
+ *
+ * Only the centres are sent to all ranks whose bounding box contains them, the subfault parameters
+ * and the slip rates are sent to the owning rank only. Hence, the memory per rank scales with the
+ * slice and the local share of the source. All ranks have to call this function.
+ *
+ * @param meshIds the mesh ids of the returned subfaults.
+ */
+NRF distributeNRF(const NRF& slice,
+                  const seissol::geometry::MeshReader& mesh,
+                  std::vector<unsigned>& meshIds);
+
+} // namespace seissol::sourceterm
+
+#endif // SEISSOL_SOURCETERM_NRFDISTRIBUTION_H
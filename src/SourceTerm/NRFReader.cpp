@@ -45,6 +45,7 @@
 #include <netcdf.h>
 
 #include <cassert>
+#include <vector>
 
 void check_err(const int stat, const int line, const char* file) {
   if (stat != NC_NOERR) {
@@ -52,29 +53,77 @@ void check_err(const int stat, const int line, const char* file) {
   }
 }
 
-void seissol::sourceterm::readNRF(const char* filename, NRF& nrf) {
+namespace {
+// Shape of the rows [begin, begin + count) of a variable, whose first dimension is the source
+// (or sample) dimension
+void sliceShape(int ncid,
+                int varid,
+                std::size_t begin,
+                std::size_t count,
+                std::vector<std::size_t>& start,
+                std::vector<std::size_t>& counts) {
+  int ndims;
+  int stat = nc_inq_varndims(ncid, varid, &ndims);
+  check_err(stat, __LINE__, __FILE__);
+  std::vector<int> dimids(ndims);
+  stat = nc_inq_vardimid(ncid, varid, dimids.data());
+  check_err(stat, __LINE__, __FILE__);
+
+  start.assign(ndims, 0);
+  counts.resize(ndims);
+  start[0] = begin;
+  counts[0] = count;
+  for (int dim = 1; dim < ndims; ++dim) {
+    stat = nc_inq_dimlen(ncid, dimids[dim], &counts[dim]);
+    check_err(stat, __LINE__, __FILE__);
+  }
+}
+
+void readSlice(int ncid, int varid, std::size_t begin, std::size_t count, void* data) {
+  if (count == 0) {
+    return;
+  }
+  std::vector<std::size_t> start;
+  std::vector<std::size_t> counts;
+  sliceShape(ncid, varid, begin, count, start, counts);
+  const int stat = nc_get_vara(ncid, varid, start.data(), counts.data(), data);
+  check_err(stat, __LINE__, __FILE__);
+}
+
+void readSliceDouble(int ncid, int varid, std::size_t begin, std::size_t count, double* data) {
+  if (count == 0) {
+    return;
+  }
+  std::vector<std::size_t> start;
+  std::vector<std::size_t> counts;
+  sliceShape(ncid, varid, begin, count, start, counts);
+  const int stat = nc_get_vara_double(ncid, varid, start.data(), counts.data(), data);
+  check_err(stat, __LINE__, __FILE__);
+}
+} // namespace
+
+void seissol::sourceterm::readNRF(const char* filename, NRF& nrf) { readNRF(filename, nrf, 0, 1); }
+
+void seissol::sourceterm::readNRF(const char* filename,
+                                  NRF& nrf,
+                                  int slice,
+                                  int numberOfSlices) {
   int ncid;
   int stat;
 
   /* dimension ids */
   int source_dim;
   int sroffset_dim;
-  int sample1_dim;
-  int sample2_dim;
-  int sample3_dim;
 
   /* dimension lengths */
   size_t source_len;
   size_t sroffset_len;
-  size_t sample_len[3];
 
   /* variable ids */
   int centres_id;
   int subfaults_id;
   int sroffsets_id;
-  int sliprates1_id;
-  int sliprates2_id;
-  int sliprates3_id;
+  int sliprates_id[3];
 
   /* open nrf */
   stat = nc_open(filename, NC_NOWRITE, &ncid);
@@ -91,21 +140,6 @@ void seissol::sourceterm::readNRF(const char* filename, NRF& nrf) {
   stat = nc_inq_dimlen(ncid, sroffset_dim, &sroffset_len);
   check_err(stat, __LINE__, __FILE__);
 
-  stat = nc_inq_dimid(ncid, "sample1", &sample1_dim);
-  check_err(stat, __LINE__, __FILE__);
-  stat = nc_inq_dimlen(ncid, sample1_dim, &sample_len[0]);
-  check_err(stat, __LINE__, __FILE__);
-
-  stat = nc_inq_dimid(ncid, "sample2", &sample2_dim);
-  check_err(stat, __LINE__, __FILE__);
-  stat = nc_inq_dimlen(ncid, sample2_dim, &sample_len[1]);
-  check_err(stat, __LINE__, __FILE__);
-
-  stat = nc_inq_dimid(ncid, "sample3", &sample3_dim);
-  check_err(stat, __LINE__, __FILE__);
-  stat = nc_inq_dimlen(ncid, sample3_dim, &sample_len[2]);
-  check_err(stat, __LINE__, __FILE__);
-
   assert(source_len + 1 == sroffset_len);
 
   /* get varids */
@@ -118,43 +152,43 @@ void seissol::sourceterm::readNRF(const char* filename, NRF& nrf) {
   stat = nc_inq_varid(ncid, "sroffsets", &sroffsets_id);
   check_err(stat, __LINE__, __FILE__);
 
-  stat = nc_inq_varid(ncid, "sliprates1", &sliprates1_id);
+  stat = nc_inq_varid(ncid, "sliprates1", &sliprates_id[0]);
   check_err(stat, __LINE__, __FILE__);
 
-  stat = nc_inq_varid(ncid, "sliprates2", &sliprates2_id);
+  stat = nc_inq_varid(ncid, "sliprates2", &sliprates_id[1]);
   check_err(stat, __LINE__, __FILE__);
 
-  stat = nc_inq_varid(ncid, "sliprates3", &sliprates3_id);
+  stat = nc_inq_varid(ncid, "sliprates3", &sliprates_id[2]);
   check_err(stat, __LINE__, __FILE__);
 
+  /* contiguous slice of the subfaults */
+  const std::size_t begin = source_len * slice / numberOfSlices;
+  const std::size_t end = source_len * (slice + 1) / numberOfSlices;
+  const std::size_t count = end - begin;
+
   /* allocate memory */
   static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
                 "sizeof(Eigen::Vector3d) does not equal 3*sizeof(double).");
-  nrf.centres.resize(source_len);
-  nrf.sroffsets.resize(source_len + 1);
-  nrf.subfaults.resize(source_len);
-  for (unsigned i = 0; i < 3; ++i) {
-    nrf.sliprates[i].resize(sample_len[i]);
-  }
+  nrf.centres.resize(count);
+  nrf.sroffsets.resize(count + 1);
+  nrf.subfaults.resize(count);
 
   /* get values */
-  stat = nc_get_var(ncid, centres_id, nrf.centres.data());
-  check_err(stat, __LINE__, __FILE__);
-
-  stat = nc_get_var(ncid, sroffsets_id, nrf.sroffsets.data());
-  check_err(stat, __LINE__, __FILE__);
-
-  stat = nc_get_var(ncid, subfaults_id, nrf.subfaults.data());
-  check_err(stat, __LINE__, __FILE__);
-
-  stat = nc_get_var_double(ncid, sliprates1_id, nrf.sliprates[0].data());
-  check_err(stat, __LINE__, __FILE__);
-
-  stat = nc_get_var_double(ncid, sliprates2_id, nrf.sliprates[1].data());
-  check_err(stat, __LINE__, __FILE__);
-
-  stat = nc_get_var_double(ncid, sliprates3_id, nrf.sliprates[2].data());
-  check_err(stat, __LINE__, __FILE__);
+  readSlice(ncid, centres_id, begin, count, nrf.centres.data());
+  readSlice(ncid, sroffsets_id, begin, count + 1, nrf.sroffsets.data());
+  readSlice(ncid, subfaults_id, begin, count, nrf.subfaults.data());
+
+  /* slip rates of the slice, the offsets are shifted to start at zero */
+  const Offsets first = nrf.sroffsets[0];
+  for (auto& offsets : nrf.sroffsets) {
+    for (unsigned i = 0; i < 3; ++i) {
+      offsets[i] -= first[i];
+    }
+  }
+  for (unsigned i = 0; i < 3; ++i) {
+    nrf.sliprates[i].resize(nrf.sroffsets[count][i]);
+    readSliceDouble(ncid, sliprates_id[i], first[i], nrf.sliprates[i].size(), nrf.sliprates[i].data());
+  }
 
   /* close nrf */
   stat = nc_close(ncid);
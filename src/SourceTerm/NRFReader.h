@@ -46,6 +46,13 @@
 
 namespace seissol::sourceterm {
 void readNRF(const char* filename, NRF& nrf);
+
+/**
+ * Reads the contiguous slice of subfaults [size * slice / numberOfSlices,
+ * size * (slice + 1) / numberOfSlices) of an NRF file. The slip rate offsets
+ * of the slice start at zero.
+ */
+void readNRF(const char* filename, NRF& nrf, int slice, int numberOfSlices);
 } // namespace seissol::sourceterm
 
 #endif
@@ -21,8 +21,10 @@ src/Common/IntegerMaskParser.cpp
 src/Equations/elastic/Kernels/GravitationalFreeSurfaceBC.cpp
 src/Equations/poroelastic/Model/datastructures.cpp
 
+src/Geometry/CellOrdering.cpp
 src/Geometry/MeshReader.cpp
 src/Geometry/MeshTools.cpp
+src/Geometry/PointLocator.cpp
 
 src/Initializer/CellLocalMatrices.cpp
 src/Initializer/GlobalData.cpp
@@ -36,6 +38,7 @@ src/Initializer/InitialFieldProjection.cpp
 src/Initializer/InternalState.cpp
 src/Initializer/MemoryAllocator.cpp
 src/Initializer/MemoryManager.cpp
+src/Initializer/ParameterCache.cpp
 src/Initializer/ParameterDB.cpp
 src/Initializer/PointMapper.cpp
 
@@ -52,6 +55,7 @@ src/Initializer/Parameters/SourceParameters.cpp
 
 src/Initializer/time_stepping/GlobalTimestep.cpp
 src/Initializer/time_stepping/LtsLayout.cpp
+src/Initializer/time_stepping/LtsWeights/CostModel.cpp
 
 src/Initializer/tree/Lut.cpp
 
@@ -77,6 +81,7 @@ src/Numerical_aux/ODEVector.cpp
 src/Numerical_aux/Statistics.cpp
 src/Numerical_aux/Transformation.cpp
 
+src/Parallel/Numa.cpp
 src/Parallel/Pin.cpp
 
 src/Physics/Attenuation.cpp
@@ -91,8 +96,10 @@ src/ResultWriter/FaultWriterExecutor.cpp
 src/ResultWriter/FreeSurfaceWriter.cpp
 src/ResultWriter/FreeSurfaceWriterExecutor.cpp
 src/ResultWriter/MiniSeisSolWriter.cpp
+src/ResultWriter/PickpointWriter.cpp
 src/ResultWriter/PostProcessor.cpp
 src/ResultWriter/ReceiverWriter.cpp
+src/ResultWriter/ReceiverWriterExecutor.cpp
 src/ResultWriter/ThreadsPinningWriter.cpp
 src/ResultWriter/WaveFieldWriter.cpp
 
@@ -107,7 +114,9 @@ src/Solver/time_stepping/AbstractTimeCluster.cpp
 src/Solver/time_stepping/ActorState.cpp
 src/Solver/time_stepping/CommunicationManager.cpp
 src/Solver/time_stepping/DirectGhostTimeCluster.cpp
+src/Solver/time_stepping/FaceGhostTimeCluster.cpp
 src/Solver/time_stepping/GhostTimeClusterWithCopy.cpp
+src/Solver/time_stepping/HaloCodec.cpp
 src/Solver/time_stepping/MiniSeisSol.cpp
 src/Solver/time_stepping/TimeCluster.cpp
 src/Solver/time_stepping/TimeManager.cpp
@@ -133,15 +142,18 @@ set(SYCL_DEPENDENT_SRC_FILES
   ${CMAKE_CURRENT_SOURCE_DIR}/src/DynamicRupture/Output/FaultRefiner/FaultRefiners.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/DynamicRupture/Output/OutputAux.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/DynamicRupture/Output/OutputManager.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/DynamicRupture/Output/PickpointSampler.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/DynamicRupture/Output/ReceiverBasedOutput.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Equations/elastic/Kernels/GravitationalFreeSurfaceBC.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/PointMapper.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/CellLocalMatrices.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/CellMatrices.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Modules/Module.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Modules/Modules.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Monitoring/ActorStateStatistics.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Monitoring/LoopStatistics.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/Plasticity.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/NeighborGroups.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/PointSourceClusterOnHost.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/Touch.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/ResultWriter/EnergyOutput.cpp
@@ -160,7 +172,9 @@ set(SYCL_DEPENDENT_SRC_FILES
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/ActorState.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/CommunicationManager.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/DirectGhostTimeCluster.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/FaceGhostTimeCluster.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/GhostTimeClusterWithCopy.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/HaloCodec.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/TimeCluster.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/TimeManager.cpp
 
@@ -185,6 +199,8 @@ if (MPI)
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/FaultAsync.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/Fault.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/WavefieldAsync.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/WavefieldGlobal.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/FaultGlobal.cpp
 )
 endif()
 
@@ -205,7 +221,9 @@ if (HDF5 AND MPI)
 endif()
 
 if (NETCDF)
-  list(APPEND SYCL_DEPENDENT_SRC_FILES ${CMAKE_CURRENT_SOURCE_DIR}/src/SourceTerm/NRFReader.cpp)
+  list(APPEND SYCL_DEPENDENT_SRC_FILES
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/SourceTerm/NRFDistribution.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/SourceTerm/NRFReader.cpp)
   target_sources(SeisSol-lib PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/NetcdfReader.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/CubeGenerator.cpp
@@ -0,0 +1,4 @@
+#include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include "WavefieldGlobal.t.h"
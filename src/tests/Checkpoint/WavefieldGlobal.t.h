@@ -0,0 +1,48 @@
+#ifdef USE_MPI
+#include "Checkpoint/mpio/WavefieldGlobal.h"
+
+#include <utility>
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Cell layout of the global wave field checkpoint") {
+  using checkpoint::mpio::WavefieldGlobal;
+  constexpr auto Invalid = checkpoint::CheckPoint::INVALID_ID;
+
+  SUBCASE("Cells are sorted by their global identifier") {
+    const auto layout = WavefieldGlobal::computeLayout({7, 2, 5, 0});
+    REQUIRE(layout.positions == std::vector<unsigned long>{0, 2, 5, 7});
+    REQUIRE(layout.uniqueCells == std::vector<unsigned long>{3, 1, 2, 0});
+    REQUIRE(layout.duplicates.empty());
+    REQUIRE(layout.numCells == 8);
+  }
+
+  SUBCASE("Duplicated identifiers are copied from the first cell") {
+    const auto layout = WavefieldGlobal::computeLayout({4, 1, 4, 1, 4});
+    REQUIRE(layout.positions == std::vector<unsigned long>{1, 4});
+    REQUIRE(layout.uniqueCells == std::vector<unsigned long>{1, 0});
+    const std::vector<std::pair<unsigned long, unsigned long>> duplicates = {{3, 1}, {2, 0}, {4, 0}};
+    REQUIRE(layout.duplicates == duplicates);
+    REQUIRE(layout.numCells == 5);
+  }
+
+  SUBCASE("Invalid identifiers are ignored") {
+    const auto layout = WavefieldGlobal::computeLayout({Invalid, 3, Invalid});
+    REQUIRE(layout.positions == std::vector<unsigned long>{3});
+    REQUIRE(layout.uniqueCells == std::vector<unsigned long>{1});
+    REQUIRE(layout.duplicates.empty());
+    REQUIRE(layout.numCells == 4);
+  }
+
+  SUBCASE("Ranks without cells do not require any cells in the file") {
+    const auto layout = WavefieldGlobal::computeLayout({});
+    REQUIRE(layout.positions.empty());
+    REQUIRE(layout.uniqueCells.empty());
+    REQUIRE(layout.duplicates.empty());
+    REQUIRE(layout.numCells == 0);
+  }
+}
+
+} // namespace seissol::unit_test
+#endif // USE_MPI
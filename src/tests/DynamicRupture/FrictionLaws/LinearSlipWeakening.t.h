@@ -0,0 +1,197 @@
+#ifndef SEISSOL_LINEARSLIPWEAKENING_T_H
+#define SEISSOL_LINEARSLIPWEAKENING_T_H
+
+#include <algorithm>
+#include <array>
+
+#include "DynamicRupture/FrictionLaws/LinearSlipWeakening.h"
+#include "DynamicRupture/Misc.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+/**
+ * Linear slip weakening law on a single fault face whose data lives in the object itself instead
+ * of the LTS tree.
+ */
+class SingleFaceLinearSlipWeakening
+    : public friction_law::LinearSlipWeakeningLaw<friction_law::NoSpecialization> {
+  public:
+  explicit SingleFaceLinearSlipWeakening(
+      seissol::initializer::parameters::DRParameters* drParameters)
+      : LinearSlipWeakeningLaw(drParameters) {
+    impAndEta = &faceImpAndEta;
+    impedanceMatrices = &faceImpedanceMatrices;
+    initialStressInFaultCS = faceInitialStress;
+    nucleationStressInFaultCS = faceNucleationStress;
+    initialPressure = faceInitialPressure;
+    nucleationPressure = faceNucleationPressure;
+    mu = faceMu;
+    accumulatedSlipMagnitude = faceAccumulatedSlip;
+    slip1 = faceSlip1;
+    slip2 = faceSlip2;
+    slipRateMagnitude = faceSlipRateMagnitude;
+    slipRate1 = faceSlipRate1;
+    slipRate2 = faceSlipRate2;
+    ruptureTime = faceRuptureTime;
+    ruptureTimePending = faceRuptureTimePending;
+    peakSlipRate = facePeakSlipRate;
+    traction1 = faceTraction1;
+    traction2 = faceTraction2;
+    dynStressTime = faceDynStressTime;
+    dynStressTimePending = faceDynStressTimePending;
+    dC = faceDC;
+    muS = faceMuS;
+    muD = faceMuD;
+    cohesion = faceCohesion;
+    forcedRuptureTime = faceForcedRuptureTime;
+
+    faceImpAndEta.etaS = 2.0;
+    faceImpAndEta.invEtaS = 0.5;
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      faceInitialStress[0][pointIndex][0] = -100.0;
+      faceInitialStress[0][pointIndex][3] = 10.0;
+      faceInitialStress[0][pointIndex][5] = 5.0;
+      // mu = muS - (muS - muD) * accumulatedSlip / dC, exact in floating point
+      faceMuS[0][pointIndex] = 0.75;
+      faceMuD[0][pointIndex] = 0.25;
+      faceDC[0][pointIndex] = 0.5;
+      faceAccumulatedSlip[0][pointIndex] = 0.25;
+      faceMu[0][pointIndex] = 0.5;
+      faceSlip1[0][pointIndex] = 0.2;
+      faceSlip2[0][pointIndex] = -0.05;
+      faceRuptureTimePending[0][pointIndex] = false;
+      faceRuptureTime[0][pointIndex] = 0.5;
+      faceForcedRuptureTime[0][pointIndex] = 1.0e10;
+    }
+
+    std::array<double, CONVERGENCE_ORDER> points{};
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+      points[timeIndex] = 0.001 * (timeIndex + 1);
+    }
+    computeDeltaT(points.data());
+    mFullUpdateTime = 1.0;
+  }
+
+  void setPeakSlipRate(real value) {
+    std::fill_n(facePeakSlipRate[0], misc::numPaddedPoints, value);
+  }
+
+  void setMu(real value) { std::fill_n(faceMu[0], misc::numPaddedPoints, value); }
+
+  /**
+   * Updates the face as BaseFrictionLaw::evaluate does
+   * @return true if the face has been treated as locked
+   */
+  bool update(const FaultStresses& faultStresses,
+              TractionResults& tractionResults,
+              bool allowLocked) {
+    const bool isLocked = allowLocked && updateLockedFace(faultStresses, tractionResults, 0);
+    if (!isLocked) {
+      updateFace(faultStresses, tractionResults, 0);
+    }
+    return isLocked;
+  }
+
+  void compare(const SingleFaceLinearSlipWeakening& other) const {
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      REQUIRE(faceMu[0][pointIndex] == other.faceMu[0][pointIndex]);
+      REQUIRE(faceAccumulatedSlip[0][pointIndex] == other.faceAccumulatedSlip[0][pointIndex]);
+      REQUIRE(faceSlip1[0][pointIndex] == other.faceSlip1[0][pointIndex]);
+      REQUIRE(faceSlip2[0][pointIndex] == other.faceSlip2[0][pointIndex]);
+      REQUIRE(faceSlipRateMagnitude[0][pointIndex] == other.faceSlipRateMagnitude[0][pointIndex]);
+      REQUIRE(faceSlipRate1[0][pointIndex] == other.faceSlipRate1[0][pointIndex]);
+      REQUIRE(faceSlipRate2[0][pointIndex] == other.faceSlipRate2[0][pointIndex]);
+      REQUIRE(faceTraction1[0][pointIndex] == other.faceTraction1[0][pointIndex]);
+      REQUIRE(faceTraction2[0][pointIndex] == other.faceTraction2[0][pointIndex]);
+      REQUIRE(facePeakSlipRate[0][pointIndex] == other.facePeakSlipRate[0][pointIndex]);
+      REQUIRE(faceRuptureTime[0][pointIndex] == other.faceRuptureTime[0][pointIndex]);
+    }
+  }
+
+  private:
+  ImpedancesAndEta faceImpAndEta{};
+  ImpedanceMatrices faceImpedanceMatrices{};
+  real faceInitialStress[1][misc::numPaddedPoints][6]{};
+  real faceNucleationStress[1][misc::numPaddedPoints][6]{};
+  real faceInitialPressure[1][misc::numPaddedPoints]{};
+  real faceNucleationPressure[1][misc::numPaddedPoints]{};
+  real faceMu[1][misc::numPaddedPoints]{};
+  real faceAccumulatedSlip[1][misc::numPaddedPoints]{};
+  real faceSlip1[1][misc::numPaddedPoints]{};
+  real faceSlip2[1][misc::numPaddedPoints]{};
+  real faceSlipRateMagnitude[1][misc::numPaddedPoints]{};
+  real faceSlipRate1[1][misc::numPaddedPoints]{};
+  real faceSlipRate2[1][misc::numPaddedPoints]{};
+  real faceRuptureTime[1][misc::numPaddedPoints]{};
+  bool faceRuptureTimePending[1][misc::numPaddedPoints]{};
+  real facePeakSlipRate[1][misc::numPaddedPoints]{};
+  real faceTraction1[1][misc::numPaddedPoints]{};
+  real faceTraction2[1][misc::numPaddedPoints]{};
+  real faceDynStressTime[1][misc::numPaddedPoints]{};
+  bool faceDynStressTimePending[1][misc::numPaddedPoints]{};
+  real faceDC[1][misc::numPaddedPoints]{};
+  real faceMuS[1][misc::numPaddedPoints]{};
+  real faceMuD[1][misc::numPaddedPoints]{};
+  real faceCohesion[1][misc::numPaddedPoints]{};
+  real faceForcedRuptureTime[1][misc::numPaddedPoints]{};
+};
+
+TEST_CASE("Locked faces of the linear slip weakening law") {
+  seissol::initializer::parameters::DRParameters drParameters;
+  drParameters.t0 = 0.5;
+
+  // stress changes which keep the traction well below the fault strength of 50
+  FaultStresses faultStresses{};
+  for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      faultStresses.normalStress[timeIndex][pointIndex] = 0.5 * timeIndex;
+      faultStresses.traction1[timeIndex][pointIndex] = 0.25 * timeIndex + 0.01 * pointIndex;
+      faultStresses.traction2[timeIndex][pointIndex] = -0.5 * timeIndex;
+    }
+  }
+
+  auto checkLockedAndFullPath = [&](real peakSlipRate, real mu, bool expectLocked) {
+    SingleFaceLinearSlipWeakening lockedPath(&drParameters);
+    SingleFaceLinearSlipWeakening fullPath(&drParameters);
+    lockedPath.setPeakSlipRate(peakSlipRate);
+    fullPath.setPeakSlipRate(peakSlipRate);
+    lockedPath.setMu(mu);
+    fullPath.setMu(mu);
+
+    TractionResults lockedTractions{};
+    TractionResults fullTractions{};
+    REQUIRE(lockedPath.update(faultStresses, lockedTractions, true) == expectLocked);
+    REQUIRE(!fullPath.update(faultStresses, fullTractions, false));
+
+    lockedPath.compare(fullPath);
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        REQUIRE(lockedTractions.traction1[timeIndex][pointIndex] ==
+                fullTractions.traction1[timeIndex][pointIndex]);
+        REQUIRE(lockedTractions.traction2[timeIndex][pointIndex] ==
+                fullTractions.traction2[timeIndex][pointIndex]);
+      }
+    }
+  };
+
+  SUBCASE("Without healing") {
+    checkLockedAndFullPath(2.0, 0.5, true);
+  }
+
+  SUBCASE("With healing") {
+    drParameters.healingThreshold = 0.1;
+    // the face slipped during the last time step and heals now
+    checkLockedAndFullPath(2.0, 0.5, false);
+    // the face has already healed
+    checkLockedAndFullPath(2.0, 0.75, true);
+    // the face has never slipped fast enough to heal
+    checkLockedAndFullPath(0.05, 0.5, true);
+  }
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_LINEARSLIPWEAKENING_T_H
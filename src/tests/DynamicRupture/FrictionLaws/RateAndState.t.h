@@ -0,0 +1,117 @@
+#ifndef SEISSOL_RATEANDSTATE_T_H
+#define SEISSOL_RATEANDSTATE_T_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "DynamicRupture/FrictionLaws/AgingLaw.h"
+#include "DynamicRupture/FrictionLaws/ThermalPressurization/NoTP.h"
+#include "DynamicRupture/Misc.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+/**
+ * Aging law on a single fault face whose data lives in the object itself instead of the LTS tree.
+ */
+class SingleFaceAgingLaw : public friction_law::AgingLaw<friction_law::NoTP> {
+  public:
+  explicit SingleFaceAgingLaw(seissol::initializer::parameters::DRParameters* drParameters)
+      : AgingLaw(drParameters) {
+    impAndEta = &faceImpAndEta;
+    slipRateMagnitude = faceSlipRateMagnitude;
+    a = faceA;
+    sl0 = faceSl0;
+
+    faceImpAndEta.invEtaS = 1.0 / 4.6e6;
+  }
+
+  void setPoint(unsigned pointIndex, real localA, real localSl0, real slipRate) {
+    faceA[0][pointIndex] = localA;
+    faceSl0[0][pointIndex] = localSl0;
+    faceSlipRateMagnitude[0][pointIndex] = slipRate;
+  }
+
+  double newtonTolerance() const { return settings.newtonTolerance; }
+
+  /**
+   * Newton iteration for a single point which stops as soon as the point has converged, i.e. the
+   * scalar variant of invertSlipRateIterative
+   */
+  real invertSlipRate(unsigned pointIndex,
+                      real localStateVariable,
+                      real normalStress,
+                      real absoluteShearStress) {
+    real slipRateTest = faceSlipRateMagnitude[0][pointIndex];
+    for (unsigned i = 0; i < settings.maxNumberSlipRateUpdates; i++) {
+      const double muF = updateMu(0, pointIndex, slipRateTest, localStateVariable);
+      const double dMuF = updateMuDerivative(0, pointIndex, slipRateTest, localStateVariable);
+      const double g =
+          -faceImpAndEta.invEtaS * (std::fabs(normalStress) * muF - absoluteShearStress) -
+          slipRateTest;
+      if (std::fabs(g) < settings.newtonTolerance) {
+        break;
+      }
+      const double dG = -faceImpAndEta.invEtaS * (std::fabs(normalStress) * dMuF) - 1.0;
+      const real step = g / dG;
+      slipRateTest = std::max(friction_law::rs::almostZero(), slipRateTest - step);
+    }
+    return slipRateTest;
+  }
+
+  private:
+  ImpedancesAndEta faceImpAndEta{};
+  real faceSlipRateMagnitude[1][misc::numPaddedPoints]{};
+  real faceA[1][misc::numPaddedPoints]{};
+  real faceSl0[1][misc::numPaddedPoints]{};
+};
+
+TEST_CASE("Newton iteration of the rate and state friction laws") {
+  seissol::initializer::parameters::DRParameters drParameters;
+  drParameters.rsSr0 = 1e-6;
+  drParameters.rsF0 = 0.6;
+  drParameters.rsB = 0.012;
+
+  SingleFaceAgingLaw law(&drParameters);
+
+  // Points with different parameters and first guesses, such that they converge after a
+  // different number of iterations
+  std::array<real, misc::numPaddedPoints> stateVariable{};
+  std::array<real, misc::numPaddedPoints> normalStress{};
+  std::array<real, misc::numPaddedPoints> absoluteShearStress{};
+  for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    const real localSl0 = 0.02;
+    law.setPoint(pointIndex,
+                 0.008 + 0.0005 * (pointIndex % 8),
+                 localSl0,
+                 std::pow(static_cast<real>(10.0), -static_cast<real>(pointIndex % 5)));
+    stateVariable[pointIndex] = localSl0 / (1e-6 + 1e-3 * (pointIndex % 3));
+    normalStress[pointIndex] = -120e6;
+    absoluteShearStress[pointIndex] = 70e6 + 1e6 * (pointIndex % 7);
+  }
+
+  std::array<real, misc::numPaddedPoints> slipRate{};
+  REQUIRE(law.invertSlipRateIterative(
+      0, stateVariable, normalStress, absoluteShearStress, slipRate));
+
+  // Points which have converged earlier keep taking Newton steps, which move the slip rate by
+  // less than the tolerance (as dg/dV <= -1)
+  const double tolerance =
+      2 * law.newtonTolerance() + 4 * std::numeric_limits<real>::epsilon();
+  for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    const real scalarSlipRate = law.invertSlipRate(pointIndex,
+                                                   stateVariable[pointIndex],
+                                                   normalStress[pointIndex],
+                                                   absoluteShearStress[pointIndex]);
+    REQUIRE(slipRate[pointIndex] ==
+            doctest::Approx(scalarSlipRate).epsilon(tolerance).scale(1.0));
+  }
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_RATEANDSTATE_T_H
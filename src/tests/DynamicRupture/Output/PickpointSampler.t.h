@@ -0,0 +1,141 @@
+#ifndef SEISSOL_DR_PICKPOINT_SAMPLER_T_H
+#define SEISSOL_DR_PICKPOINT_SAMPLER_T_H
+
+#include "DynamicRupture/Misc.h"
+#include "DynamicRupture/Output/DataTypes.hpp"
+#include "DynamicRupture/Output/PickpointSampler.hpp"
+#include "Kernels/precision.hpp"
+
+#include "doctest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+// Slip rate and rupture time of two receivers with a cache of four samples. The first receiver
+// ruptures at t = 0.6, the second one does not rupture.
+class PickpointSamplerTestData {
+  public:
+  static constexpr std::size_t NumberOfPoints = 2;
+  static constexpr std::size_t CacheLevels = 4;
+  // time, two slip rate components and the rupture time
+  static constexpr std::size_t NumberOfColumns = 4;
+  static constexpr double RuptureTime = 0.6;
+
+  PickpointSamplerTestData() {
+    data.maxCacheLevel = CacheLevels;
+    data.cachedTime.resize(CacheLevels);
+    auto allocate = [](auto& var, int index) {
+      var.isActive =
+          index == output::VariableID::SlipRate || index == output::VariableID::RuptureTime;
+      var.maxCacheLevel = CacheLevels;
+      var.allocateData(NumberOfPoints);
+    };
+    misc::forEach(data.vars, allocate);
+  }
+
+  // linear in time, such that the interpolated samples are exact
+  static real slipRate(int dim, std::size_t pointId, double time) {
+    return static_cast<real>((dim + 1) + (pointId + 1) * (dim + 2) * time);
+  }
+
+  static real ruptureTime(std::size_t pointId, double time) {
+    return (pointId == 0 && time >= RuptureTime) ? RuptureTime : 0.0;
+  }
+
+  // Mimics the fault output at the end of a step
+  void computeFaultOutput(double time) {
+    const std::size_t level = data.currentCacheLevel;
+    auto& slipRateVar = std::get<output::VariableID::SlipRate>(data.vars);
+    auto& ruptureTimeVar = std::get<output::VariableID::RuptureTime>(data.vars);
+    for (std::size_t pointId = 0; pointId < NumberOfPoints; ++pointId) {
+      for (int dim = 0; dim < 2; ++dim) {
+        slipRateVar(dim, level, pointId) = slipRate(dim, pointId, time);
+      }
+      ruptureTimeVar(level, pointId) = ruptureTime(pointId, time);
+    }
+  }
+
+  ReceiverOutputData data;
+};
+
+TEST_CASE("Time-based pick point sampling") {
+  const double interval = 0.25;
+  const std::vector<double> stepTimes = {0.0, 0.3, 0.7, 1.0, 1.45};
+  const std::vector<double> sampleTimes = {0.0, 0.25, 0.5, 0.75, 1.0, 1.25};
+
+  PickpointSamplerTestData testData;
+  auto& data = testData.data;
+  output::PickpointSampler sampler(interval);
+  output::PickpointSampleBuffer buffer;
+  buffer.init(PickpointSamplerTestData::NumberOfPoints, PickpointSamplerTestData::NumberOfColumns);
+
+  unsigned flushCount = 0;
+  auto flush = [&]() {
+    REQUIRE(data.currentCacheLevel == PickpointSamplerTestData::CacheLevels);
+    buffer.stage(data);
+    ++flushCount;
+  };
+
+  for (const double time : stepTimes) {
+    if (data.currentCacheLevel >= data.maxCacheLevel) {
+      flush();
+    }
+    testData.computeFaultOutput(time);
+    sampler.addSamples(data, time, flush);
+  }
+  // The cache is full after four samples
+  REQUIRE(flushCount == 1);
+  REQUIRE(data.currentCacheLevel == sampleTimes.size() - PickpointSamplerTestData::CacheLevels);
+
+  const std::size_t maxValues = PickpointSamplerTestData::NumberOfPoints *
+                                PickpointSamplerTestData::NumberOfColumns * sampleTimes.size();
+  std::vector<std::uint64_t> sampleCounts(PickpointSamplerTestData::NumberOfPoints);
+  std::vector<real> samples(maxValues);
+  buffer.stage(data);
+  REQUIRE(data.currentCacheLevel == 0);
+  REQUIRE(buffer.collect(sampleCounts.data(), samples.data(), maxValues) == maxValues);
+
+  const double epsilon = sizeof(real) == sizeof(double) ? 1e-12 : 1e-5;
+  std::size_t value = 0;
+  for (std::size_t pointId = 0; pointId < PickpointSamplerTestData::NumberOfPoints; ++pointId) {
+    REQUIRE(sampleCounts[pointId] == sampleTimes.size());
+    for (const double sampleTime : sampleTimes) {
+      REQUIRE(samples[value++] == doctest::Approx(sampleTime).epsilon(epsilon));
+      for (int dim = 0; dim < 2; ++dim) {
+        REQUIRE(samples[value++] ==
+                doctest::Approx(PickpointSamplerTestData::slipRate(dim, pointId, sampleTime))
+                    .epsilon(epsilon));
+      }
+      // The rupture time is not interpolated
+      REQUIRE(samples[value++] == PickpointSamplerTestData::ruptureTime(pointId, sampleTime));
+    }
+  }
+
+  // The buffer is empty after collecting
+  REQUIRE(buffer.collect(sampleCounts.data(), samples.data(), maxValues) == 0);
+  REQUIRE(sampleCounts[0] == 0);
+  REQUIRE(sampleCounts[1] == 0);
+}
+
+TEST_CASE("Pick point sample buffer without receivers") {
+  ReceiverOutputData data;
+  data.cachedTime.resize(data.maxCacheLevel);
+  data.cachedTime[0] = 0.5;
+  data.currentCacheLevel = 1;
+
+  output::PickpointSampleBuffer buffer;
+  buffer.init(0, 1);
+  buffer.stage(data);
+  REQUIRE(data.currentCacheLevel == 0);
+  REQUIRE(buffer.collect(nullptr, nullptr, 0) == 0);
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_DR_PICKPOINT_SAMPLER_T_H
@@ -1,5 +1,8 @@
 #include "doctest.h"
 
 #include "FrictionLaws/FrictionSolverCommon.t.h"
+#include "FrictionLaws/LinearSlipWeakening.t.h"
+#include "FrictionLaws/RateAndState.t.h"
 #include "Output/Geometry.t.h"
+#include "Output/PickpointSampler.t.h"
 #include "Output/Variables.t.h"
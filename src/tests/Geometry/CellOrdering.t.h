@@ -0,0 +1,136 @@
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "Geometry/CellOrdering.h"
+
+namespace seissol::unit_test {
+
+namespace {
+bool isPermutation(std::vector<std::size_t> order, std::size_t size) {
+  std::sort(order.begin(), order.end());
+  std::vector<std::size_t> identity(size);
+  std::iota(identity.begin(), identity.end(), 0);
+  return order == identity;
+}
+} // namespace
+
+TEST_CASE("Hilbert curve") {
+  constexpr unsigned int Bits = 3;
+  constexpr std::uint32_t N = 1U << Bits;
+
+  // Invert the index, s.t. we can follow the curve
+  std::vector<std::array<std::uint32_t, 3>> curve(N * N * N, {N, N, N});
+  for (std::uint32_t z = 0; z < N; ++z) {
+    for (std::uint32_t y = 0; y < N; ++y) {
+      for (std::uint32_t x = 0; x < N; ++x) {
+        const auto index = seissol::geometry::hilbertIndex({x, y, z}, Bits);
+        REQUIRE(index < curve.size());
+        REQUIRE(curve[index][0] == N);
+        curve[index] = {x, y, z};
+      }
+    }
+  }
+
+  SUBCASE("Consecutive points are neighbors") {
+    for (std::size_t i = 1; i < curve.size(); ++i) {
+      unsigned int distance = 0;
+      for (int dim = 0; dim < 3; ++dim) {
+        distance += curve[i][dim] > curve[i - 1][dim] ? curve[i][dim] - curve[i - 1][dim]
+                                                      : curve[i - 1][dim] - curve[i][dim];
+      }
+      REQUIRE(distance == 1);
+    }
+  }
+
+  SUBCASE("Order of shuffled grid points") {
+    std::vector<Eigen::Vector3d> points;
+    for (const auto& coords : curve) {
+      points.emplace_back(0.5 * coords[0] - 1.0, 0.5 * coords[1] + 2.0, 0.5 * coords[2]);
+    }
+    std::vector<std::size_t> shuffle(points.size());
+    std::iota(shuffle.begin(), shuffle.end(), 0);
+    std::shuffle(shuffle.begin(), shuffle.end(), std::mt19937(42));
+    std::vector<Eigen::Vector3d> shuffledPoints(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      shuffledPoints[i] = points[shuffle[i]];
+    }
+
+    const auto order = seissol::geometry::hilbertOrder(shuffledPoints);
+    REQUIRE(isPermutation(order, points.size()));
+    for (std::size_t i = 1; i < order.size(); ++i) {
+      REQUIRE((shuffledPoints[order[i]] - shuffledPoints[order[i - 1]]).norm() ==
+              AbsApprox(0.5));
+    }
+  }
+}
+
+TEST_CASE("Reverse Cuthill-McKee order") {
+  SUBCASE("Shuffled path") {
+    constexpr std::size_t N = 100;
+    std::vector<std::size_t> labels(N);
+    std::iota(labels.begin(), labels.end(), 0);
+    std::shuffle(labels.begin(), labels.end(), std::mt19937(42));
+
+    std::vector<std::vector<std::size_t>> adjacency(N);
+    for (std::size_t i = 1; i < N; ++i) {
+      adjacency[labels[i]].push_back(labels[i - 1]);
+      adjacency[labels[i - 1]].push_back(labels[i]);
+    }
+
+    const auto order = seissol::geometry::reverseCuthillMcKeeOrder(adjacency);
+    REQUIRE(isPermutation(order, N));
+    for (std::size_t i = 1; i < N; ++i) {
+      const auto& neighbors = adjacency[order[i]];
+      REQUIRE(std::find(neighbors.begin(), neighbors.end(), order[i - 1]) != neighbors.end());
+    }
+  }
+
+  SUBCASE("Bandwidth of a shuffled grid") {
+    constexpr std::size_t N = 20;
+    std::vector<std::size_t> labels(N * N);
+    std::iota(labels.begin(), labels.end(), 0);
+    std::shuffle(labels.begin(), labels.end(), std::mt19937(42));
+
+    std::vector<std::vector<std::size_t>> adjacency(N * N);
+    for (std::size_t y = 0; y < N; ++y) {
+      for (std::size_t x = 0; x < N; ++x) {
+        if (x > 0) {
+          adjacency[labels[y * N + x]].push_back(labels[y * N + x - 1]);
+          adjacency[labels[y * N + x - 1]].push_back(labels[y * N + x]);
+        }
+        if (y > 0) {
+          adjacency[labels[y * N + x]].push_back(labels[(y - 1) * N + x]);
+          adjacency[labels[(y - 1) * N + x]].push_back(labels[y * N + x]);
+        }
+      }
+    }
+
+    const auto order = seissol::geometry::reverseCuthillMcKeeOrder(adjacency);
+    REQUIRE(isPermutation(order, N * N));
+
+    std::vector<std::size_t> position(N * N);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      position[order[i]] = i;
+    }
+    std::size_t bandwidth = 0;
+    for (std::size_t node = 0; node < adjacency.size(); ++node) {
+      for (const auto neighbor : adjacency[node]) {
+        bandwidth = std::max(bandwidth, position[node] > position[neighbor]
+                                            ? position[node] - position[neighbor]
+                                            : position[neighbor] - position[node]);
+      }
+    }
+    REQUIRE(bandwidth <= 2 * N);
+  }
+
+  SUBCASE("Disconnected graph") {
+    std::vector<std::vector<std::size_t>> adjacency = {{1}, {0}, {}, {4}, {3}};
+    const auto order = seissol::geometry::reverseCuthillMcKeeOrder(adjacency);
+    REQUIRE(isPermutation(order, adjacency.size()));
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,101 @@
+#include <Eigen/Dense>
+
+#include "Geometry/PointLocator.h"
+
+namespace seissol::unit_test {
+
+namespace {
+/**
+ * Splits the unit cube into n^3 cubes of 6 tetrahedra each.
+ */
+void createCubeMesh(int n, std::vector<Vertex>& vertices, std::vector<Element>& elements) {
+  auto vertexId = [n](int x, int y, int z) { return (z * (n + 1) + y) * (n + 1) + x; };
+  vertices.resize((n + 1) * (n + 1) * (n + 1));
+  for (int z = 0; z <= n; ++z) {
+    for (int y = 0; y <= n; ++y) {
+      for (int x = 0; x <= n; ++x) {
+        auto& coords = vertices[vertexId(x, y, z)].coords;
+        coords[0] = static_cast<double>(x) / n;
+        coords[1] = static_cast<double>(y) / n;
+        coords[2] = static_cast<double>(z) / n;
+      }
+    }
+  }
+
+  // Kuhn triangulation: each tetrahedron follows a path from (0,0,0) to (1,1,1)
+  const std::array<std::array<int, 3>, 6> permutations = {
+      {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}};
+  for (int z = 0; z < n; ++z) {
+    for (int y = 0; y < n; ++y) {
+      for (int x = 0; x < n; ++x) {
+        for (const auto& permutation : permutations) {
+          Element element{};
+          std::array<int, 3> corner = {x, y, z};
+          element.vertices[0] = vertexId(corner[0], corner[1], corner[2]);
+          for (int i = 0; i < 3; ++i) {
+            ++corner[permutation[i]];
+            element.vertices[i + 1] = vertexId(corner[0], corner[1], corner[2]);
+          }
+          // SeisSol expects a positive orientation of the vertices
+          const Eigen::Vector3d v0(vertices[element.vertices[0]].coords);
+          Eigen::Matrix3d edges;
+          for (int i = 0; i < 3; ++i) {
+            edges.col(i) = Eigen::Vector3d(vertices[element.vertices[i + 1]].coords) - v0;
+          }
+          if (edges.determinant() < 0.0) {
+            std::swap(element.vertices[1], element.vertices[2]);
+          }
+          element.localId = static_cast<int>(elements.size());
+          elements.push_back(element);
+        }
+      }
+    }
+  }
+}
+
+bool isInside(const Element& element, const std::vector<Vertex>& vertices, const Eigen::Vector3d& point) {
+  Eigen::Matrix3d matrix;
+  const Eigen::Vector3d origin(vertices[element.vertices[0]].coords);
+  for (int i = 0; i < 3; ++i) {
+    matrix.col(i) = Eigen::Vector3d(vertices[element.vertices[i + 1]].coords) - origin;
+  }
+  const Eigen::Vector3d xi = matrix.inverse() * (point - origin);
+  const double eps = 1e-12;
+  return xi.minCoeff() >= -eps && xi.sum() <= 1.0 + eps;
+}
+} // namespace
+
+TEST_CASE("Point locator") {
+  std::vector<Vertex> vertices;
+  std::vector<Element> elements;
+  createCubeMesh(5, vertices, elements);
+  const seissol::geometry::PointLocator locator(vertices, elements);
+
+  SUBCASE("Points inside the mesh") {
+    std::srand(1234);
+    for (int i = 0; i < 200; ++i) {
+      const Eigen::Vector3d point((double)std::rand() / RAND_MAX,
+                                  (double)std::rand() / RAND_MAX,
+                                  (double)std::rand() / RAND_MAX);
+      const auto found = locator.findElement(point);
+      REQUIRE(found.has_value());
+      REQUIRE(isInside(elements[*found], vertices, point));
+    }
+  }
+
+  SUBCASE("Points on faces are assigned to the lowest localId") {
+    const Eigen::Vector3d point(0.2, 0.2, 0.2);
+    const auto found = locator.findElement(point);
+    REQUIRE(found.has_value());
+    for (std::size_t elem = 0; elem < *found; ++elem) {
+      REQUIRE(!isInside(elements[elem], vertices, point));
+    }
+  }
+
+  SUBCASE("Points outside the mesh") {
+    REQUIRE(!locator.findElement(Eigen::Vector3d(1.5, 0.5, 0.5)).has_value());
+    REQUIRE(!locator.findElement(Eigen::Vector3d(-0.1, 0.5, 0.5)).has_value());
+  }
+}
+
+} // namespace seissol::unit_test
@@ -1,6 +1,8 @@
 #include "doctest.h"
 #include "tests/TestHelper.h"
 
+#include "CellOrdering.t.h"
 #include "MeshRefiner.t.h"
+#include "PointLocator.t.h"
 #include "TriangleRefiner.t.h"
 #include "VariableSubsampler.t.h"
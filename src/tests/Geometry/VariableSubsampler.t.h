@@ -1,6 +1,8 @@
 #include <array>
 #include <iostream>
 #include <iomanip>
+#include <limits>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -50,6 +52,24 @@ TEST_CASE("Variable Subsampler") {
     for (int i = 0; i < 36; i++) {
       REQUIRE(outDofs[i] == AbsApprox(expectedDOFs[i]).epsilon(epsilon));
     }
+
+    SUBCASE("All variables at once") {
+      const std::vector<unsigned int> variables = {8, 0, 4};
+      std::array<real, 12> fusedDofs;
+      std::array<real*, 3> buffers = {&fusedDofs[0], &fusedDofs[4], &fusedDofs[8]};
+
+      REQUIRE(subsampler.get(dofs.data(), cellMap, variables, buffers.data()));
+      for (unsigned var = 0; var < variables.size(); var++) {
+        for (int i = 0; i < 4; i++) {
+          // The summation order differs from the evaluation of a single variable
+          REQUIRE(fusedDofs[var * 4 + i] ==
+                  AbsApprox(outDofs[variables[var] * 4 + i]).epsilon(100 * epsilon));
+        }
+      }
+
+      dofs[4 * 12] = std::numeric_limits<real>::quiet_NaN();
+      REQUIRE(!subsampler.get(dofs.data(), cellMap, variables, buffers.data()));
+    }
   };
 }
 
@@ -0,0 +1,70 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Initializer/MemoryAllocator.h"
+
+namespace seissol::unit_test {
+
+// Size of the virtual address space of this process in kB
+inline std::size_t virtualMemorySize() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmSize:", 0) == 0) {
+      return std::stoul(line.substr(7));
+    }
+  }
+  return 0;
+}
+
+TEST_CASE("Map aligned pages") {
+  const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+  SUBCASE("Alignment and trimmed ends") {
+    // The unaligned ends of the mapping are much larger than the chunk itself
+    const std::size_t alignment = 256 * 1024 * 1024;
+    const std::size_t size = 3 * pageSize + 1;
+
+    const std::size_t before = virtualMemorySize();
+    std::size_t mappedSize = 0;
+    void* pointer = seissol::memory::mapPages(size, alignment, mappedSize);
+    REQUIRE(pointer != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0);
+    REQUIRE(mappedSize == 4 * pageSize);
+
+    // Only the chunk stays mapped
+    if (before > 0) {
+      REQUIRE(virtualMemorySize() - before == mappedSize / 1024);
+    }
+
+    std::memset(pointer, 1, mappedSize);
+    REQUIRE(static_cast<const char*>(pointer)[mappedSize - 1] == 1);
+
+    REQUIRE(munmap(pointer, mappedSize) == 0);
+    if (before > 0) {
+      REQUIRE(virtualMemorySize() == before);
+    }
+  }
+
+  SUBCASE("Alignment below the page size") {
+    std::size_t mappedSize = 0;
+    void* pointer = seissol::memory::mapPages(pageSize, 64, mappedSize);
+    REQUIRE(pointer != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(pointer) % pageSize == 0);
+    REQUIRE(mappedSize == pageSize);
+    REQUIRE(munmap(pointer, mappedSize) == 0);
+  }
+
+  SUBCASE("Alignment which is no multiple of the page size") {
+    std::size_t mappedSize = 0;
+    REQUIRE(seissol::memory::mapPages(pageSize, pageSize + 64, mappedSize) == nullptr);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,79 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Initializer/ParameterCache.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Parameter cache") {
+  using seissol::initializer::ParameterCache;
+
+  const std::string dataFileName = "parameterCache-test.dat";
+  const std::string modelFileName = "parameterCache-test.yaml";
+  const std::string directory = "parameterCache-test";
+  {
+    std::ofstream dataFile(dataFileName);
+    dataFile << "1 2 3\n";
+    std::ofstream modelFile(modelFileName);
+    modelFile << "!ASAGI\nfile: " << dataFileName << "\nparameters: [rho, mu, lambda]\n";
+  }
+
+  easi::Query query(2, 3);
+  for (unsigned point = 0; point < 2; ++point) {
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      query.x(point, dim) = point + 0.5 * dim;
+    }
+    query.group(point) = 1;
+  }
+  const std::vector<std::string> parameters = {"rho", "mu", "lambda"};
+  const std::vector<double> values = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+  SUBCASE("Disabled without directory") {
+    const ParameterCache cache("", modelFileName, query, parameters);
+    std::vector<double> cached;
+    REQUIRE(!cache.enabled());
+    REQUIRE(!cache.read(cached, values.size()));
+  }
+
+  SUBCASE("Round trip") {
+    const ParameterCache cache(directory, modelFileName, query, parameters);
+    std::vector<double> cached;
+    REQUIRE(cache.enabled());
+    REQUIRE(!cache.read(cached, values.size()));
+
+    cache.write(values);
+    REQUIRE(cache.read(cached, values.size()));
+    REQUIRE(cached == values);
+    REQUIRE(!cache.read(cached, values.size() + 1));
+    std::remove(cache.fileName().c_str());
+  }
+
+  SUBCASE("Key") {
+    const ParameterCache cache(directory, modelFileName, query, parameters);
+    const ParameterCache sameCache(directory, modelFileName, query, parameters);
+    REQUIRE(cache.fileName() == sameCache.fileName());
+
+    const ParameterCache otherParameters(directory, modelFileName, query, {"rho"});
+    REQUIRE(cache.fileName() != otherParameters.fileName());
+
+    query.x(1, 2) += 1.0;
+    const ParameterCache otherPoints(directory, modelFileName, query, parameters);
+    REQUIRE(cache.fileName() != otherPoints.fileName());
+
+    // Changing a file which is referenced by the model invalidates the cache
+    const auto modelKey = ParameterCache::modelKey(modelFileName);
+    {
+      std::ofstream dataFile(dataFileName, std::ios::app);
+      dataFile << "4 5 6\n";
+    }
+    REQUIRE(modelKey != ParameterCache::modelKey(modelFileName));
+  }
+
+  std::remove(dataFileName.c_str());
+  std::remove(modelFileName.c_str());
+  std::remove(directory.c_str());
+}
+
+} // namespace seissol::unit_test
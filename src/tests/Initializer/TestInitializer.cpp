@@ -1,5 +1,8 @@
 #include "doctest.h"
 #include "tests/TestHelper.h"
 
+#include "MemoryAllocator.t.h"
+#include "ParameterCache.t.h"
 #include "PointMapper.t.h"
+#include "time_stepping/CostModel.t.h"
 #include "time_stepping/LTSWeights.t.h"
\ No newline at end of file
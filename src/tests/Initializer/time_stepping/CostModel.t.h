@@ -0,0 +1,58 @@
+#include <cstdio>
+#include <ctime>
+#include <string>
+
+#include "Initializer/time_stepping/LtsWeights/CostModel.h"
+#include "Monitoring/LoopStatistics.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Cost model for LTS weights") {
+  using namespace seissol::initializer::time_stepping;
+  const auto eps = 10e-12;
+
+  LoopStatistics loopStatistics;
+  for (const auto* name :
+       {"computeLocalIntegration", "computeNeighboringIntegration", "computeDynamicRupture"}) {
+    loopStatistics.addRegion(name);
+  }
+  auto addSample = [&loopStatistics](
+                       const std::string& region, unsigned iterations, unsigned subRegion, long s) {
+    const timespec begin{0, 0};
+    const timespec end{s, 0};
+    loopStatistics.addSample(
+        loopStatistics.getRegion(region), iterations, subRegion, begin, end);
+  };
+
+  // Two global clusters: sub-regions 0 and 1 are the interiors, 2 and 3 the copy layers
+  addSample("computeLocalIntegration", 100, 0, 1);
+  addSample("computeLocalIntegration", 100, 2, 3);
+  addSample("computeNeighboringIntegration", 200, 0, 2);
+  addSample("computeDynamicRupture", 10, 0, 1);
+
+  const auto model = CostModel::fromLoopStatistics(loopStatistics, 2, seissol::MPI::mpi.comm());
+
+  REQUIRE(model.clusters.size() == 2);
+  REQUIRE(AbsApprox(model.total.element).epsilon(eps) == 0.03);
+  REQUIRE(AbsApprox(model.total.dynamicRuptureFace).epsilon(eps) == 0.1);
+  REQUIRE(AbsApprox(model.clusters[0].element).epsilon(eps) == 0.03);
+  REQUIRE(model.clusters[1].element == 0.0);
+
+  // Clusters without measurements fall back to the averages
+  REQUIRE(AbsApprox(model.clusterCosts(1).element).epsilon(eps) == 0.03);
+  REQUIRE(AbsApprox(model.clusterCosts(5).dynamicRuptureFace).epsilon(eps) == 0.1);
+
+  const std::string fileName = "costModel-test.yaml";
+  model.write(fileName);
+  const auto readModel = CostModel::read(fileName);
+  std::remove(fileName.c_str());
+
+  REQUIRE(readModel.clusters.size() == model.clusters.size());
+  REQUIRE(AbsApprox(readModel.total.element).epsilon(eps) == model.total.element);
+  REQUIRE(AbsApprox(readModel.total.dynamicRuptureFace).epsilon(eps) ==
+          model.total.dynamicRuptureFace);
+  REQUIRE(AbsApprox(readModel.clusters[0].element).epsilon(eps) == model.clusters[0].element);
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,94 @@
+#include "Equations/elastic/Kernels/DirichletBoundary.h"
+#include "Initializer/typedefs.hpp"
+#include "Kernels/precision.hpp"
+#include "generated_code/init.h"
+#include "generated_code/kernel.h"
+#include "generated_code/tensor.h"
+
+#include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace seissol::unit_test {
+TEST_CASE("Time expansion of analytical boundary conditions") {
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  const real epsilon = sizeof(real) == sizeof(double) ? 1e-10 : 1e-3;
+
+  // A polynomial of degree CONVERGENCE_ORDER - 1 in time, which is expanded exactly
+  std::vector<double> polynomial(CONVERGENCE_ORDER * tensor::INodal::size());
+  for (auto& coefficient : polynomial) {
+    coefficient = distribution(generator);
+  }
+  auto boundaryCondition = [&polynomial](const real*,
+                                         double time,
+                                         init::INodal::view::type& boundaryDofs) {
+    for (unsigned i = 0; i < tensor::INodal::size(); ++i) {
+      double value = 0.0;
+      for (int k = CONVERGENCE_ORDER - 1; k >= 0; --k) {
+        value = value * time + polynomial[k * tensor::INodal::size() + i];
+      }
+      boundaryDofs.data()[i] = value;
+    }
+  };
+
+  std::vector<real> nodes(nodal::tensor::nodes2D::Shape[0] * 3, 0.0);
+  AnalyticalBoundaryExpansion expansion{};
+  expansion.start = std::numeric_limits<double>::infinity();
+  expansion.end = -std::numeric_limits<double>::infinity();
+  CellBoundaryMapping boundaryMapping{};
+  boundaryMapping.nodes = nodes.data();
+  boundaryMapping.analyticalExpansion = &expansion;
+
+  const kernels::DirichletBoundary dirichletBoundary;
+  auto projectKrnl = kernel::projectToNodalBoundary{};
+
+  auto compare = [&](double time, double timeStepWidth, double expansionInterval) {
+    alignas(ALIGNMENT) real expected[tensor::INodal::size()];
+    alignas(ALIGNMENT) real expanded[tensor::INodal::size()];
+    dirichletBoundary.evaluateTimeDependent(nullptr,
+                                            0,
+                                            boundaryMapping,
+                                            projectKrnl,
+                                            boundaryCondition,
+                                            expected,
+                                            time,
+                                            timeStepWidth);
+    dirichletBoundary.evaluateTimeDependent(nullptr,
+                                            0,
+                                            boundaryMapping,
+                                            projectKrnl,
+                                            boundaryCondition,
+                                            expanded,
+                                            time,
+                                            timeStepWidth,
+                                            expansionInterval);
+    for (unsigned i = 0; i < tensor::INodal::size(); ++i) {
+      REQUIRE(expanded[i] == AbsApprox(expected[i]).epsilon(epsilon));
+    }
+  };
+
+  SUBCASE("Refresh interval") {
+    const double timeStepWidth = 0.1;
+    for (unsigned step = 0; step < 10; ++step) {
+      compare(step * timeStepWidth, timeStepWidth, 0.5);
+      // the expansion is only refreshed after five time steps
+      REQUIRE(expansion.start == AbsApprox(step < 5 ? 0.0 : 0.5));
+      REQUIRE(expansion.end == AbsApprox(expansion.start + 0.5));
+    }
+  }
+
+  SUBCASE("Long expansion interval") {
+    // the expansion of a polynomial in time is exact in any interval
+    compare(0.0, 0.1, 1.0);
+    compare(0.3, 0.05, 1.0);
+    compare(0.35, 0.2, 1.0);
+    REQUIRE(expansion.start == 0.0);
+    REQUIRE(expansion.end == 1.0);
+  }
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,150 @@
+#include "Equations/Setup.h"
+#include "Initializer/typedefs.hpp"
+#include "Kernels/CellMatrices.h"
+#include "Model/common.hpp"
+#include "Numerical_aux/Transformation.h"
+#include "generated_code/init.h"
+#include "generated_code/kernel.h"
+#include "generated_code/tensor.h"
+
+#include "doctest.h"
+
+#include <cmath>
+
+namespace seissol::unit_test {
+
+// The star matrices and flux solvers as computed by the initialization before they could be
+// computed on the fly, i.e. the data stored in LocalIntegrationData and NeighboringIntegrationData
+TEST_CASE("Compact integration data reproduces the stored integration data") {
+  const double epsilon = sizeof(real) == sizeof(double) ? 1e-12 : 1e-5;
+
+  double localValues[] = {2670.0, 3.203812032e10, 3.204375936e10};
+  double neighborValues[] = {2000.0, 1.0e10, 1.2e10};
+  CellMaterialData material;
+  material.local = model::ElasticMaterial(localValues, 3);
+  for (auto& neighbor : material.neighbor) {
+    neighbor = model::ElasticMaterial(neighborValues, 3);
+  }
+
+  const real x[4] = {0.0, 1.2, 0.1, 0.3};
+  const real y[4] = {0.0, 0.2, 0.9, 0.1};
+  const real z[4] = {0.0, -0.1, 0.2, 1.1};
+  real gradients[3][3];
+  seissol::transformations::tetrahedronGlobalToReferenceJacobian(
+      x, y, z, gradients[0], gradients[1], gradients[2]);
+
+  SUBCASE("Star matrices") {
+    real ATData[tensor::star::size(0)];
+    real BTData[tensor::star::size(1)];
+    real CTData[tensor::star::size(2)];
+    auto AT = init::star::view<0>::create(ATData);
+    auto BT = init::star::view<0>::create(BTData);
+    auto CT = init::star::view<0>::create(CTData);
+    model::getTransposedCoefficientMatrix(material.local, 0, AT);
+    model::getTransposedCoefficientMatrix(material.local, 1, BT);
+    model::getTransposedCoefficientMatrix(material.local, 2, CT);
+
+    real stored[3][tensor::star::size(0)];
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      for (unsigned idx = 0; idx < tensor::star::size(0); ++idx) {
+        stored[dim][idx] = gradients[dim][0] * ATData[idx] + gradients[dim][1] * BTData[idx] +
+                           gradients[dim][2] * CTData[idx];
+      }
+    }
+
+    real computed[3][tensor::star::size(0)];
+#ifdef USE_COMPACT_INTEGRATION_DATA
+    LocalIntegrationData localIntegration;
+    for (unsigned i = 0; i < 3; ++i) {
+      for (unsigned j = 0; j < 3; ++j) {
+        localIntegration.gradients[i][j] = gradients[i][j];
+      }
+    }
+    kernels::computeStarMatrices(material, localIntegration, computed);
+#else
+    kernels::computeStarMatrices(material, gradients, computed);
+#endif
+
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      for (unsigned idx = 0; idx < tensor::star::size(0); ++idx) {
+        REQUIRE(computed[dim][idx] == doctest::Approx(stored[dim][idx]).epsilon(epsilon));
+      }
+    }
+  }
+
+  SUBCASE("Flux solvers") {
+    // an orthonormal face frame
+    const double angle = 0.3;
+    const VrtxCoords normal = {std::cos(angle), std::sin(angle), 0.0};
+    const VrtxCoords tangent1 = {-std::sin(angle), std::cos(angle), 0.0};
+    const VrtxCoords tangent2 = {0.0, 0.0, 1.0};
+    const real fluxScale = -0.7;
+    const unsigned side = 2;
+
+    for (const auto faceType : {FaceType::regular, FaceType::freeSurface}) {
+      real ATtildeData[tensor::star::size(0)];
+      auto ATtilde = init::star::view<0>::create(ATtildeData);
+      real TData[tensor::T::size()];
+      real TinvData[tensor::Tinv::size()];
+      auto T = init::T::view::create(TData);
+      auto Tinv = init::Tinv::view::create(TinvData);
+      real QgodLocalData[tensor::QgodLocal::size()];
+      real QgodNeighborData[tensor::QgodNeighbor::size()];
+      auto QgodLocal = init::QgodLocal::view::create(QgodLocalData);
+      auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
+
+      model::getTransposedGodunovState(
+          material.local, material.neighbor[side], faceType, QgodLocal, QgodNeighbor);
+      model::getTransposedCoefficientMatrix(material.local, 0, ATtilde);
+      model::getFaceRotationMatrix(normal, tangent1, tangent2, T, Tinv);
+
+      real storedAplusT[tensor::AplusT::size()];
+      real storedAminusT[tensor::AminusT::size()];
+      kernel::computeFluxSolverLocal localKrnl;
+      localKrnl.fluxScale = fluxScale;
+      localKrnl.AplusT = storedAplusT;
+      localKrnl.QgodLocal = QgodLocalData;
+      localKrnl.T = TData;
+      localKrnl.Tinv = TinvData;
+      localKrnl.star(0) = ATtildeData;
+      localKrnl.execute();
+
+      kernel::computeFluxSolverNeighbor neighKrnl;
+      neighKrnl.fluxScale = fluxScale;
+      neighKrnl.AminusT = storedAminusT;
+      neighKrnl.QgodNeighbor = QgodNeighborData;
+      neighKrnl.T = TData;
+      neighKrnl.Tinv = TinvData;
+      neighKrnl.star(0) = ATtildeData;
+      neighKrnl.execute();
+
+      real AplusT[tensor::AplusT::size()];
+      real AminusT[tensor::AminusT::size()];
+#ifdef USE_COMPACT_INTEGRATION_DATA
+      LocalIntegrationData localIntegration;
+      for (unsigned d = 0; d < 3; ++d) {
+        localIntegration.faceFrames[side][0][d] = normal[d];
+        localIntegration.faceFrames[side][1][d] = tangent1[d];
+        localIntegration.faceFrames[side][2][d] = tangent2[d];
+      }
+      localIntegration.fluxScales[side] = fluxScale;
+      kernels::computeFluxSolvers(material, localIntegration, side, faceType, AplusT, AminusT);
+#else
+      kernels::computeFluxSolvers(
+          material, side, faceType, normal, tangent1, tangent2, fluxScale, AplusT, AminusT);
+#endif
+
+      for (unsigned i = 0; i < tensor::AplusT::size(); ++i) {
+        REQUIRE(AplusT[i] == doctest::Approx(storedAplusT[i]).epsilon(epsilon));
+      }
+      // The neighbor flux solver of a free surface is not used (and undefined)
+      if (faceType != FaceType::freeSurface) {
+        for (unsigned i = 0; i < tensor::AminusT::size(); ++i) {
+          REQUIRE(AminusT[i] == doctest::Approx(storedAminusT[i]).epsilon(epsilon));
+        }
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test
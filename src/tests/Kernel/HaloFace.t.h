@@ -0,0 +1,54 @@
+#include "Kernels/precision.hpp"
+#include "generated_code/init.h"
+#include "generated_code/kernel.h"
+#include "generated_code/tensor.h"
+
+#include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include <random>
+#include <vector>
+
+namespace seissol::unit_test {
+TEST_CASE("Face-restricted halo exchange preserves the face trace") {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+
+  const real epsilon = sizeof(real) == sizeof(double) ? 1e-10 : 1e-3;
+
+  for (unsigned face = 0; face < 4; ++face) {
+    alignas(ALIGNMENT) real buffer[tensor::I::size()];
+    alignas(ALIGNMENT) real lifted[tensor::I::size()];
+    alignas(ALIGNMENT) real faceData[tensor::faceI::size()];
+    alignas(ALIGNMENT) real faceDataLifted[tensor::faceI::size()];
+    for (auto& value : buffer) {
+      value = distribution(generator);
+    }
+
+    kernel::projectBufferToFace projectKrnl;
+    projectKrnl.haloFaceProjection(face, 0) =
+        init::haloFaceProjection::Values[tensor::haloFaceProjection::index(face, 0)];
+    kernel::liftBufferFromFace liftKrnl;
+    liftKrnl.haloFaceLift(face, 0) =
+        init::haloFaceLift::Values[tensor::haloFaceLift::index(face, 0)];
+
+    projectKrnl.I = buffer;
+    projectKrnl.faceI = faceData;
+    projectKrnl.execute(face);
+
+    liftKrnl.faceI = faceData;
+    liftKrnl.I = lifted;
+    liftKrnl.execute(face);
+
+    // projecting the lifted data onto the face must reproduce the trace of the original data
+    projectKrnl.I = lifted;
+    projectKrnl.faceI = faceDataLifted;
+    projectKrnl.execute(face);
+
+    for (unsigned i = 0; i < tensor::faceI::size(); ++i) {
+      REQUIRE(faceDataLifted[i] == AbsApprox(faceData[i]).epsilon(epsilon));
+    }
+  }
+}
+
+} // namespace seissol::unit_test
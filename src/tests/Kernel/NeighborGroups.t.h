@@ -0,0 +1,102 @@
+#include "Kernels/NeighborGroups.h"
+
+#include "doctest.h"
+
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace seissol::unit_test {
+TEST_CASE("Neighbor groups cover all faces in the order of the cell-wise kernel") {
+  constexpr unsigned NumberOfCells = 1000;
+
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<int> typeDistribution(0, 5);
+  std::uniform_int_distribution<int> sideDistribution(0, 3);
+  std::uniform_int_distribution<int> orientationDistribution(0, 2);
+
+  const FaceType types[] = {FaceType::regular,
+                            FaceType::regular,
+                            FaceType::periodic,
+                            FaceType::dynamicRupture,
+                            FaceType::freeSurface,
+                            FaceType::outflow};
+
+  std::vector<CellLocalInformation> cellInformation(NumberOfCells);
+  auto drMapping = std::make_unique<CellDRMapping[][4]>(NumberOfCells);
+  for (unsigned cell = 0; cell < NumberOfCells; ++cell) {
+    cellInformation[cell].ltsSetup = (cell % 7 == 0) ? (1 << (cell % 4)) : 0;
+    for (unsigned face = 0; face < 4; ++face) {
+      cellInformation[cell].faceTypes[face] = types[typeDistribution(generator)];
+      cellInformation[cell].faceRelations[face][0] = sideDistribution(generator);
+      cellInformation[cell].faceRelations[face][1] = orientationDistribution(generator);
+      drMapping[cell][face].side = sideDistribution(generator);
+      drMapping[cell][face].faceRelation = orientationDistribution(generator);
+    }
+  }
+
+  kernels::NeighborGroups groups;
+  groups.build(cellInformation.data(), drMapping.get(), NumberOfCells, 4);
+  REQUIRE(groups.isBuilt());
+
+  std::set<std::pair<unsigned, unsigned>> visited;
+  unsigned expectedBegin = 0;
+  for (unsigned block = 0; block < groups.numberOfBlocks(); ++block) {
+    REQUIRE(groups.blockBegin(block) == expectedBegin);
+    REQUIRE(groups.blockEnd(block) > groups.blockBegin(block));
+    REQUIRE(groups.blockEnd(block) - groups.blockBegin(block) <=
+            kernels::NeighborGroups::MaxBlockSize);
+    expectedBegin = groups.blockEnd(block);
+
+    // faces of a cell are visited in increasing order
+    std::vector<int> lastFace(NumberOfCells, -1);
+    for (const auto* group = groups.groupsBegin(block); group != groups.groupsEnd(block);
+         ++group) {
+      const unsigned face = group->key.faceId;
+      for (unsigned i = group->begin; i < group->end; ++i) {
+        const unsigned cell = groups.cells()[i];
+        REQUIRE(cell >= groups.blockBegin(block));
+        REQUIRE(cell < groups.blockEnd(block));
+        REQUIRE(static_cast<int>(face) > lastFace[cell]);
+        lastFace[cell] = face;
+        REQUIRE(visited.emplace(cell, face).second);
+
+        if (group->key.typeId == *FaceKinds::DynamicRupture) {
+          REQUIRE(cellInformation[cell].faceTypes[face] == FaceType::dynamicRupture);
+          REQUIRE(group->key.faceRelationId ==
+                  drMapping[cell][face].side + 4 * drMapping[cell][face].faceRelation);
+        } else {
+          REQUIRE((cellInformation[cell].faceTypes[face] == FaceType::regular ||
+                   cellInformation[cell].faceTypes[face] == FaceType::periodic));
+          REQUIRE(group->key.faceRelationId % 3 ==
+                  static_cast<unsigned>(cellInformation[cell].faceRelations[face][1]));
+          REQUIRE((group->key.faceRelationId / 3) % 4 ==
+                  static_cast<unsigned>(cellInformation[cell].faceRelations[face][0]));
+        }
+      }
+    }
+  }
+  REQUIRE(expectedBegin == NumberOfCells);
+
+  unsigned expectedFaces = 0;
+  for (unsigned cell = 0; cell < NumberOfCells; ++cell) {
+    bool needsBuffer = false;
+    for (unsigned face = 0; face < 4; ++face) {
+      const auto type = cellInformation[cell].faceTypes[face];
+      if (type == FaceType::regular || type == FaceType::periodic ||
+          type == FaceType::dynamicRupture) {
+        ++expectedFaces;
+      }
+      if (type != FaceType::outflow && type != FaceType::dynamicRupture &&
+          (cellInformation[cell].ltsSetup >> face) % 2 == 1) {
+        needsBuffer = true;
+      }
+    }
+    REQUIRE((groups.integrationBuffer(cell) != nullptr) == needsBuffer);
+  }
+  REQUIRE(visited.size() == expectedFaces);
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,61 @@
+#include "Kernels/Plasticity.h"
+#include "generated_code/init.h"
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace seissol::unit_test {
+TEST_CASE("Plasticity elastic check does not skip yielding cells") {
+  alignas(ALIGNMENT) real vandermonde[tensor::v::size()];
+  alignas(ALIGNMENT) real vandermondeInverse[tensor::vInv::size()];
+  std::copy_n(init::v::Values, tensor::v::size(), vandermonde);
+  std::copy_n(init::vInv::Values, tensor::vInv::size(), vandermondeInverse);
+  GlobalData global;
+  global.vandermondeMatrix = vandermonde;
+  global.vandermondeMatrixInverse = vandermondeInverse;
+
+  std::mt19937 generator(13);
+  std::normal_distribution<real> normal;
+  std::uniform_real_distribution<real> uniform(0.0, 1.0);
+
+  alignas(ALIGNMENT) real dofs[tensor::Q::size()];
+  alignas(ALIGNMENT) real dofsBefore[tensor::Q::size()];
+  std::vector<real> pstrain(tensor::QStress::size() + tensor::QEtaModal::size());
+
+  unsigned numberOfElasticCells = 0;
+  for (unsigned trial = 0; trial < 1000; ++trial) {
+    // dominant cell average, higher modes of varying magnitude
+    const real highModesScale = 0.1 * uniform(generator);
+    std::fill(std::begin(dofs), std::end(dofs), 0.0);
+    auto stressView = init::QStress::view::create(dofs);
+    for (unsigned l = 0; l < stressView.shape(0); ++l) {
+      for (unsigned p = 0; p < 6; ++p) {
+        stressView(l, p) = (l == 0 ? 3.0 : highModesScale) * normal(generator);
+      }
+    }
+    std::copy(std::begin(dofs), std::end(dofs), std::begin(dofsBefore));
+    std::fill(pstrain.begin(), pstrain.end(), 0.0);
+
+    PlasticityData plasticityData{};
+    for (unsigned p = 0; p < 6; ++p) {
+      plasticityData.initialLoading[p] = normal(generator);
+    }
+    plasticityData.cohesionTimesCosAngularFriction = 20.0 * uniform(generator);
+    plasticityData.sinAngularFriction = 2.0 * uniform(generator) - 1.0;
+    plasticityData.mufactor = 1.0;
+
+    if (kernels::Plasticity::isElastic(&plasticityData, dofs)) {
+      ++numberOfElasticCells;
+      REQUIRE(kernels::Plasticity::computePlasticity(
+                  0.5, 0.01, 0.05, &global, &plasticityData, dofs, pstrain.data()) == 0);
+      REQUIRE(std::equal(std::begin(dofs), std::end(dofs), std::begin(dofsBefore)));
+    }
+  }
+  // the check must not be trivial either
+  REQUIRE(numberOfElasticCells > 0);
+}
+
+} // namespace seissol::unit_test
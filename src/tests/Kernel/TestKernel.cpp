@@ -1,7 +1,15 @@
 #include "doctest.h"
 
+#include "AnalyticalBoundary.t.h"
+#include "HaloFace.t.h"
+#include "NeighborGroups.t.h"
+#include "Plasticity.t.h"
 #include "PointSourceCluster.t.h"
 
+#ifdef USE_ELASTIC
+#include "CellMatrices.t.h"
+#endif // USE_ELASTIC
+
 #ifdef USE_POROELASTIC
 #include "STP.t.h"
 #endif // USE_POROELASTIC
@@ -0,0 +1,60 @@
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Parallel/Numa.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Bytes per NUMA node") {
+  const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  const std::size_t numberOfPages = 64;
+  const std::size_t size = numberOfPages * pageSize;
+
+  void* mapping =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  REQUIRE(mapping != MAP_FAILED);
+  auto* buffer = static_cast<char*>(mapping);
+
+  std::vector<std::size_t> bytesPerNode;
+  // The placement cannot be queried without NUMA support of the kernel
+  if (seissol::parallel::addBytesPerNumaNode(buffer, size, bytesPerNode)) {
+    SUBCASE("Untouched pages are not counted") {
+      REQUIRE(std::accumulate(bytesPerNode.begin(), bytesPerNode.end(), std::size_t{0}) == 0);
+    }
+
+    SUBCASE("Touched pages") {
+      std::memset(buffer, 1, size);
+      bytesPerNode.clear();
+      REQUIRE(seissol::parallel::addBytesPerNumaNode(buffer, size, bytesPerNode));
+      REQUIRE(std::accumulate(bytesPerNode.begin(), bytesPerNode.end(), std::size_t{0}) == size);
+
+      // The bytes are added to the previous counts
+      const auto previous = bytesPerNode;
+      REQUIRE(seissol::parallel::addBytesPerNumaNode(buffer, size, bytesPerNode));
+      REQUIRE(bytesPerNode.size() == previous.size());
+      for (std::size_t node = 0; node < previous.size(); ++node) {
+        REQUIRE(bytesPerNode[node] == 2 * previous[node]);
+      }
+    }
+
+    SUBCASE("Sampled pages") {
+      // Touch every other page; the sampled pages are equidistant
+      for (std::size_t page = 0; page < numberOfPages; page += 2) {
+        buffer[page * pageSize] = 1;
+      }
+      bytesPerNode.clear();
+      REQUIRE(seissol::parallel::addBytesPerNumaNode(buffer, size, bytesPerNode, 8));
+      REQUIRE(std::accumulate(bytesPerNode.begin(), bytesPerNode.end(), std::size_t{0}) ==
+              size);
+    }
+  }
+
+  REQUIRE(munmap(mapping, size) == 0);
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,3 @@
+#include "doctest.h"
+
+#include "Numa.t.h"
@@ -1,5 +1,11 @@
 #include "tests/TestHelper.h"
+#include <cstddef>
+#include <cstdio>
 #include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <netcdf.h>
 
 #include "SourceTerm/NRF.h"
 #include "SourceTerm/NRFReader.h"
@@ -7,6 +13,73 @@
 #include "slipRatesData.h"
 
 namespace seissol::unit_test {
+
+// Writes an NRF file in the layout of rconv (see preprocessing/science/rconv/src/NRFWriter.cpp).
+// Every direction needs at least one sample, since a dimension of length zero is unlimited.
+inline void writeTestNRF(const std::string& fileName, const seissol::sourceterm::NRF& nrf) {
+  const auto check = [](int stat) { REQUIRE(stat == NC_NOERR); };
+
+  int ncid;
+  check(nc_create(fileName.c_str(), NC_CLOBBER | NC_NETCDF4, &ncid));
+
+  int vector3Type;
+  check(nc_def_compound(ncid, 3 * sizeof(double), "Vector3", &vector3Type));
+  check(nc_insert_compound(ncid, vector3Type, "x", 0, NC_DOUBLE));
+  check(nc_insert_compound(ncid, vector3Type, "y", sizeof(double), NC_DOUBLE));
+  check(nc_insert_compound(ncid, vector3Type, "z", 2 * sizeof(double), NC_DOUBLE));
+
+  using seissol::sourceterm::Subfault;
+  int subfaultType;
+  check(nc_def_compound(ncid, sizeof(Subfault), "Subfault", &subfaultType));
+  check(nc_insert_compound(
+      ncid, subfaultType, "tinit", NC_COMPOUND_OFFSET(Subfault, tinit), NC_DOUBLE));
+  check(nc_insert_compound(
+      ncid, subfaultType, "timestep", NC_COMPOUND_OFFSET(Subfault, timestep), NC_DOUBLE));
+  check(nc_insert_compound(ncid, subfaultType, "mu", NC_COMPOUND_OFFSET(Subfault, mu), NC_DOUBLE));
+  check(nc_insert_compound(
+      ncid, subfaultType, "area", NC_COMPOUND_OFFSET(Subfault, area), NC_DOUBLE));
+  check(nc_insert_compound(
+      ncid, subfaultType, "tan1", NC_COMPOUND_OFFSET(Subfault, tan1), vector3Type));
+  check(nc_insert_compound(
+      ncid, subfaultType, "tan2", NC_COMPOUND_OFFSET(Subfault, tan2), vector3Type));
+  check(nc_insert_compound(
+      ncid, subfaultType, "normal", NC_COMPOUND_OFFSET(Subfault, normal), vector3Type));
+
+  int sourceDim;
+  int sroffsetDim;
+  int directionDim;
+  int sampleDims[3];
+  check(nc_def_dim(ncid, "source", nrf.size(), &sourceDim));
+  check(nc_def_dim(ncid, "sroffset", nrf.size() + 1, &sroffsetDim));
+  check(nc_def_dim(ncid, "direction", 3, &directionDim));
+  for (unsigned i = 0; i < 3; ++i) {
+    const std::string name = "sample" + std::to_string(i + 1);
+    check(nc_def_dim(ncid, name.c_str(), nrf.sliprates[i].size(), &sampleDims[i]));
+  }
+
+  int centresId;
+  int subfaultsId;
+  int sroffsetsId;
+  int sliprateIds[3];
+  check(nc_def_var(ncid, "centres", vector3Type, 1, &sourceDim, &centresId));
+  check(nc_def_var(ncid, "subfaults", subfaultType, 1, &sourceDim, &subfaultsId));
+  const int sroffsetsDims[2] = {sroffsetDim, directionDim};
+  check(nc_def_var(ncid, "sroffsets", NC_UINT, 2, sroffsetsDims, &sroffsetsId));
+  for (unsigned i = 0; i < 3; ++i) {
+    const std::string name = "sliprates" + std::to_string(i + 1);
+    check(nc_def_var(ncid, name.c_str(), NC_DOUBLE, 1, &sampleDims[i], &sliprateIds[i]));
+  }
+  check(nc_enddef(ncid));
+
+  check(nc_put_var(ncid, centresId, nrf.centres.data()));
+  check(nc_put_var(ncid, subfaultsId, nrf.subfaults.data()));
+  check(nc_put_var_uint(ncid, sroffsetsId, nrf.sroffsets.data()->data()));
+  for (unsigned i = 0; i < 3; ++i) {
+    check(nc_put_var_double(ncid, sliprateIds[i], nrf.sliprates[i].data()));
+  }
+  check(nc_close(ncid));
+}
+
 TEST_CASE("NRF Reader") {
   seissol::sourceterm::NRF nrf;
   seissol::sourceterm::readNRF("Testing/source_loh.nrf", nrf);
@@ -45,4 +118,98 @@ TEST_CASE("NRF Reader") {
     }
   }
 }
+
+TEST_CASE("NRF Reader slices") {
+  seissol::sourceterm::NRF nrf;
+  seissol::sourceterm::readNRF("Testing/source_loh.nrf", nrf);
+
+  // The only subfault belongs to the second of two slices
+  seissol::sourceterm::NRF first;
+  seissol::sourceterm::readNRF("Testing/source_loh.nrf", first, 0, 2);
+  REQUIRE(first.size() == 0);
+  REQUIRE(first.sroffsets.size() == 1);
+
+  seissol::sourceterm::NRF second;
+  seissol::sourceterm::readNRF("Testing/source_loh.nrf", second, 1, 2);
+  REQUIRE(second.size() == 1);
+  REQUIRE(second.centres[0](2) == AbsApprox(nrf.centres[0](2)));
+  REQUIRE(second.subfaults[0].area == AbsApprox(nrf.subfaults[0].area));
+  for (size_t dim = 0; dim < 3; dim++) {
+    REQUIRE(second.sroffsets[0][dim] == 0);
+    REQUIRE(second.sroffsets[1][dim] == nrf.sroffsets[1][dim] - nrf.sroffsets[0][dim]);
+    REQUIRE(second.sliprates[dim].size() == second.sroffsets[1][dim]);
+    for (unsigned i = 0; i < second.sliprates[dim].size(); i++) {
+      REQUIRE(second.sliprates[dim][i] == AbsApprox(nrf.sliprates[dim][nrf.sroffsets[0][dim] + i]));
+    }
+  }
+}
+
+TEST_CASE("NRF Reader slices of several subfaults") {
+  // Three subfaults with different numbers of samples per direction, including none
+  const std::vector<seissol::sourceterm::Offsets> samples = {{3, 0, 2}, {1, 4, 0}, {2, 2, 1}};
+  seissol::sourceterm::NRF source;
+  source.sroffsets.push_back({0, 0, 0});
+  for (unsigned subfault = 0; subfault < samples.size(); ++subfault) {
+    source.centres.emplace_back(1000.0 * subfault, -500.0, 2000.0 + subfault);
+    seissol::sourceterm::Subfault sf{};
+    sf.tinit = 0.5 * subfault;
+    sf.timestep = 0.01;
+    sf.mu = 3.0e10;
+    sf.area = 1.0e6 * (subfault + 1);
+    sf.tan1 = Eigen::Vector3d(0.0, 1.0, 0.0);
+    sf.tan2 = Eigen::Vector3d(0.0, 0.0, 1.0);
+    sf.normal = Eigen::Vector3d(1.0, 0.0, 0.0);
+    source.subfaults.push_back(sf);
+    auto offsets = source.sroffsets.back();
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      for (unsigned sample = 0; sample < samples[subfault][dim]; ++sample) {
+        source.sliprates[dim].push_back(100.0 * subfault + 10.0 * dim + sample);
+      }
+      offsets[dim] += samples[subfault][dim];
+    }
+    source.sroffsets.push_back(offsets);
+  }
+
+  const std::string fileName = "nrf-reader-slices-test.nrf";
+  writeTestNRF(fileName, source);
+
+  // One slice is empty if there are more slices than subfaults
+  for (const int numberOfSlices : {1, 2, 3, 4}) {
+    CAPTURE(numberOfSlices);
+    std::size_t subfault = 0;
+    for (int slice = 0; slice < numberOfSlices; ++slice) {
+      seissol::sourceterm::NRF nrf;
+      seissol::sourceterm::readNRF(fileName.c_str(), nrf, slice, numberOfSlices);
+      REQUIRE(nrf.subfaults.size() == nrf.size());
+      REQUIRE(nrf.sroffsets.size() == nrf.size() + 1);
+      for (size_t dim = 0; dim < 3; dim++) {
+        REQUIRE(nrf.sroffsets[0][dim] == 0);
+        REQUIRE(nrf.sliprates[dim].size() == nrf.sroffsets[nrf.size()][dim]);
+      }
+
+      for (std::size_t local = 0; local < nrf.size(); ++local, ++subfault) {
+        REQUIRE(subfault < source.size());
+        for (size_t dim = 0; dim < 3; dim++) {
+          REQUIRE(nrf.centres[local](dim) == source.centres[subfault](dim));
+          REQUIRE(nrf.subfaults[local].normal(dim) == source.subfaults[subfault].normal(dim));
+        }
+        REQUIRE(nrf.subfaults[local].tinit == source.subfaults[subfault].tinit);
+        REQUIRE(nrf.subfaults[local].area == source.subfaults[subfault].area);
+
+        for (size_t dim = 0; dim < 3; dim++) {
+          const auto count = nrf.sroffsets[local + 1][dim] - nrf.sroffsets[local][dim];
+          REQUIRE(count == samples[subfault][dim]);
+          for (unsigned i = 0; i < count; i++) {
+            REQUIRE(nrf.sliprates[dim][nrf.sroffsets[local][dim] + i] ==
+                    source.sliprates[dim][source.sroffsets[subfault][dim] + i]);
+          }
+        }
+      }
+    }
+    // The slices cover all subfaults exactly once
+    REQUIRE(subfault == source.size());
+  }
+
+  std::remove(fileName.c_str());
+}
 } // namespace seissol::unit_test
@@ -0,0 +1,138 @@
+#include "ResultWriter/ReceiverWriterExecutor.h"
+
+#include "Kernels/precision.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace seissol::unit_test {
+
+class ReceiverExecInfo : public async::ExecInfo {
+  public:
+  void add(const void* data, std::size_t size) {
+    buffers.push_back(data);
+    _addBuffer(size);
+  }
+
+  const void* buffer(unsigned int id) const override { return buffers[id]; }
+
+  private:
+  std::vector<const void*> buffers;
+};
+
+class BinaryReader {
+  public:
+  explicit BinaryReader(const std::vector<char>& data) : data(data) {}
+
+  template <typename T>
+  T read() {
+    T value;
+    REQUIRE(offset + sizeof(T) <= data.size());
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+  }
+
+  std::string read(std::size_t size) {
+    REQUIRE(offset + size <= data.size());
+    std::string value(data.data() + offset, size);
+    offset += size;
+    return value;
+  }
+
+  bool atEnd() const { return offset == data.size(); }
+
+  private:
+  const std::vector<char>& data;
+  std::size_t offset = 0;
+};
+
+TEST_CASE("Binary receiver file layout") {
+  using writer::ReceiverWriterExecutor;
+
+  const std::string fileName = "receiver-writer-executor-test.bin";
+  std::remove(fileName.c_str());
+
+  const std::string names = "Time,v1,v2";
+  constexpr std::uint64_t NumberOfColumns = 3;
+  const std::vector<writer::ReceiverPointRecord> points = {{4, {1.0, 2.0, 3.0}},
+                                                           {1, {-1.0, 0.5, 7.0}}};
+
+  ReceiverWriterExecutor executor;
+  {
+    ReceiverExecInfo info;
+    info.add(fileName.c_str(), fileName.size() + 1);
+    info.add(names.c_str(), names.size() + 1);
+    info.add(points.data(), points.size() * sizeof(writer::ReceiverPointRecord));
+    info.add(nullptr, 0);
+    info.add(nullptr, 0);
+    executor.execInit(info, writer::ReceiverInitParam{NumberOfColumns});
+  }
+
+  // Two samples for the first receiver, none for the second one
+  const std::vector<std::uint64_t> sampleCounts = {2, 0};
+  const std::vector<real> samples = {0.1, 1.0, 2.0, 0.2, 3.0, 4.0};
+  {
+    ReceiverExecInfo info;
+    info.add(nullptr, 0);
+    info.add(nullptr, 0);
+    info.add(nullptr, 0);
+    info.add(sampleCounts.data(), sampleCounts.size() * sizeof(std::uint64_t));
+    info.add(samples.data(), samples.size() * sizeof(real));
+    executor.exec(info, writer::ReceiverParam{0.25});
+  }
+  executor.finalize();
+
+  std::ifstream file(fileName, std::ios::binary);
+  REQUIRE(file.good());
+  const std::vector<char> data{std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>()};
+  file.close();
+  std::remove(fileName.c_str());
+
+  BinaryReader reader(data);
+
+  // Header
+  REQUIRE(reader.read(sizeof(ReceiverWriterExecutor::FileMagic)) ==
+          std::string(ReceiverWriterExecutor::FileMagic, sizeof(ReceiverWriterExecutor::FileMagic)));
+  REQUIRE(reader.read<std::uint64_t>() == points.size());
+  REQUIRE(reader.read<std::uint64_t>() == NumberOfColumns);
+  REQUIRE(reader.read<std::uint64_t>() == sizeof(real));
+  const auto namesSize = reader.read<std::uint64_t>();
+  REQUIRE(reader.read(namesSize) == names);
+
+  // Point records
+  for (const auto& point : points) {
+    const auto record = reader.read<writer::ReceiverPointRecord>();
+    REQUIRE(record.pointId == point.pointId);
+    for (int d = 0; d < 3; ++d) {
+      REQUIRE(record.position[d] == point.position[d]);
+    }
+  }
+
+  // Sample block
+  REQUIRE(reader.read(sizeof(ReceiverWriterExecutor::BlockMagic)) ==
+          std::string(ReceiverWriterExecutor::BlockMagic, sizeof(ReceiverWriterExecutor::BlockMagic)));
+  REQUIRE(reader.read<double>() == 0.25);
+  REQUIRE(reader.read<std::uint64_t>() == points.size());
+  const std::uint64_t payloadSize =
+      points.size() * 2 * sizeof(std::uint64_t) + samples.size() * sizeof(real);
+  REQUIRE(reader.read<std::uint64_t>() == payloadSize);
+
+  std::size_t sample = 0;
+  for (std::size_t r = 0; r < points.size(); ++r) {
+    REQUIRE(reader.read<std::uint64_t>() == points[r].pointId);
+    REQUIRE(reader.read<std::uint64_t>() == sampleCounts[r]);
+    for (std::uint64_t i = 0; i < sampleCounts[r] * NumberOfColumns; ++i) {
+      REQUIRE(reader.read<real>() == samples[sample++]);
+    }
+  }
+  REQUIRE(reader.atEnd());
+}
+
+} // namespace seissol::unit_test
@@ -2,4 +2,4 @@
 #include "tests/TestHelper.h"
 
 #include "ReceiverWriter.t.h"
-
+#include "ReceiverWriterExecutor.t.h"
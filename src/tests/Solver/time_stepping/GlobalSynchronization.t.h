@@ -0,0 +1,51 @@
+#include "doctest.h"
+
+#include "Modules/Module.h"
+#include "Modules/Modules.h"
+#include "Solver/Simulator.h"
+
+namespace seissol::unit_test {
+
+// Mimics a module evaluating an abort criterion, e.g. the energy output
+class GlobalSynchronizationModule : public Module {
+  public:
+  explicit GlobalSynchronizationModule(double interval) {
+    setSyncInterval(interval);
+    Modules::registerHook(*this, ModuleHook::SynchronizationPoint);
+  }
+
+  bool requiresGlobalSynchronization() const override { return true; }
+
+  void syncPoint(double currentTime) override { lastSyncPoint = currentTime; }
+
+  double lastSyncPoint = -1.0;
+};
+
+TEST_CASE("Global barrier at synchronization points") {
+  constexpr double TimeTolerance = 1e-10;
+  static GlobalSynchronizationModule module(0.75);
+  Modules::setSimulationStartTime(0.0);
+
+  Simulator simulator;
+
+  SUBCASE("Barrier is decided for the interval being entered") {
+    REQUIRE(!simulator.requiresGlobalBarrier(0.5, TimeTolerance));
+    REQUIRE(simulator.requiresGlobalBarrier(0.75, TimeTolerance));
+
+    // The hooks move the module on to its next synchronization point; evaluating the barrier
+    // after them would miss the synchronization point at 0.75.
+    Modules::callSyncHook(0.75, TimeTolerance);
+    REQUIRE(module.lastSyncPoint == 0.75);
+    REQUIRE(!simulator.requiresGlobalBarrier(0.75, TimeTolerance));
+    REQUIRE(simulator.requiresGlobalBarrier(1.5, TimeTolerance));
+  }
+
+  SUBCASE("Checkpoints require a barrier") {
+    REQUIRE(!simulator.requiresGlobalBarrier(1.0, TimeTolerance));
+    simulator.setCheckPointInterval(1.0);
+    REQUIRE(simulator.requiresGlobalBarrier(1.0, TimeTolerance));
+    REQUIRE(!simulator.requiresGlobalBarrier(0.5, TimeTolerance));
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,93 @@
+#include "doctest.h"
+
+#include <cmath>
+#include <vector>
+
+#include "Solver/time_stepping/HaloCodec.h"
+
+namespace seissol::unit_test {
+using namespace time_stepping;
+
+namespace {
+std::vector<real> haloCodecTestData() {
+  // smooth data with a few repeated values, similar to the coefficients of a copy layer
+  std::vector<real> data(2000);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = (i % 7 == 0) ? 0.0 : static_cast<real>(std::sin(0.01 * i) * 1.0e3);
+  }
+  return data;
+}
+} // namespace
+
+TEST_CASE("Halo codec") {
+  const auto data = haloCodecTestData();
+
+  SUBCASE("Shuffle round trip") {
+    const auto* bytes = reinterpret_cast<const char*>(data.data());
+    std::vector<char> shuffled(data.size() * sizeof(real));
+    std::vector<real> result(data.size());
+    halo_codec::shuffle(bytes, data.size(), sizeof(real), shuffled.data());
+    REQUIRE(shuffled[1] == bytes[sizeof(real)]);
+    halo_codec::unshuffle(
+        shuffled.data(), data.size(), sizeof(real), reinterpret_cast<char*>(result.data()));
+    REQUIRE(result == data);
+  }
+
+  SUBCASE("Compression round trip") {
+    std::vector<char> in(10000);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      in[i] = static_cast<char>((i / 100) % 3 + (i % 5 == 0 ? i % 251 : 0));
+    }
+    std::vector<char> compressed(in.size());
+    const auto compressedSize = halo_codec::compress(in.data(), in.size(), compressed.data(), compressed.size());
+    REQUIRE(compressedSize > 0);
+    REQUIRE(compressedSize < in.size());
+
+    std::vector<char> out(in.size());
+    REQUIRE(halo_codec::decompress(compressed.data(), compressedSize, out.data(), out.size()));
+    REQUIRE(out == in);
+    REQUIRE(!halo_codec::decompress(compressed.data(), compressedSize, out.data(), out.size() - 1));
+  }
+
+  SUBCASE("Incompressible data does not fit") {
+    std::vector<char> in(1000);
+    unsigned state = 12345;
+    for (auto& value : in) {
+      state = state * 1103515245U + 12345U;
+      value = static_cast<char>(state >> 24);
+    }
+    std::vector<char> compressed(in.size());
+    REQUIRE(halo_codec::compress(in.data(), in.size(), compressed.data(), compressed.size()) == 0);
+  }
+
+  SUBCASE("Lossless codec") {
+    const HaloCodec codec(HaloCodecType::Lossless);
+    std::vector<char> encoded(codec.maxEncodedSize(data.size()));
+    const auto encodedSize = codec.encode(data.data(), data.size(), encoded.data());
+    REQUIRE(encodedSize <= encoded.size());
+
+    std::vector<real> result(data.size());
+    codec.decode(encoded.data(), data.size(), result.data());
+    REQUIRE(result == data);
+  }
+
+  SUBCASE("Float codec") {
+    const HaloCodec codec(HaloCodecType::Float);
+    std::vector<char> encoded(codec.maxEncodedSize(data.size()));
+    REQUIRE(codec.encode(data.data(), data.size(), encoded.data()) == data.size() * sizeof(float));
+
+    std::vector<real> result(data.size());
+    codec.decode(encoded.data(), data.size(), result.data());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      REQUIRE(result[i] == static_cast<real>(static_cast<float>(data[i])));
+    }
+  }
+
+  SUBCASE("Codec names") {
+    REQUIRE(haloCodecTypeFromString("Lossless") == HaloCodecType::Lossless);
+    REQUIRE(haloCodecTypeFromString("float") == HaloCodecType::Float);
+    REQUIRE(haloCodecTypeFromString("none") == HaloCodecType::None);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,57 @@
+#include "doctest.h"
+
+#include <thread>
+
+#include "Solver/time_stepping/ActorState.h"
+
+namespace seissol::unit_test {
+using namespace time_stepping;
+
+TEST_CASE("Message queue") {
+  MessageQueue queue;
+  REQUIRE(!queue.hasMessages());
+
+  SUBCASE("Messages are received in order") {
+    // more messages than fit into one segment
+    constexpr long NumberOfMessages = 1000;
+    for (long i = 0; i < NumberOfMessages; ++i) {
+      if (i % 2 == 0) {
+        queue.push(AdvancedPredictionTimeMessage{static_cast<double>(i), i});
+      } else {
+        queue.push(AdvancedCorrectionTimeMessage{static_cast<double>(i), i});
+      }
+    }
+    REQUIRE(queue.size() == NumberOfMessages);
+    for (long i = 0; i < NumberOfMessages; ++i) {
+      REQUIRE(queue.hasMessages());
+      const auto message = queue.pop();
+      REQUIRE(message.index() == static_cast<std::size_t>(i % 2));
+      std::visit([i](auto&& msg) { REQUIRE(msg.stepsSinceSync == i); }, message);
+    }
+    REQUIRE(!queue.hasMessages());
+    REQUIRE(queue.size() == 0);
+  }
+
+  SUBCASE("Producer and consumer on different threads") {
+    constexpr long NumberOfMessages = 100000;
+    std::thread producer([&queue]() {
+      for (long i = 0; i < NumberOfMessages; ++i) {
+        queue.push(AdvancedCorrectionTimeMessage{static_cast<double>(i), i});
+      }
+    });
+    long expected = 0;
+    bool inOrder = true;
+    while (expected < NumberOfMessages) {
+      if (queue.hasMessages()) {
+        const auto message = std::get<AdvancedCorrectionTimeMessage>(queue.pop());
+        inOrder = inOrder && message.stepsSinceSync == expected;
+        ++expected;
+      }
+    }
+    producer.join();
+    REQUIRE(inOrder);
+    REQUIRE(!queue.hasMessages());
+  }
+}
+
+} // namespace seissol::unit_test
@@ -2,3 +2,6 @@
 #include <doctest/trompeloeil.hpp>
 
 #include "AbstractTimeCluster.t.h"
+#include "GlobalSynchronization.t.h"
+#include "HaloCodec.t.h"
+#include "MessageQueue.t.h"